@@ -0,0 +1,140 @@
+/************************************************************************************************
+ * SwiftlyS2 is a scripting framework for Source2-based games.
+ * Copyright (C) 2023-2026 Swiftly Solution SRL via Sava Andrei-Sebastian and it's contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ ************************************************************************************************/
+
+// Contention microbenchmark for QueueMutex against the condition variable queue it replaced
+// and a plain std::mutex. Build with `xmake build benchmark_mutex` and run `xmake run benchmark_mutex`.
+// Overlaps counts how often two threads were inside the critical section at the same time.
+
+#include <api/utils/mutex.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+class LegacyQueueMutex
+{
+public:
+    LegacyQueueMutex() : locked(false) {}
+
+    void lock()
+    {
+        std::unique_lock<std::mutex> lk(internal_m);
+
+        if (!locked)
+        {
+            locked = true;
+            return;
+        }
+
+        std::condition_variable cv;
+        waiters.push(&cv);
+
+        cv.wait(lk, [&]
+            { return &cv == waiters.front(); });
+
+        locked = true;
+        waiters.pop();
+    }
+
+    void unlock()
+    {
+        std::lock_guard<std::mutex> lk(internal_m);
+        locked = false;
+        if (!waiters.empty())
+        {
+            waiters.front()->notify_one();
+        }
+    }
+
+private:
+    std::mutex internal_m;
+    bool locked;
+    std::queue<std::condition_variable*> waiters;
+};
+
+struct BenchmarkResult
+{
+    double nsPerOp;
+    uint64_t overlaps;
+};
+
+template<typename Mutex>
+BenchmarkResult RunBenchmark(int threads, int iterations, int work)
+{
+    Mutex mtx;
+    volatile uint64_t shared = 0;
+    std::atomic<int> inside{ 0 };
+    std::atomic<uint64_t> overlaps{ 0 };
+
+    auto start = std::chrono::steady_clock::now();
+
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; t++)
+    {
+        workers.emplace_back([&]() {
+            for (int i = 0; i < iterations; i++)
+            {
+                mtx.lock();
+                if (inside.fetch_add(1, std::memory_order_relaxed) != 0)
+                    overlaps.fetch_add(1, std::memory_order_relaxed);
+
+                for (int w = 0; w < work; w++)
+                    shared = shared + 1;
+
+                inside.fetch_sub(1, std::memory_order_relaxed);
+                mtx.unlock();
+            }
+            });
+    }
+
+    for (auto& worker : workers)
+        worker.join();
+
+    auto elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    return { elapsed / ((double)threads * iterations), overlaps.load() };
+}
+
+int main()
+{
+    const int iterations = 200000;
+    printf("hardware threads: %u\n", std::thread::hardware_concurrency());
+    printf("%-8s %-6s %24s %24s %24s\n", "threads", "work", "Legacy ns/op (overlaps)", "QueueMutex", "std::mutex");
+
+    for (int threads : { 1, 2, 4, 8, 16 })
+    {
+        for (int work : { 0, 50, 1000 })
+        {
+            int count = threads == 1 ? iterations * 5 : iterations / threads * 2;
+            auto legacy = RunBenchmark<LegacyQueueMutex>(threads, count, work);
+            auto queue = RunBenchmark<QueueMutex>(threads, count, work);
+            auto standard = RunBenchmark<std::mutex>(threads, count, work);
+
+            printf("%-8d %-6d %14.1f (%7llu) %14.1f (%7llu) %14.1f (%7llu)\n", threads, work,
+                legacy.nsPerOp, (unsigned long long)legacy.overlaps,
+                queue.nsPerOp, (unsigned long long)queue.overlaps,
+                standard.nsPerOp, (unsigned long long)standard.overlaps);
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,79 @@
+/************************************************************************************************
+ * SwiftlyS2 is a scripting framework for Source2-based games.
+ * Copyright (C) 2023-2026 Swiftly Solution SRL via Sava Andrei-Sebastian and it's contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ ************************************************************************************************/
+
+#ifndef benchmarks_natives_bench_h
+#define benchmarks_natives_bench_h
+
+#include <cstdint>
+#include <vector>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+// A benchmark runs its body `iterations` times and is timed as a whole, the harness
+// picks the iteration count so that one run takes at least the configured minimum time.
+// Threaded benchmarks split the iterations between their threads themselves.
+typedef void (*BenchmarkFn)(uint64_t iterations);
+
+struct BenchmarkEntry
+{
+    const char* name;
+    BenchmarkFn fn;
+    bool model; // times a stand-in for code that can't be linked offline, not the production code
+};
+
+inline std::vector<BenchmarkEntry>& GetBenchmarks()
+{
+    static std::vector<BenchmarkEntry> benchmarks;
+    return benchmarks;
+}
+
+struct BenchmarkRegistrar
+{
+    BenchmarkRegistrar(const char* name, BenchmarkFn fn, bool model = false)
+    {
+        GetBenchmarks().push_back({ name, fn, model });
+    }
+};
+
+#define BENCHMARK_CONCAT_INNER(a, b) a##b
+#define BENCHMARK_CONCAT(a, b) BENCHMARK_CONCAT_INNER(a, b)
+
+// BENCHMARK("category/name", fn)
+#define BENCHMARK(name, fn) static BenchmarkRegistrar BENCHMARK_CONCAT(g_BenchmarkRegistrar, __LINE__)(name, fn)
+// BENCHMARK_MODEL("category_model/name", fn), the name has to say it's a model as well
+#define BENCHMARK_MODEL(name, fn) static BenchmarkRegistrar BENCHMARK_CONCAT(g_BenchmarkRegistrar, __LINE__)(name, fn, true)
+
+#if defined(_MSC_VER) && !defined(__clang__)
+inline const volatile void* g_pBenchmarkSink = nullptr;
+#endif
+
+// keeps the compiler from dropping a result that is never read
+template<typename T>
+inline void DoNotOptimize(T&& value)
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    g_pBenchmarkSink = &value;
+    _ReadWriteBarrier();
+#else
+    asm volatile("" : : "g"(&value) : "memory");
+#endif
+}
+
+#endif
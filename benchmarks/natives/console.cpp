@@ -0,0 +1,118 @@
+/************************************************************************************************
+ * SwiftlyS2 is a scripting framework for Source2-based games.
+ * Copyright (C) 2023-2026 Swiftly Solution SRL via Sava Andrei-Sebastian and it's contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ ************************************************************************************************/
+
+// Console filtering as done for every line the engine logs, through the ConsoleFilterSet that
+// CConsoleOutput uses (src/engine/consoleoutput/filters.cpp): one JIT compiled alternation tagged with
+// (*MARK:<index>), backreference patterns matched one by one. Matching every filter on its own is kept
+// as a model of what the alternation replaced.
+
+#include "bench.h"
+
+#include <engine/consoleoutput/filters.h>
+
+#include <pcre2.h>
+
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <string>
+
+struct ConsoleFilterConfig
+{
+    const char* key;
+    const char* pattern;
+};
+
+static const ConsoleFilterConfig g_ConsoleFilters[] = {
+    { "missing_models", "^Error: model .* not found" },
+    { "sound_precache", "SoundEvent .* has no sounds" },
+    { "material_errors", "Material .* has unknown shader" },
+    { "bot_chatter", "^\\[BotChatter\\]" },
+    { "steam_auth", "S3: Client connected with ticket" },
+    { "spew_entity", "CEntitySystem::.*entity index \\d+ out of range" },
+    { "voice_data", "^Voice data for client \\d+ dropped" },
+    { "duplicate_words", "\\b(\\w+) \\1\\b" },
+};
+
+static const char* g_pConsoleLines[] = {
+    "L 10/19/2026 - 12:00:01: \"Sava<2><[U:1:1234]><CT>\" say \"gg\"\n",
+    "SoundEvent Weapon_AK47.Single has no sounds\n",
+    "Loading map \"de_dust2\"\n",
+    "[BotChatter] Bot Andrei: Enemy spotted\n",
+    "Server is hibernating\n",
+    "CEntitySystem::AddEntity entity index 17000 out of range\n",
+    "Connection to Steam servers successful.\n",
+    "the the quick brown fox\n",
+};
+
+// built the same way ReloadFilterConfiguration builds it from confilter.jsonc
+static ConsoleFilterSet& GetConsoleFilterSet()
+{
+    static ConsoleFilterSet set;
+    static bool compiled = []() {
+        for (auto& filter : g_ConsoleFilters)
+        {
+            size_t erroffset;
+            if (!set.Add(filter.key, filter.pattern, erroffset))
+                fprintf(stderr, "console filter \"%s\" failed to compile at offset %zu\n", filter.key, erroffset);
+        }
+
+        set.Compile();
+        return true;
+        }();
+
+    (void)compiled;
+    return set;
+}
+
+static bool MatchCombined(ConsoleFilterSet& set, pcre2_match_data* match_data, const char* text, size_t len)
+{
+    return set.Matches(text, len);
+}
+
+static bool MatchEach(ConsoleFilterSet& set, pcre2_match_data* match_data, const char* text, size_t len)
+{
+    for (auto& filter : set.GetFilters())
+    {
+        if (pcre2_match(filter->re, (PCRE2_SPTR)text, len, 0, 0, match_data, nullptr) >= 0)
+            return true;
+    }
+
+    return false;
+}
+
+template<bool (*Match)(ConsoleFilterSet&, pcre2_match_data*, const char*, size_t)>
+static void ConsoleFilterBenchmark(uint64_t iterations)
+{
+    auto& set = GetConsoleFilterSet();
+    std::unique_ptr<pcre2_match_data, decltype(&pcre2_match_data_free)> match_data(pcre2_match_data_create(1, nullptr), &pcre2_match_data_free);
+
+    size_t lengths[std::size(g_pConsoleLines)];
+    for (size_t i = 0; i < std::size(g_pConsoleLines); i++)
+        lengths[i] = strlen(g_pConsoleLines[i]);
+
+    for (uint64_t i = 0; i < iterations; i++)
+    {
+        size_t line = i % std::size(g_pConsoleLines);
+        bool matched = Match(set, match_data.get(), g_pConsoleLines[line], lengths[line]);
+        DoNotOptimize(matched);
+    }
+}
+
+BENCHMARK("console/filter_combined", ConsoleFilterBenchmark<MatchCombined>);
+BENCHMARK_MODEL("console_model/filter_each", ConsoleFilterBenchmark<MatchEach>);
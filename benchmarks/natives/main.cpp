@@ -0,0 +1,301 @@
+/************************************************************************************************
+ * SwiftlyS2 is a scripting framework for Source2-based games.
+ * Copyright (C) 2023-2026 Swiftly Solution SRL via Sava Andrei-Sebastian and it's contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ ************************************************************************************************/
+
+// Offline microbenchmarks for the native side: schema lookups, color processing, command parsing,
+// console filtering, netmessage field access, the allocator and the locking primitives. The engine
+// isn't loaded and interfaces come from stubs/. Benchmarks over code that can't be linked offline time
+// a model of it instead, their names contain "_model" and their json entries have "model": true.
+// Build with `xmake build benchmark_natives` and run `xmake run benchmark_natives [options]`.
+//
+//   --filter <text>       only run benchmarks whose name contains text
+//   --min-time <ms>       minimum duration of a single repetition (default 100)
+//   --repetitions <n>     repetitions per benchmark, the median is reported (default 5)
+//   --json <path>         write the results as json, - for stdout
+//   --baseline <path>     compare against a json written by an earlier run
+//   --threshold <percent> slowdown against the baseline counted as a regression (default 10)
+//   --list                print the benchmark names and exit
+//
+// With --baseline the exit code is 1 when any benchmark regressed past the threshold.
+
+#include "bench.h"
+
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+using json = nlohmann::json;
+
+#define BENCHMARK_MAX_ITERATIONS 10000000000ULL
+
+struct BenchmarkOptions
+{
+    std::string filter;
+    double minTimeNs = 100e6;
+    int repetitions = 5;
+    std::string jsonPath;
+    std::string baselinePath;
+    double threshold = 10.0;
+    bool list = false;
+};
+
+struct BenchmarkResult
+{
+    std::string name;
+    bool model = false;
+    uint64_t iterations = 0;
+    double nsPerOp = 0;
+    double minNsPerOp = 0;
+    double maxNsPerOp = 0;
+};
+
+static double TimeBenchmark(BenchmarkFn fn, uint64_t iterations)
+{
+    auto start = std::chrono::steady_clock::now();
+    fn(iterations);
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+}
+
+// doubles as the warmup, grows the iteration count until a run takes at least min_time
+static uint64_t CalibrateBenchmark(BenchmarkFn fn, double min_time)
+{
+    uint64_t iterations = 1;
+
+    while (iterations < BENCHMARK_MAX_ITERATIONS)
+    {
+        double elapsed = TimeBenchmark(fn, iterations);
+        if (elapsed >= min_time) break;
+
+        double scale = elapsed > 0 ? (min_time * 1.2) / elapsed : 100.0;
+        iterations = std::min<uint64_t>(BENCHMARK_MAX_ITERATIONS, (uint64_t)(iterations * std::clamp(scale, 2.0, 100.0)));
+    }
+
+    return iterations;
+}
+
+static BenchmarkResult RunBenchmark(const BenchmarkEntry& benchmark, const BenchmarkOptions& options)
+{
+    BenchmarkResult result;
+    result.name = benchmark.name;
+    result.model = benchmark.model;
+    result.iterations = CalibrateBenchmark(benchmark.fn, options.minTimeNs);
+
+    std::vector<double> samples;
+    for (int i = 0; i < options.repetitions; i++)
+        samples.push_back(TimeBenchmark(benchmark.fn, result.iterations) / (double)result.iterations);
+
+    std::sort(samples.begin(), samples.end());
+    size_t mid = samples.size() / 2;
+    result.nsPerOp = samples.size() % 2 ? samples[mid] : (samples[mid - 1] + samples[mid]) / 2;
+    result.minNsPerOp = samples.front();
+    result.maxNsPerOp = samples.back();
+    return result;
+}
+
+static bool ParseOptions(int argc, char** argv, BenchmarkOptions& options)
+{
+    for (int i = 1; i < argc; i++)
+    {
+        std::string arg = argv[i];
+
+        if (arg == "--list")
+        {
+            options.list = true;
+            continue;
+        }
+
+        if (i + 1 >= argc)
+        {
+            fprintf(stderr, "unknown or incomplete option: %s\n", arg.c_str());
+            return false;
+        }
+
+        const char* value = argv[++i];
+        if (arg == "--filter") options.filter = value;
+        else if (arg == "--min-time") options.minTimeNs = strtod(value, nullptr) * 1e6;
+        else if (arg == "--repetitions") options.repetitions = atoi(value);
+        else if (arg == "--json") options.jsonPath = value;
+        else if (arg == "--baseline") options.baselinePath = value;
+        else if (arg == "--threshold") options.threshold = strtod(value, nullptr);
+        else
+        {
+            fprintf(stderr, "unknown option: %s\n", arg.c_str());
+            return false;
+        }
+    }
+
+    if (options.repetitions < 1 || options.minTimeNs <= 0)
+    {
+        fprintf(stderr, "--repetitions and --min-time have to be positive\n");
+        return false;
+    }
+
+    return true;
+}
+
+static bool LoadBaseline(const std::string& path, std::map<std::string, double>& baseline)
+{
+    std::ifstream file(path);
+    if (!file.is_open())
+    {
+        fprintf(stderr, "couldn't open baseline %s\n", path.c_str());
+        return false;
+    }
+
+    json data = json::parse(file, nullptr, false);
+    if (data.is_discarded() || !data.contains("benchmarks") || !data["benchmarks"].is_array())
+    {
+        fprintf(stderr, "baseline %s isn't a benchmark_natives result\n", path.c_str());
+        return false;
+    }
+
+    for (auto& entry : data["benchmarks"])
+    {
+        if (entry.contains("name") && entry.contains("ns_per_op"))
+            baseline[entry["name"].get<std::string>()] = entry["ns_per_op"].get<double>();
+    }
+
+    return true;
+}
+
+static json ResultsToJson(const std::vector<BenchmarkResult>& results, const BenchmarkOptions& options)
+{
+    char date[32];
+    time_t now = time(nullptr);
+    strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%SZ", gmtime(&now));
+
+    json benchmarks = json::array();
+    for (auto& result : results)
+    {
+        benchmarks.push_back({
+            { "name", result.name },
+            { "model", result.model },
+            { "iterations", result.iterations },
+            { "ns_per_op", result.nsPerOp },
+            { "min_ns_per_op", result.minNsPerOp },
+            { "max_ns_per_op", result.maxNsPerOp },
+        });
+    }
+
+    return {
+        { "context", {
+            { "date", date },
+            { "hardware_threads", std::thread::hardware_concurrency() },
+#ifdef NDEBUG
+            { "build", "release" },
+#else
+            { "build", "debug" },
+#endif
+            { "min_time_ms", options.minTimeNs / 1e6 },
+            { "repetitions", options.repetitions },
+        } },
+        { "benchmarks", benchmarks },
+    };
+}
+
+int main(int argc, char** argv)
+{
+    BenchmarkOptions options;
+    if (!ParseOptions(argc, argv, options)) return 2;
+
+    auto benchmarks = GetBenchmarks();
+    std::sort(benchmarks.begin(), benchmarks.end(), [](const BenchmarkEntry& a, const BenchmarkEntry& b) { return strcmp(a.name, b.name) < 0; });
+
+    if (options.list)
+    {
+        for (auto& benchmark : benchmarks)
+            printf("%s\n", benchmark.name);
+        return 0;
+    }
+
+    std::map<std::string, double> baseline;
+    if (!options.baselinePath.empty() && !LoadBaseline(options.baselinePath, baseline)) return 2;
+
+    // with json on stdout the table goes to stderr so the output stays parseable
+    FILE* out = options.jsonPath == "-" ? stderr : stdout;
+
+    fprintf(out, "hardware threads: %u\n", std::thread::hardware_concurrency());
+    fprintf(out, "%-34s %14s %12s %12s %12s", "benchmark", "iterations", "ns/op", "min", "max");
+    if (!baseline.empty()) fprintf(out, " %12s %9s", "baseline", "delta");
+    fprintf(out, "\n");
+
+    std::vector<BenchmarkResult> results;
+    int regressions = 0;
+
+    for (auto& benchmark : benchmarks)
+    {
+        if (!options.filter.empty() && !strstr(benchmark.name, options.filter.c_str())) continue;
+
+        auto result = RunBenchmark(benchmark, options);
+        fprintf(out, "%-34s %14llu %12.2f %12.2f %12.2f", result.name.c_str(), (unsigned long long)result.iterations, result.nsPerOp, result.minNsPerOp, result.maxNsPerOp);
+
+        auto it = baseline.find(result.name);
+        if (it != baseline.end() && it->second > 0)
+        {
+            double delta = (result.nsPerOp - it->second) / it->second * 100.0;
+            bool regressed = delta > options.threshold;
+            if (regressed) regressions++;
+
+            fprintf(out, " %12.2f %+8.1f%%%s", it->second, delta, regressed ? " REGRESSED" : "");
+        }
+        else if (!baseline.empty())
+        {
+            fprintf(out, " %12s %9s", "-", "new");
+        }
+
+        fprintf(out, "\n");
+        fflush(out);
+        results.push_back(std::move(result));
+    }
+
+    if (!options.jsonPath.empty())
+    {
+        std::string data = ResultsToJson(results, options).dump(4);
+        if (options.jsonPath == "-")
+        {
+            printf("%s\n", data.c_str());
+        }
+        else
+        {
+            std::ofstream file(options.jsonPath, std::ios::trunc);
+            if (!file.is_open())
+            {
+                fprintf(stderr, "couldn't write %s\n", options.jsonPath.c_str());
+                return 2;
+            }
+            file << data << "\n";
+        }
+    }
+
+    if (!baseline.empty())
+    {
+        fprintf(out, "%d of %zu benchmarks regressed by more than %.1f%%\n", regressions, results.size(), options.threshold);
+        return regressions > 0 ? 1 : 0;
+    }
+
+    return 0;
+}
@@ -0,0 +1,167 @@
+/************************************************************************************************
+ * SwiftlyS2 is a scripting framework for Source2-based games.
+ * Copyright (C) 2023-2026 Swiftly Solution SRL via Sava Andrei-Sebastian and it's contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ ************************************************************************************************/
+
+// Allocation and synchronization primitives under the native layer: the per-owner arena,
+// QueueMutex and the MPSC ring the log writer feeds from. Contention in more detail is covered
+// by benchmark_mutex, this only tracks the common cases for regressions.
+
+#include "bench.h"
+
+#include <api/utils/mutex.h>
+#include <api/utils/ringbuffer.h>
+#include <memory/allocator/arena.h>
+
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#define CONTENDED_THREADS 4
+#define ARENA_RESET_INTERVAL 4096
+
+static const uint64_t g_uAllocSizes[] = { 16, 24, 48, 64, 128, 256, 40, 512 };
+
+static void ArenaAlloc(uint64_t iterations)
+{
+    MemoryArena arena;
+    for (uint64_t i = 0; i < iterations; i++)
+    {
+        void* ptr = arena.Alloc(g_uAllocSizes[i % std::size(g_uAllocSizes)]);
+        DoNotOptimize(ptr);
+
+        if (i % ARENA_RESET_INTERVAL == ARENA_RESET_INTERVAL - 1) arena.Reset(true);
+    }
+}
+
+static void MallocFree(uint64_t iterations)
+{
+    void* ptrs[ARENA_RESET_INTERVAL];
+    uint64_t count = 0;
+
+    for (uint64_t i = 0; i < iterations; i++)
+    {
+        ptrs[count] = malloc(g_uAllocSizes[i % std::size(g_uAllocSizes)]);
+        DoNotOptimize(ptrs[count]);
+
+        if (++count == ARENA_RESET_INTERVAL)
+        {
+            for (uint64_t p = 0; p < count; p++)
+                free(ptrs[p]);
+            count = 0;
+        }
+    }
+
+    for (uint64_t p = 0; p < count; p++)
+        free(ptrs[p]);
+}
+
+BENCHMARK("allocator/arena_alloc", ArenaAlloc);
+BENCHMARK("allocator/malloc_free", MallocFree);
+
+template<typename Mutex>
+static void LockUncontended(uint64_t iterations)
+{
+    Mutex mtx;
+    uint64_t shared = 0;
+
+    for (uint64_t i = 0; i < iterations; i++)
+    {
+        mtx.lock();
+        shared++;
+        mtx.unlock();
+    }
+
+    DoNotOptimize(shared);
+}
+
+template<typename Mutex>
+static void LockContended(uint64_t iterations)
+{
+    Mutex mtx;
+    uint64_t shared = 0;
+
+    std::vector<std::thread> workers;
+    for (int t = 0; t < CONTENDED_THREADS; t++)
+    {
+        workers.emplace_back([&]() {
+            for (uint64_t i = 0; i < iterations / CONTENDED_THREADS; i++)
+            {
+                mtx.lock();
+                shared++;
+                mtx.unlock();
+            }
+            });
+    }
+
+    for (auto& worker : workers)
+        worker.join();
+
+    DoNotOptimize(shared);
+}
+
+BENCHMARK("lock/queue_mutex", LockUncontended<QueueMutex>);
+BENCHMARK("lock/std_mutex", LockUncontended<std::mutex>);
+BENCHMARK("lock/queue_mutex_contended", LockContended<QueueMutex>);
+BENCHMARK("lock/std_mutex_contended", LockContended<std::mutex>);
+
+static void RingPushPop(uint64_t iterations)
+{
+    MPSCRingBuffer<uint64_t> ring(1024);
+    uint64_t value = 0;
+
+    for (uint64_t i = 0; i < iterations; i++)
+    {
+        ring.TryPush(uint64_t(i));
+        ring.TryPop(value);
+    }
+
+    DoNotOptimize(value);
+}
+
+// every producer pushes until its share is in, the consumer drains on the calling thread
+static void RingMultiProducer(uint64_t iterations)
+{
+    MPSCRingBuffer<uint64_t> ring(8192);
+    uint64_t perThread = iterations / CONTENDED_THREADS;
+
+    std::vector<std::thread> producers;
+    for (int t = 0; t < CONTENDED_THREADS; t++)
+    {
+        producers.emplace_back([&]() {
+            for (uint64_t i = 0; i < perThread; i++)
+            {
+                while (!ring.TryPush(uint64_t(i)))
+                    std::this_thread::yield();
+            }
+            });
+    }
+
+    uint64_t value = 0;
+    for (uint64_t received = 0; received < perThread * CONTENDED_THREADS;)
+    {
+        if (ring.TryPop(value)) received++;
+    }
+
+    for (auto& producer : producers)
+        producer.join();
+
+    DoNotOptimize(value);
+}
+
+BENCHMARK("ringbuffer/push_pop", RingPushPop);
+BENCHMARK("ringbuffer/multi_producer", RingMultiProducer);
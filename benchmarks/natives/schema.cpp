@@ -0,0 +1,230 @@
+/************************************************************************************************
+ * SwiftlyS2 is a scripting framework for Source2-based games.
+ * Copyright (C) 2023-2026 Swiftly Solution SRL via Sava Andrei-Sebastian and it's contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ ************************************************************************************************/
+
+// Field lookups that back entity and netmessage accessors. The schema side runs the production
+// lookups from src/sdk/fields.cpp over the real field table, filled with generated classes the size
+// of the game's since the schema system isn't available offline. Protobuf reflection can't be linked
+// here either, so the netmessage side is a model: a string keyed lookup shaped like FindFieldByName
+// followed by a read at the field offset.
+
+#include "bench.h"
+
+#include <sdk/fields.h>
+
+#include <fmt/format.h>
+
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#define SCHEMA_BENCH_CLASSES 2500
+#define SCHEMA_BENCH_FIELDS 12
+#define SCHEMA_BENCH_QUERIES 256
+
+struct SchemaQuery
+{
+    std::string className;
+    std::string fieldName;
+    uint64_t hash;
+};
+
+// fills the production table once and returns the fields that are looked up
+static const std::vector<SchemaQuery>& GetSchemaQueries()
+{
+    static const std::vector<SchemaQuery> queries = []() {
+        std::vector<SchemaQuery> queries;
+        offsets.reserve(SCHEMA_BENCH_CLASSES * SCHEMA_BENCH_FIELDS);
+
+        for (uint32_t c = 0; c < SCHEMA_BENCH_CLASSES; c++)
+        {
+            std::string className = fmt::format("C_GeneratedEntity{}", c);
+            for (uint32_t f = 0; f < SCHEMA_BENCH_FIELDS; f++)
+            {
+                std::string fieldName = fmt::format("m_nGeneratedField{}", f);
+                uint64_t hash = GetSchemaFieldHash(className.c_str(), fieldName.c_str());
+                offsets.insert({ hash, { true, false, false, f * 8, 0, 4 } });
+
+                if ((c * SCHEMA_BENCH_FIELDS + f) % ((SCHEMA_BENCH_CLASSES * SCHEMA_BENCH_FIELDS) / SCHEMA_BENCH_QUERIES) == 0)
+                    queries.push_back({ className, fieldName, hash });
+            }
+        }
+
+        return queries;
+        }();
+
+    return queries;
+}
+
+static void SchemaOffsetByName(uint64_t iterations)
+{
+    auto& queries = GetSchemaQueries();
+    for (uint64_t i = 0; i < iterations; i++)
+    {
+        auto& query = queries[i % queries.size()];
+        const SchemaField* field = FindSchemaField(GetSchemaFieldHash(query.className.c_str(), query.fieldName.c_str()));
+        DoNotOptimize(field);
+    }
+}
+
+static void SchemaOffsetByHash(uint64_t iterations)
+{
+    auto& queries = GetSchemaQueries();
+    for (uint64_t i = 0; i < iterations; i++)
+    {
+        const SchemaField* field = FindSchemaField(queries[i % queries.size()].hash);
+        DoNotOptimize(field);
+    }
+}
+
+static void SchemaOffsetMiss(uint64_t iterations)
+{
+    auto& queries = GetSchemaQueries();
+    for (uint64_t i = 0; i < iterations; i++)
+    {
+        const SchemaField* field = FindSchemaField(queries[i % queries.size()].hash ^ 0x5bd1e995);
+        DoNotOptimize(field);
+    }
+}
+
+static void SchemaPropRead(uint64_t iterations)
+{
+    auto& queries = GetSchemaQueries();
+    alignas(16) uint8_t entity[SCHEMA_BENCH_FIELDS * 8] = {};
+
+    for (uint64_t i = 0; i < iterations; i++)
+    {
+        void* ptr = GetSchemaFieldPtr(entity, queries[i % queries.size()].hash);
+        if (!ptr) continue;
+
+        int32_t value = *reinterpret_cast<int32_t*>(ptr);
+        DoNotOptimize(value);
+    }
+}
+
+BENCHMARK("schema/offset_by_name", SchemaOffsetByName);
+BENCHMARK("schema/offset_by_hash", SchemaOffsetByHash);
+BENCHMARK("schema/offset_miss", SchemaOffsetMiss);
+BENCHMARK("schema/prop_read", SchemaPropRead);
+
+enum class NetFieldType : uint8_t
+{
+    Int32,
+    Float,
+    Bool,
+    String,
+};
+
+struct NetFieldStub
+{
+    const char* name;
+    NetFieldType type;
+    uint32_t offset;
+};
+
+// shaped like CUserMessageSayText2 plus a few extra scalars
+struct NetMessageStub
+{
+    int32_t entityindex = 1;
+    bool chat = true;
+    std::string messagename = "Cstrike_Chat_All";
+    std::string param1 = "Sava";
+    std::string param2 = "gg";
+    std::string param3;
+    std::string param4;
+    float time = 12.5f;
+    int32_t team = 2;
+};
+
+template<typename T>
+static uint32_t NetFieldOffset(T NetMessageStub::* member)
+{
+    static const NetMessageStub msg;
+    return (uint32_t)(reinterpret_cast<const uint8_t*>(&(msg.*member)) - reinterpret_cast<const uint8_t*>(&msg));
+}
+
+#define NET_FIELD(name, type) { #name, NetFieldType::type, NetFieldOffset(&NetMessageStub::name) }
+
+static const NetFieldStub g_NetMessageFields[] = {
+    NET_FIELD(entityindex, Int32),
+    NET_FIELD(chat, Bool),
+    NET_FIELD(messagename, String),
+    NET_FIELD(param1, String),
+    NET_FIELD(param2, String),
+    NET_FIELD(param3, String),
+    NET_FIELD(param4, String),
+    NET_FIELD(time, Float),
+    NET_FIELD(team, Int32),
+};
+
+// stands in for FindFieldByName, a string keyed hash lookup in the descriptor tables
+static const NetFieldStub* FindNetFieldByName(const char* name)
+{
+    static const auto fields = []() {
+        std::unordered_map<std::string_view, const NetFieldStub*> fields;
+        for (auto& field : g_NetMessageFields)
+            fields.emplace(field.name, &field);
+        return fields;
+        }();
+
+    auto it = fields.find(std::string_view(name));
+    return it == fields.end() ? nullptr : it->second;
+}
+
+static const char* g_pNetFieldQueries[] = { "entityindex", "team", "chat", "time" };
+
+static void NetMessageGetByName(uint64_t iterations)
+{
+    NetMessageStub msg;
+    for (uint64_t i = 0; i < iterations; i++)
+    {
+        const NetFieldStub* field = FindNetFieldByName(g_pNetFieldQueries[i % std::size(g_pNetFieldQueries)]);
+        if (!field || field->type == NetFieldType::String) continue;
+
+        uint32_t value;
+        memcpy(&value, reinterpret_cast<uint8_t*>(&msg) + field->offset, sizeof(value));
+        DoNotOptimize(value);
+    }
+}
+
+static void NetMessageSetStringByName(uint64_t iterations)
+{
+    NetMessageStub msg;
+    for (uint64_t i = 0; i < iterations; i++)
+    {
+        const NetFieldStub* field = FindNetFieldByName("param2");
+        if (!field || field->type != NetFieldType::String) continue;
+
+        *reinterpret_cast<std::string*>(reinterpret_cast<uint8_t*>(&msg) + field->offset) = "well played";
+        DoNotOptimize(msg);
+    }
+}
+
+static void NetMessageMissByName(uint64_t iterations)
+{
+    for (uint64_t i = 0; i < iterations; i++)
+    {
+        const NetFieldStub* field = FindNetFieldByName("unknown_field");
+        DoNotOptimize(field);
+    }
+}
+
+BENCHMARK_MODEL("netmessage_model/get_by_name", NetMessageGetByName);
+BENCHMARK_MODEL("netmessage_model/set_string_by_name", NetMessageSetStringByName);
+BENCHMARK_MODEL("netmessage_model/miss_by_name", NetMessageMissByName);
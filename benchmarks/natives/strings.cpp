@@ -0,0 +1,186 @@
+/************************************************************************************************
+ * SwiftlyS2 is a scripting framework for Source2-based games.
+ * Copyright (C) 2023-2026 Swiftly Solution SRL via Sava Andrei-Sebastian and it's contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ ************************************************************************************************/
+
+// Text paths taken on every chat message, console line and command: color tags, command
+// tokenizing, string interning and resolving natives by name.
+
+#include "bench.h"
+
+#include <api/shared/string.h>
+#include <scripting/intern.h>
+#include <scripting/natives.h>
+
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+static const std::string g_sChatMessage = "[red][Swiftly][default] Player [lightblue]Sava[default] has been [green]slain[default] by [gold]Andrei[default] with an [orange]AK-47[default] (headshot)";
+static const std::string g_sHtmlMessage = "<font color='#ff0000'>[red]Round[default] <div>starts</div> in [green]5[default] seconds</font>";
+static const std::string g_sPlainMessage = "Server is running map de_dust2 with 10 players connected, next map is de_mirage";
+
+static void ProcessChatColors(uint64_t iterations)
+{
+    std::string out;
+    for (uint64_t i = 0; i < iterations; i++)
+    {
+        out.clear();
+        ProcessColorTags(g_sChatMessage, out, ColorMode::Chat, 2);
+        DoNotOptimize(out);
+    }
+}
+
+static void ProcessTerminalColors(uint64_t iterations)
+{
+    std::string out;
+    for (uint64_t i = 0; i < iterations; i++)
+    {
+        out.clear();
+        ProcessColorTags(g_sChatMessage, out, ColorMode::Terminal);
+        DoNotOptimize(out);
+    }
+}
+
+static void StripColorsAndHtml(uint64_t iterations)
+{
+    std::string out;
+    for (uint64_t i = 0; i < iterations; i++)
+    {
+        out.clear();
+        ProcessColorTags(g_sHtmlMessage, out, ColorMode::Strip, 0, true);
+        DoNotOptimize(out);
+    }
+}
+
+static void ProcessPlainText(uint64_t iterations)
+{
+    std::string out;
+    for (uint64_t i = 0; i < iterations; i++)
+    {
+        out.clear();
+        ProcessColorTags(g_sPlainMessage, out, ColorMode::Chat);
+        DoNotOptimize(out);
+    }
+}
+
+// allocating wrapper, what most callers still go through
+static void ProcessColorWrapper(uint64_t iterations)
+{
+    for (uint64_t i = 0; i < iterations; i++)
+    {
+        std::string out = ProcessColor(g_sChatMessage, 2);
+        DoNotOptimize(out);
+    }
+}
+
+BENCHMARK("color/chat", ProcessChatColors);
+BENCHMARK("color/terminal", ProcessTerminalColors);
+BENCHMARK("color/strip_html", StripColorsAndHtml);
+BENCHMARK("color/plain", ProcessPlainText);
+BENCHMARK("color/process_color", ProcessColorWrapper);
+
+static void TokenizeSimpleCommand(uint64_t iterations)
+{
+    for (uint64_t i = 0; i < iterations; i++)
+    {
+        auto tokens = TokenizeCommand("sw_kick 12 cheating");
+        DoNotOptimize(tokens);
+    }
+}
+
+static void TokenizeQuotedCommand(uint64_t iterations)
+{
+    for (uint64_t i = 0; i < iterations; i++)
+    {
+        auto tokens = TokenizeCommand("sw_ban \"Sava Andrei\" 1440 'spamming the chat with \"quotes\"' --notify");
+        DoNotOptimize(tokens);
+    }
+}
+
+BENCHMARK("command/tokenize_simple", TokenizeSimpleCommand);
+BENCHMARK("command/tokenize_quoted", TokenizeQuotedCommand);
+
+static const char* g_pEventKeys[] = { "userid", "attacker", "assister", "weapon", "headshot", "dmg_health", "dmg_armor", "hitgroup", "penetrated", "noscope" };
+
+static void InternExisting(uint64_t iterations)
+{
+    for (auto key : g_pEventKeys)
+        g_StringIntern.Intern(key);
+
+    for (uint64_t i = 0; i < iterations; i++)
+    {
+        uint32_t id = g_StringIntern.Intern(g_pEventKeys[i % std::size(g_pEventKeys)]);
+        DoNotOptimize(id);
+    }
+}
+
+static void ResolveInterned(uint64_t iterations)
+{
+    uint32_t ids[std::size(g_pEventKeys)];
+    for (size_t i = 0; i < std::size(g_pEventKeys); i++)
+        ids[i] = g_StringIntern.Intern(g_pEventKeys[i]);
+
+    for (uint64_t i = 0; i < iterations; i++)
+    {
+        const char* value = g_StringIntern.GetString(ids[i % std::size(ids)]);
+        DoNotOptimize(value);
+    }
+}
+
+BENCHMARK("intern/intern_existing", InternExisting);
+BENCHMARK("intern/resolve", ResolveInterned);
+
+// names are copied so NativeIdOf can't be folded at compile time
+static std::vector<std::string> CopyNativeNames()
+{
+    std::vector<std::string> names;
+    for (uint32_t i = 0; i < NATIVE_FUNCTION_COUNT; i += 7)
+        if (g_NativeNames[i]) names.push_back(g_NativeNames[i]);
+    return names;
+}
+
+static void NativeIdLookup(uint64_t iterations)
+{
+    static const auto names = CopyNativeNames();
+
+    for (uint64_t i = 0; i < iterations; i++)
+    {
+        uint32_t id = NativeIdOf(names[i % names.size()].c_str());
+        DoNotOptimize(id);
+    }
+}
+
+// plain string keyed map, for comparison
+static void NativeMapLookup(uint64_t iterations)
+{
+    static const auto names = CopyNativeNames();
+    static const auto map = []() {
+        std::unordered_map<std::string, uint32_t> map;
+        for (uint32_t i = 0; i < NATIVE_FUNCTION_COUNT; i++)
+            if (g_NativeNames[i]) map.emplace(g_NativeNames[i], i);
+        return map;
+        }();
+
+    for (uint64_t i = 0; i < iterations; i++)
+    {
+        auto it = map.find(names[i % names.size()]);
+        DoNotOptimize(it);
+    }
+}
+
+BENCHMARK("natives/id_lookup", NativeIdLookup);
+BENCHMARK("natives/map_lookup", NativeMapLookup);
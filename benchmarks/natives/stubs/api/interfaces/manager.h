@@ -0,0 +1,51 @@
+/************************************************************************************************
+ * SwiftlyS2 is a scripting framework for Source2-based games.
+ * Copyright (C) 2023-2026 Swiftly Solution SRL via Sava Andrei-Sebastian and it's contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ ************************************************************************************************/
+
+// Offline stand-in for the interface manager, the benchmarked sources only ever fetch the logger.
+// Picked up instead of src/api/interfaces/manager.h because the stubs directory comes first in the include path.
+
+#ifndef _api_interfaces_manager_h
+#define _api_interfaces_manager_h
+
+#include <api/monitor/logger/logger.h>
+
+#include <string>
+
+#define LOGGER_INTERFACE_VERSION "LoggerAPI"
+
+class InterfacesManager
+{
+public:
+    template<class T>
+    T* FetchInterface(const char* interface_name)
+    {
+        return (T*)GetPureInterface(interface_name);
+    }
+
+    template<class T>
+    T* FetchInterface(const std::string& interface_name)
+    {
+        return (T*)GetPureInterface(interface_name.c_str());
+    }
+
+    void* GetPureInterface(const char* interface_name);
+};
+
+extern InterfacesManager g_ifaceService;
+
+#endif
@@ -0,0 +1,62 @@
+/************************************************************************************************
+ * SwiftlyS2 is a scripting framework for Source2-based games.
+ * Copyright (C) 2023-2026 Swiftly Solution SRL via Sava Andrei-Sebastian and it's contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ ************************************************************************************************/
+
+#include <api/interfaces/manager.h>
+
+#include <cstring>
+
+// swallows everything, nothing that is benchmarked is supposed to log
+class NullLogger : public ILogger
+{
+public:
+    void Log(LogType type, const std::string& message) override {}
+    void Log(LogType type, const std::string& category, const std::string& message) override {}
+
+    void Trace(const std::string& message) override {}
+    void Debug(const std::string& message) override {}
+    void Info(const std::string& message) override {}
+    void Warning(const std::string& message) override {}
+    void Error(const std::string& message) override {}
+    void Critical(const std::string& message) override {}
+
+    void Trace(const std::string& category, const std::string& message) override {}
+    void Debug(const std::string& category, const std::string& message) override {}
+    void Info(const std::string& category, const std::string& message) override {}
+    void Warning(const std::string& category, const std::string& message) override {}
+    void Error(const std::string& category, const std::string& message) override {}
+    void Critical(const std::string& category, const std::string& message) override {}
+
+    void SetLogFile(LogType type, const std::string& path) override {}
+    void ShouldOutputToFile(LogType type, bool enabled) override {}
+
+    void ShouldColorCategoryInConsole(const std::string& category, bool enabled) override {}
+    void ShouldOutputToConsole(LogType type, bool enabled) override {}
+
+    void SetFileRotation(uint64_t max_size, bool daily) override {}
+    void Shutdown() override {}
+};
+
+static NullLogger g_NullLogger;
+
+InterfacesManager g_ifaceService;
+
+void* InterfacesManager::GetPureInterface(const char* interface_name)
+{
+    if (strcmp(interface_name, LOGGER_INTERFACE_VERSION) == 0) return &g_NullLogger;
+    return nullptr;
+}
@@ -0,0 +1,209 @@
+# Compiles the core gamedata (plugin_files/gamedata/<game>) into a binary bundle and
+# generates the id header the core uses to fetch offsets and signatures without names.
+#
+# usage: python3 generate.py [bundle output directory] [game]
+#
+# Without an output directory only src/api/memory/gamedata/ids.h is regenerated, the build does
+# that before compiling. With one only the bundle is written, and it fails if ids.h is out of date
+# since the bundle's ids have to match the ones the core was compiled with.
+# The bundle is tied to the exact jsonc it was built from (FNV-1a over every source file),
+# the core falls back to parsing the jsonc once it doesn't match anymore.
+
+import json
+import re
+import struct
+import sys
+from pathlib import Path
+
+ROOT = Path(__file__).parent
+REPO = ROOT.parent.parent
+OUT_HEADER = REPO / "src" / "api" / "memory" / "gamedata" / "ids.h"
+
+BUNDLE_MAGIC = b"SWGD"
+BUNDLE_VERSION = 1
+SOURCE_SUFFIXES = ("offsets.jsonc", "signatures.jsonc", "patches.jsonc")
+
+FNV_OFFSET = 0xcbf29ce484222325
+FNV_PRIME = 0x100000001b3
+
+
+def fnv1a(data: bytes, value: int = FNV_OFFSET) -> int:
+  for byte in data:
+    value = ((value ^ byte) * FNV_PRIME) & 0xFFFFFFFFFFFFFFFF
+  return value
+
+
+def strip_comments(text: str) -> str:
+  result = []
+  i = 0
+  in_string = escaped = False
+  while i < len(text):
+    c = text[i]
+    n = text[i + 1] if i + 1 < len(text) else ""
+    if in_string:
+      result.append(c)
+      if escaped:
+        escaped = False
+      elif c == "\\":
+        escaped = True
+      elif c == '"':
+        in_string = False
+      i += 1
+    elif c == '"':
+      in_string = True
+      result.append(c)
+      i += 1
+    elif c == "/" and n == "/":
+      while i < len(text) and text[i] not in "\r\n":
+        i += 1
+    elif c == "/" and n == "*":
+      end = text.find("*/", i + 2)
+      i = len(text) if end == -1 else end + 2
+    else:
+      result.append(c)
+      i += 1
+  return "".join(result)
+
+
+def identifier(name: str) -> str:
+  ident = re.sub(r"[^0-9A-Za-z]+", "_", name).strip("_")
+  return "_" + ident if ident[:1].isdigit() else ident
+
+
+def read_sources(gamedata: Path):
+  files = sorted((p for p in gamedata.rglob("*") if p.is_file() and p.name.endswith(SOURCE_SUFFIXES)),
+                 key=lambda p: p.relative_to(gamedata).as_posix())
+
+  source_hash = FNV_OFFSET
+  for path in files:
+    source_hash = fnv1a(path.relative_to(gamedata).as_posix().encode() + b"\0", source_hash)
+    source_hash = fnv1a(path.read_bytes() + b"\0", source_hash)
+
+  tables = {suffix: {} for suffix in SOURCE_SUFFIXES}
+  for path in files:
+    suffix = next(s for s in SOURCE_SUFFIXES if path.name.endswith(s))
+    content = json.loads(strip_comments(path.read_text(encoding="utf-8")))
+    for key, value in content.items():
+      if key in tables[suffix]:
+        print(f"warning: '{key}' from {path} is already defined, skipping")
+        continue
+      tables[suffix][key] = value
+
+  return source_hash, tables
+
+
+def validate(tables):
+  offsets, signatures, patches = {}, {}, {}
+
+  for key, value in tables["offsets.jsonc"].items():
+    if not all(isinstance(value.get(os_), int) for os_ in ("windows", "linux")):
+      raise ValueError(f"offset '{key}' needs integer 'windows' and 'linux' fields")
+    offsets[key] = value
+
+  for key, value in tables["signatures.jsonc"].items():
+    if not all(isinstance(value.get(field), str) for field in ("lib", "windows", "linux")):
+      raise ValueError(f"signature '{key}' needs string 'lib', 'windows' and 'linux' fields")
+    signatures[key] = value
+
+  for key, value in tables["patches.jsonc"].items():
+    if not all(isinstance(value.get(field), str) for field in ("signature", "windows", "linux")):
+      raise ValueError(f"patch '{key}' needs string 'signature', 'windows' and 'linux' fields")
+    patches[key] = value
+
+  return offsets, signatures, patches
+
+
+def write_bundle(path: Path, source_hash: int, offsets, signatures, patches):
+  strings = bytearray()
+  refs = {}
+
+  def ref(value: str) -> int:
+    if value not in refs:
+      refs[value] = len(strings)
+      strings.extend(value.encode("utf-8") + b"\0")
+    return refs[value]
+
+  entries = bytearray()
+  for key, value in offsets.items():
+    entries += struct.pack("<Iii", ref(key), value["windows"], value["linux"])
+  for key, value in signatures.items():
+    entries += struct.pack("<IIII", ref(key), ref(value["lib"]), ref(value["windows"]), ref(value["linux"]))
+  for key, value in patches.items():
+    entries += struct.pack("<IIII", ref(key), ref(value["signature"]), ref(value["windows"]), ref(value["linux"]))
+
+  header_size = 40
+  header = struct.pack("<4sIQIIIIII", BUNDLE_MAGIC, BUNDLE_VERSION, source_hash,
+                       len(offsets), len(signatures), len(patches),
+                       header_size + len(entries), len(strings), 0)
+
+  path.parent.mkdir(parents=True, exist_ok=True)
+  path.write_bytes(header + entries + strings)
+
+
+def render_header(offsets, signatures):
+  license_header = (REPO / "src" / "api" / "memory" / "gamedata" / "manager.h").read_text(encoding="utf-8").split("\n\n")[0]
+
+  def table(enum: str, names):
+    idents = {}
+    for name in names:
+      ident = identifier(name)
+      if ident in idents:
+        raise ValueError(f"'{name}' and '{idents[ident]}' generate the same id {ident}")
+      idents[ident] = name
+
+    lines = [f"enum class {enum} : uint32_t", "{"]
+    lines += [f"    {ident}," for ident in idents]
+    lines += ["", "    Count", "};", ""]
+    lines += [f"inline constexpr const char* g_{enum}Names[] = {{"]
+    lines += [f"    \"{name}\"," for name in idents.values()]
+    lines += ["};", ""]
+    return lines
+
+  lines = [license_header, "",
+           "// Generated by generator/gamedata_generator/generate.py from plugin_files/gamedata, do not edit.", "",
+           "#ifndef src_api_memory_gamedata_ids_h",
+           "#define src_api_memory_gamedata_ids_h", "",
+           "#include <cstdint>", ""]
+  lines += table("GameDataOffset", sorted(offsets))
+  lines += table("GameDataSignature", sorted(signatures))
+  lines += ["#endif", ""]
+
+  return "\n".join(lines)
+
+
+def header_is_current(content: str) -> bool:
+  return OUT_HEADER.exists() and OUT_HEADER.read_text(encoding="utf-8") == content
+
+
+def write_header(content: str) -> bool:
+  if header_is_current(content):
+    return False
+
+  with open(OUT_HEADER, "w", encoding="utf-8", newline="\n") as f:
+    f.write(content)
+  return True
+
+
+def main():
+  game = sys.argv[2] if len(sys.argv) > 2 else "cs2"
+  gamedata = REPO / "plugin_files" / "gamedata" / game
+
+  source_hash, tables = read_sources(gamedata)
+  offsets, signatures, patches = validate(tables)
+
+  header = render_header(offsets, signatures)
+
+  if len(sys.argv) == 1:
+    if write_header(header):
+      print(f"Generated {OUT_HEADER.relative_to(REPO)} ({len(offsets)} offsets, {len(signatures)} signatures)")
+  else:
+    if not header_is_current(header):
+      sys.exit(f"{OUT_HEADER.relative_to(REPO)} is out of date, run generate.py without arguments and rebuild")
+
+    bundle = Path(sys.argv[1]) / "gamedata.bin"
+    write_bundle(bundle, source_hash, offsets, signatures, patches)
+    print(f"Compiled {bundle} ({source_hash:016x})")
+
+
+if __name__ == "__main__":
+  main()
@@ -78,10 +78,12 @@ def split_by_last_dot(value: str):
         return "", value
     return value[:idx], value[idx + 1:]
 
+RETURN_STACK_SIZE = 256
+
 def is_buffer_return(return_type: str) -> bool:
     return return_type in ("string", "bytes")
 
-def parse_native(lines: list[str]):
+def parse_native(lines: list[str], native_ids: dict[str, int]):
     namespace_line, *native_lines = lines
     namespace_content = namespace_line.split(" ")[1].strip()
     namespace_prefix, class_name = split_by_last_dot(namespace_content)
@@ -103,7 +105,9 @@ def parse_native(lines: list[str]):
     writer.add_line()
 
     def write_class_content():
-        
+        bind_index = len(writer.lines)
+        bind_lines = []
+
         for raw_line in native_lines:
             if raw_line.strip() == "":
                 continue
@@ -137,7 +141,7 @@ def parse_native(lines: list[str]):
                 param_signatures.append((PARAM_TYPE_MAP[t], n))
 
             if is_buffer_return(return_type):
-                native_param_types_with_buffer = ["byte*"] + native_param_types
+                native_param_types_with_buffer = ["byte*", "int"] + native_param_types
             else:
                 native_param_types_with_buffer = native_param_types
             
@@ -145,6 +149,7 @@ def parse_native(lines: list[str]):
             writer.add_line()
             writer.add_line(f"private unsafe static delegate* unmanaged<{delegate_generic}> _{function_name};")
             writer.add_line()
+            bind_lines.append(f"_{function_name} = (delegate* unmanaged<{delegate_generic}>)NativeTable.Get({native_ids[f'{class_name}.{function_name}']});")
 
             if comment and comment.strip():
                 writer.add_line("/// <summary>")
@@ -185,52 +190,56 @@ def parse_native(lines: list[str]):
                     call_args = []
                     
                     if is_buffer_return(return_type):
-                        first_call_args = ["null"]
-                        for t, n in param_signatures:
-                            if t == "string":
-                                first_call_args.append(f"{n}BufferPtr")
-                            elif t == "byte[]":
-                                first_call_args.extend([f"{n}BufferPtr", f"{n}Length"])
-                            elif t == "bool":
-                                first_call_args.append(f"{n} ? (byte)1 : (byte)0")
-                            else:
-                                first_call_args.append(n)
-                        
-                        writer.add_line(f"var ret = _{function_name}({', '.join(first_call_args)});")
-
-                        if not pool_declared:
-                            writer.add_line("var pool = ArrayPool<byte>.Shared;")
-                        writer.add_line("var retBuffer = pool.Rent(ret + 1);")
-                        
-                        def write_ret_fixed():
-                            second_call_args = ["retBufferPtr"]
+                        def buffer_call_args(buffer_ptr: str, buffer_size: str):
+                            args = [buffer_ptr, buffer_size]
                             for t, n in param_signatures:
                                 if t == "string":
-                                    second_call_args.append(f"{n}BufferPtr")
+                                    args.append(f"{n}BufferPtr")
                                 elif t == "byte[]":
-                                    second_call_args.extend([f"{n}BufferPtr", f"{n}Length"])
+                                    args.extend([f"{n}BufferPtr", f"{n}Length"])
                                 elif t == "bool":
-                                    second_call_args.append(f"{n} ? (byte)1 : (byte)0")
+                                    args.append(f"{n} ? (byte)1 : (byte)0")
                                 else:
-                                    second_call_args.append(n)
-                            
-                            writer.add_line(f"ret = _{function_name}({', '.join(second_call_args)});")
-                            
+                                    args.append(n)
+                            return ", ".join(args)
+
+                        def write_return(buffer_ptr: str, extra_returns: list[str]):
                             if return_type == "string":
-                                writer.add_line("var retString = Encoding.UTF8.GetString(retBufferPtr, ret);")
-                                writer.add_line("pool.Return(retBuffer);")
-                                for param in string_params:
-                                    writer.add_line(f"pool.Return({param}Buffer);")
-                                writer.add_line("return retString;")
+                                writer.add_line(f"var retString = Encoding.UTF8.GetString({buffer_ptr}, ret);")
+                                result = "retString"
                             else:
-                                writer.add_line("var retBytes = new byte[ret];")
-                                writer.add_line("for (int i = 0; i < ret; i++) retBytes[i] = retBufferPtr[i];")
-                                writer.add_line("pool.Return(retBuffer);")
-                                for param in string_params:
-                                    writer.add_line(f"pool.Return({param}Buffer);")
-                                writer.add_line("return retBytes;")
-                        
-                        writer.add_block("fixed (byte* retBufferPtr = retBuffer)", write_ret_fixed)
+                                writer.add_line(f"var retBytes = new ReadOnlySpan<byte>({buffer_ptr}, ret).ToArray();")
+                                result = "retBytes"
+                            for buffer in extra_returns:
+                                writer.add_line(f"pool.Return({buffer});")
+                            for param in string_params:
+                                writer.add_line(f"pool.Return({param}Buffer);")
+                            writer.add_line(f"return {result};")
+
+                        # most values fit on the stack and take a single call, larger ones get the full size back
+                        # and are fetched again into a pooled buffer. the value can grow between the calls
+                        # (reports, lists), so the fetch repeats until one call fits completely
+                        writer.add_line(f"byte* retStackPtr = stackalloc byte[{RETURN_STACK_SIZE}];")
+                        writer.add_line(f"var ret = _{function_name}({buffer_call_args('retStackPtr', str(RETURN_STACK_SIZE))});")
+                        writer.add_block(f"if (ret <= {RETURN_STACK_SIZE})", lambda: write_return("retStackPtr", []))
+
+                        if not pool_declared:
+                            writer.add_line("var pool = ArrayPool<byte>.Shared;")
+
+                        def write_ret_fixed():
+                            writer.add_line(f"var retSize = _{function_name}({buffer_call_args('retBufferPtr', 'retBuffer.Length')});")
+                            def write_fits():
+                                writer.add_line("ret = retSize;")
+                                write_return("retBufferPtr", ["retBuffer"])
+                            writer.add_block("if (retSize <= retBuffer.Length)", write_fits)
+                            writer.add_line("ret = retSize;")
+
+                        def write_ret_loop():
+                            writer.add_line("var retBuffer = pool.Rent(ret);")
+                            writer.add_block("fixed (byte* retBufferPtr = retBuffer)", write_ret_fixed)
+                            writer.add_line("pool.Return(retBuffer);")
+
+                        writer.add_block("while (true)", write_ret_loop)
                     
                     else:
                         for t, n in param_signatures:
@@ -266,18 +275,203 @@ def parse_native(lines: list[str]):
                     write_native_call()
             
             writer.add_block(f"public unsafe static {RETURN_TYPE_MAP[return_type]} {function_name}({method_signature})", write_method_content)
+
+        # bound by index on the first call into the class
+        ctor = CodeWriter()
+        ctor.indent_level = writer.indent_level
+        ctor.add_line()
+        ctor.add_block(f"unsafe static Native{class_name}()", lambda: [ctor.add_line(line) for line in bind_lines])
+        writer.lines[bind_index:bind_index] = ctor.lines
+
     writer.add_block(f"internal static class Native{class_name}", write_class_content)
 
     with open(out_path, "w", encoding="utf-8", newline="") as f:
         f.write(writer.get_code())
 
+FNV32_OFFSET = 0x811c9dc5
+FNV32_PRIME = 0x1000193
+
+
+def fnv1a_32(value: str, seed: int = FNV32_OFFSET) -> int:
+    for byte in value.encode("utf-8"):
+        seed = ((seed ^ byte) * FNV32_PRIME) & 0xFFFFFFFF
+    return seed
+
+def collect_native_names(files: list[list[str]]) -> list[str]:
+    names = []
+    for lines in files:
+        namespace_line, *native_lines = lines
+        _, class_name = split_by_last_dot(namespace_line.split(" ")[1].strip())
+        for raw_line in native_lines:
+            if raw_line.strip() == "":
+                continue
+            left = raw_line.split("=", 1)[0].replace("sync ", "")
+            names.append(f"{class_name}.{left.split(' ', 1)[1].strip()}")
+
+    duplicates = {name for name in names if names.count(name) > 1}
+    if duplicates:
+        raise ValueError(f"natives declared more than once: {', '.join(sorted(duplicates))}")
+
+    return sorted(names)
+
+NATIVE_IDS_PATH = Path("../../natives/native_ids.txt")
+NATIVE_IDS_HEADER = """# Native ids, generated by generator/native_generator and checked in. The n-th name below is
+# native id n. New natives are appended, lines are never reordered or removed: a native that
+# goes away stays here as "- Name" so its id is never handed out again.
+"""
+
+def assign_native_ids(names: list[str]) -> list:
+    # id -> name, None for retired ids
+    ids = []
+    if NATIVE_IDS_PATH.exists():
+        for line in NATIVE_IDS_PATH.read_text(encoding="utf-8").splitlines():
+            line = line.strip()
+            if line == "" or line.startswith("#"):
+                continue
+            ids.append(line[1:].strip() if line.startswith("-") else line)
+
+    declared = set(names)
+    known = set(ids)
+    ids += [name for name in names if name not in known]
+
+    lines = [NATIVE_IDS_HEADER.rstrip("\n")]
+    lines += [name if name in declared else f"- {name}" for name in ids]
+    write_if_changed(NATIVE_IDS_PATH, "\n".join(lines) + "\n")
+
+    return [name if name in declared else None for name in ids]
+
+def native_names_hash(ids: list) -> int:
+    # FNV-1a 64 over every id's name (empty when retired), each followed by a NUL
+    value = 0xcbf29ce484222325
+    for name in ids:
+        for byte in (name or "").encode("utf-8") + b"\0":
+            value = ((value ^ byte) * 0x100000001b3) & 0xFFFFFFFFFFFFFFFF
+    return value
+
+def build_perfect_hash(names: list):
+    # hash and displace: every bucket gets the first seed that moves all of its names into free slots,
+    # keyed on the names, the slots hold the ids; retired ids (None) aren't in the table
+    live = [index for index, name in enumerate(names) if name is not None]
+    slot_count = max(1, len(live) + len(live) // 4)
+    bucket_count = max(1, (len(live) + 3) // 4)
+
+    buckets = [[] for _ in range(bucket_count)]
+    for index in live:
+        buckets[fnv1a_32(names[index]) % bucket_count].append(index)
+
+    seeds = [0] * bucket_count
+    slots = [-1] * slot_count
+    for bucket in sorted(range(bucket_count), key=lambda b: -len(buckets[b])):
+        if not buckets[bucket]:
+            continue
+
+        for seed in range(1, 1 << 24):
+            positions = [fnv1a_32(names[index], seed) % slot_count for index in buckets[bucket]]
+            if len(set(positions)) == len(positions) and all(slots[position] == -1 for position in positions):
+                break
+        else:
+            raise ValueError("couldn't build the native hash table")
+
+        seeds[bucket] = seed
+        for index, position in zip(buckets[bucket], positions):
+            slots[position] = index
+
+    return seeds, slots
+
+def write_if_changed(path: Path, content: str):
+    if path.exists() and path.read_text(encoding="utf-8") == content:
+        return
+    with open(path, "w", encoding="utf-8", newline="\n") as f:
+        f.write(content)
+
+def write_native_header(names: list):
+    seeds, slots = build_perfect_hash(names)
+    license_header = Path("../../src/scripting/scripting.h").read_text(encoding="utf-8").split("\n\n")[0]
+
+    def rows(values, per_row):
+        return [f"    {', '.join(str(v) for v in values[i:i + per_row])}," for i in range(0, len(values), per_row)]
+
+    lines = [license_header, "",
+             "// Generated by generator/native_generator from natives/, do not edit.", "",
+             "#ifndef src_scripting_natives_h",
+             "#define src_scripting_natives_h", "",
+             "#include <api/shared/hash.h>", "",
+             "#include <cstdint>", "",
+             f"#define NATIVE_FUNCTION_COUNT {len(names)}",
+             f"#define NATIVE_HASH_BUCKETS {len(seeds)}",
+             f"#define NATIVE_HASH_SLOTS {len(slots)}", "",
+             "// hash of g_NativeNames in id order, the managed side checks it against the one it was generated with",
+             f"#define NATIVE_NAMES_HASH 0x{native_names_hash(names):016x}ull", "",
+             "// indexed by native id, ids come from natives/native_ids.txt and never change; retired ids are null",
+             "inline constexpr const char* g_NativeNames[NATIVE_FUNCTION_COUNT] = {"]
+    lines += [f"    \"{name}\"," if name is not None else "    nullptr," for name in names]
+    lines += ["};", "",
+              "inline constexpr uint32_t g_NativeHashSeeds[NATIVE_HASH_BUCKETS] = {"]
+    lines += rows(seeds, 16)
+    lines += ["};", "",
+              "inline constexpr int16_t g_NativeHashSlots[NATIVE_HASH_SLOTS] = {"]
+    lines += rows(slots, 16)
+    lines += ["};", "",
+              "constexpr bool NativeNameEquals(const char* a, const char* b)",
+              "{",
+              "    while (*a && *a == *b)",
+              "    {",
+              "        a++;",
+              "        b++;",
+              "    }",
+              "    return *a == *b;",
+              "}", "",
+              "// NATIVE_FUNCTION_COUNT for names that aren't declared in natives/",
+              "constexpr uint32_t NativeIdOf(const char* name)",
+              "{",
+              "    uint32_t seed = g_NativeHashSeeds[hash_32_fnv1a_const(name) % NATIVE_HASH_BUCKETS];",
+              "    int16_t id = g_NativeHashSlots[hash_32_fnv1a_const(name, seed) % NATIVE_HASH_SLOTS];",
+              "    if (id < 0 || !NativeNameEquals(g_NativeNames[id], name)) return NATIVE_FUNCTION_COUNT;",
+              "",
+              "    return static_cast<uint32_t>(id);",
+              "}", "",
+              "#endif", ""]
+
+    write_if_changed(Path("../../src/scripting/natives.h"), "\n".join(lines))
+
+def write_native_table(names: list):
+    writer = CodeWriter()
+    writer.add_line("namespace SwiftlyS2.Core.Natives;")
+    writer.add_line()
+
+    def write_class_content():
+        writer.add_line(f"public const int Count = {len(names)};")
+        writer.add_line(f"public const ulong NamesHash = 0x{native_names_hash(names):016x}UL;")
+        writer.add_line()
+        writer.add_line("private static NativeFunction* _table;")
+        writer.add_line()
+        writer.add_block("public static void Bind(NativeFunction* table)", lambda: writer.add_line("_table = table;"))
+        writer.add_line()
+        writer.add_block("public static void* Get(int id)", lambda: writer.add_line("return (void*)_table[id].Function;"))
+
+    writer.add_block("internal static unsafe class NativeTable", write_class_content)
+
+    with open(Path("../../managed/src/SwiftlyS2.Generated/Natives/NativeTable.cs"), "w", encoding="utf-8", newline="") as f:
+        f.write(writer.get_code())
+
 def main():
     out_dir = Path("../../managed/src/SwiftlyS2.Generated/Natives/")
     out_dir.mkdir(parents=True, exist_ok=True)
     definitions_dir = Path("../../natives")
+
+    files = []
     for file_path in definitions_dir.rglob("*.native"):
         with open(file_path, "r", encoding="utf-8") as f:
-            parse_native(f.readlines())
+            files.append(f.readlines())
+
+    names = assign_native_ids(collect_native_names(files))
+    native_ids = {name: index for index, name in enumerate(names) if name is not None}
+
+    write_native_header(names)
+    write_native_table(names)
+
+    for lines in files:
+        parse_native(lines, native_ids)
 
 if __name__ == "__main__":
     main()
\ No newline at end of file
@@ -38,7 +38,7 @@ internal static class Bootstrap
         return IntPtr.Zero;
     }
 
-    public static void Start( IntPtr nativeTable, int nativeTableSize, string basePath, string logPath)
+    public static void Start( IntPtr nativeTable, int nativeTableSize, ulong nativeNamesHash, string basePath, string logPath)
     {
         
         AppDomain.CurrentDomain.UnhandledException += ( sender, e ) =>
@@ -56,7 +56,7 @@ internal static class Bootstrap
 
         Environment.SetEnvironmentVariable("SWIFTLY_MANAGED_ROOT", basePath);
         Environment.SetEnvironmentVariable("SWIFTLY_MANAGED_LOG", logPath);
-        NativeBinding.BindNatives(nativeTable, nativeTableSize);
+        NativeBinding.BindNatives(nativeTable, nativeTableSize, nativeNamesHash);
         NativeLibrary.SetDllImportResolver(typeof(NativeMethods).Assembly, SteamAPIDLLResolver);
 
         EventPublisher.Register();
@@ -15,6 +15,7 @@ internal delegate void ConVarCallbackDelegate( int playerId, nint name, nint val
 internal class ConVar : IConVar
 {
     private Dictionary<int, ConVarCallbackDelegate> _callbacks = new();
+    private int _nextCallbackId = 0;
     private Lock _lock = new();
     protected nint _minValuePtrPtr => NativeConvars.GetMinValuePtrPtr(Name);
     protected nint _maxValuePtrPtr => NativeConvars.GetMaxValuePtrPtr(Name);
@@ -125,38 +126,29 @@ internal class ConVar : IConVar
 
     public void QueryClient( int clientId, Action<string> callback )
     {
-        Action? removeSelf = null;
+        var listenerId = Interlocked.Increment(ref _nextCallbackId);
         ConVarCallbackDelegate nativeCallback = ( playerId, namePtr, valuePtr ) =>
         {
-            if (clientId != playerId) return;
-            var name = Marshal.PtrToStringAnsi(namePtr);
-            if (name != Name) return;
-            var value = Marshal.PtrToStringAnsi(valuePtr)!;
+            lock (_lock)
+            {
+                _callbacks.Remove(listenerId);
+            }
 
-            // var convertedValue = (T)Convert.ChangeType(value, typeof(T))!;
+            // no value: the player left before answering, the query is dropped
+            if (valuePtr == 0) return;
+
+            var value = Marshal.PtrToStringAnsi(valuePtr)!;
             callback(value);
-            if (removeSelf != null) removeSelf();
         };
 
-
-        var callbackPtr = Marshal.GetFunctionPointerForDelegate(nativeCallback);
-
-        var listenerId = NativeConvars.AddQueryClientCvarCallback(callbackPtr);
         lock (_lock)
         {
             _callbacks[listenerId] = nativeCallback;
         }
 
-        removeSelf = () =>
-        {
-            lock (_lock)
-            {
-                _callbacks.Remove(listenerId);
-                NativeConvars.RemoveQueryClientCvarCallback(listenerId);
-            }
-        };
+        var callbackPtr = Marshal.GetFunctionPointerForDelegate(nativeCallback);
 
-        SchedulerManager.QueueOrNow(() => NativeConvars.QueryClientConvar(clientId, Name));
+        SchedulerManager.QueueOrNow(() => NativeConvars.QueryClientConvarWithCallback(clientId, Name, callbackPtr));
     }
 
     public void ReplicateToClientAsString( int clientId, string value )
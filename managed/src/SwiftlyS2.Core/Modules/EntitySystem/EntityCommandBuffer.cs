@@ -0,0 +1,212 @@
+using System.Runtime.CompilerServices;
+using System.Runtime.InteropServices;
+using SwiftlyS2.Core.Natives;
+using SwiftlyS2.Core.Schemas;
+using SwiftlyS2.Shared.Natives;
+using SwiftlyS2.Shared.EntitySystem;
+using SwiftlyS2.Shared.SchemaDefinitions;
+
+namespace SwiftlyS2.Core.EntitySystem;
+
+// The layout has to match src/scripting/engine/commandbuffer.cpp: every op is a header followed by its
+// payload, padded to 8 bytes. Entities are recorded as handles and resolved natively when the buffer runs.
+internal class EntityCommandBuffer : IEntityCommandBuffer
+{
+    private enum OpType : uint
+    {
+        StateChanged = 1,
+        WriteProp,
+        Teleport,
+        AcceptInput,
+    }
+
+    [StructLayout(LayoutKind.Sequential)]
+    private struct OpHeader
+    {
+        public uint Type;
+        public uint Size;
+    }
+
+    [StructLayout(LayoutKind.Sequential)]
+    private struct StateChangedOp
+    {
+        public uint Entity;
+        public uint Padding;
+        public ulong Hash;
+    }
+
+    [StructLayout(LayoutKind.Sequential)]
+    private struct WritePropOp
+    {
+        public uint Entity;
+        public uint ValueSize;
+        public ulong Hash;
+    }
+
+    [StructLayout(LayoutKind.Sequential)]
+    private struct TeleportOp
+    {
+        public uint Entity;
+        public uint Flags;
+        public Vector Position;
+        public QAngle Angle;
+        public Vector Velocity;
+    }
+
+    [StructLayout(LayoutKind.Sequential)]
+    private struct AcceptInputOp
+    {
+        public uint Entity;
+        public uint Activator;
+        public uint Caller;
+        public uint InputId;
+        public int OutputId;
+        public uint Padding;
+    }
+
+    private const uint NoHandle = uint.MaxValue;
+
+    private const uint TeleportPosition = 1 << 0;
+    private const uint TeleportAngle = 1 << 1;
+    private const uint TeleportVelocity = 1 << 2;
+
+    private byte[] buffer = new byte[1024];
+    private int length;
+    private int count;
+    private int[] results = [];
+    private bool[] succeeded = [];
+
+    public int Count => count;
+
+    public void SetStateChanged( CEntityInstance entity, string className, string fieldName )
+    {
+        var hash = Schema.GetFieldHash(className, fieldName);
+        Schema.ThrowIfDangerous(hash);
+
+        var op = new StateChangedOp { Entity = GetHandle(entity), Hash = hash };
+        MemoryMarshal.Write(Reserve(OpType.StateChanged, Unsafe.SizeOf<StateChangedOp>()), in op);
+    }
+
+    public void Write<T>( CEntityInstance entity, string className, string fieldName, T value ) where T : unmanaged
+    {
+        var hash = Schema.GetFieldHash(className, fieldName);
+        Schema.ThrowIfDangerous(hash);
+
+        var op = new WritePropOp { Entity = GetHandle(entity), Hash = hash, ValueSize = (uint)Unsafe.SizeOf<T>() };
+        var payload = Reserve(OpType.WriteProp, Unsafe.SizeOf<WritePropOp>() + Unsafe.SizeOf<T>());
+        MemoryMarshal.Write(payload, in op);
+        MemoryMarshal.Write(payload[Unsafe.SizeOf<WritePropOp>()..], in value);
+    }
+
+    public void Teleport( CBaseEntity entity, Vector? position, QAngle? angle, Vector? velocity )
+    {
+        var op = new TeleportOp { Entity = GetHandle(entity) };
+
+        if (position.HasValue)
+        {
+            op.Position = position.Value;
+            op.Flags |= TeleportPosition;
+        }
+
+        if (angle.HasValue)
+        {
+            op.Angle = angle.Value;
+            op.Flags |= TeleportAngle;
+        }
+
+        if (velocity.HasValue)
+        {
+            op.Velocity = velocity.Value;
+            op.Flags |= TeleportVelocity;
+        }
+
+        MemoryMarshal.Write(Reserve(OpType.Teleport, Unsafe.SizeOf<TeleportOp>()), in op);
+    }
+
+    public void AcceptInput<T>( CEntityInstance entity, string input, T? value, CEntityInstance? activator = null, CEntityInstance? caller = null, int outputID = 0 )
+    {
+        var variant = new CVariant<CVariantDefaultAllocator>(value);
+        var op = new AcceptInputOp {
+            Entity = GetHandle(entity),
+            Activator = activator is null ? NoHandle : GetHandle(activator),
+            Caller = caller is null ? NoHandle : GetHandle(caller),
+            InputId = InternedStrings.Get(input),
+            OutputId = outputID,
+        };
+
+        // the variant is read in place by the native side
+        var payload = Reserve(OpType.AcceptInput, Unsafe.SizeOf<AcceptInputOp>() + Unsafe.SizeOf<CVariant<CVariantDefaultAllocator>>());
+        MemoryMarshal.Write(payload, in op);
+        MemoryMarshal.Write(payload[Unsafe.SizeOf<AcceptInputOp>()..], in variant);
+    }
+
+    public unsafe ReadOnlySpan<bool> Execute()
+    {
+        NativeBinding.ThrowIfNonMainThread();
+
+        var total = count;
+        if (total == 0) return ReadOnlySpan<bool>.Empty;
+
+        if (results.Length < total)
+        {
+            results = new int[Math.Max(total, results.Length * 2)];
+            succeeded = new bool[results.Length];
+        }
+
+        int executed;
+        fixed (byte* bufferPtr = buffer)
+        fixed (int* resultsPtr = results)
+        {
+            executed = NativeCommandBuffer.Execute((nint)bufferPtr, length, (nint)resultsPtr, results.Length);
+        }
+
+        Clear();
+
+        if (executed != total)
+        {
+            throw new InvalidOperationException($"Only {executed} of {total} command buffer operations were executed, the buffer was malformed.");
+        }
+
+        for (int i = 0; i < total; i++) succeeded[i] = results[i] != 0;
+        return succeeded.AsSpan(0, total);
+    }
+
+    public void Clear()
+    {
+        length = 0;
+        count = 0;
+    }
+
+    public void Dispose()
+    {
+        Clear();
+        buffer = [];
+        results = [];
+        succeeded = [];
+    }
+
+    private Span<byte> Reserve( OpType type, int payloadSize )
+    {
+        var size = (Unsafe.SizeOf<OpHeader>() + payloadSize + 7) & ~7;
+        if (length + size > buffer.Length)
+        {
+            Array.Resize(ref buffer, Math.Max(buffer.Length * 2, length + size));
+        }
+
+        var op = buffer.AsSpan(length, size);
+        op.Clear();
+
+        var header = new OpHeader { Type = (uint)type, Size = (uint)size };
+        MemoryMarshal.Write(op, in header);
+
+        length += size;
+        count++;
+        return op[Unsafe.SizeOf<OpHeader>()..];
+    }
+
+    // an entity without identity gets a handle that never resolves, so ops targeting it are skipped
+    private static uint GetHandle( CEntityInstance entity )
+    {
+        return entity.Entity?.EntityHandle.Raw ?? NoHandle;
+    }
+}
@@ -0,0 +1,98 @@
+using System.Runtime.InteropServices;
+using Microsoft.Extensions.Logging;
+using SwiftlyS2.Shared.Misc;
+using SwiftlyS2.Core.Events;
+using SwiftlyS2.Core.Natives;
+using SwiftlyS2.Shared.Natives;
+using SwiftlyS2.Shared.Profiler;
+using SwiftlyS2.Shared.EntitySystem;
+using SwiftlyS2.Core.SchemaDefinitions;
+using SwiftlyS2.Shared.SchemaDefinitions;
+
+namespace SwiftlyS2.Core.EntitySystem;
+
+[UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+internal delegate int EntityOutputFilteredHookCallbackDelegate( nint entityio, nint outputName, nint activator, nint caller, nint variant, float delay );
+
+/// <summary>
+/// Output hook whose caller/activator filters are evaluated natively inside FireOutputInternal,
+/// the callback only runs for outputs that already matched.
+/// </summary>
+internal class EntityOutputFilteredHookCallback : IDisposable
+{
+    public Guid Guid { get; init; }
+
+    private readonly ILogger<EntityOutputFilteredHookCallback> logger;
+    private readonly EntityOutputFilteredHookCallbackDelegate unmanagedCallback;
+    private readonly nint unmanagedCallbackPtr;
+    private readonly ulong nativeHookId;
+
+    private volatile bool disposed;
+
+    public EntityOutputFilteredHookCallback( string className, string outputName, uint callerHandle, uint activatorHandle, string activatorClassName, IEntitySystemService.EntityOutputEventHandler callback, ILoggerFactory loggerFactory, IContextedProfilerService profiler )
+    {
+        this.Guid = Guid.NewGuid();
+        this.logger = loggerFactory.CreateLogger<EntityOutputFilteredHookCallback>();
+        this.disposed = false;
+
+        unmanagedCallback = ( entityio, pOutputName, activator, caller, variant, delay ) =>
+        {
+            var category = "EntityOutputFilteredHookCallback::" + outputName;
+            try
+            {
+                profiler.StartRecording(category);
+                var callerInstance = caller != nint.Zero ? new CEntityInstanceImpl(caller) : null;
+                OnEntityFireOutputHookEvent @event;
+                unsafe
+                {
+                    @event = new OnEntityFireOutputHookEvent {
+                        _entityIO = (CEntityIOOutput*)entityio,
+                        _variant = (CVariant<CVariantDefaultAllocator>*)variant,
+                        DesignerName = callerInstance?.DesignerName ?? string.Empty,
+                        OutputName = Marshal.PtrToStringAnsi(pOutputName) ?? string.Empty,
+                        Activator = activator != nint.Zero ? new CEntityInstanceImpl(activator) : null,
+                        Caller = callerInstance,
+                        Delay = delay,
+                        Result = HookResult.Continue
+                    };
+                }
+                callback(@event);
+                return (int)@event.Result;
+            }
+            catch (Exception e)
+            {
+                if (!GlobalExceptionHandler.Handle(e))
+                {
+                    return 0;
+                }
+                logger.LogError(e, "Failed to execute entity output callback {0}.", Guid);
+            }
+            finally
+            {
+                profiler.StopRecording(category);
+            }
+            return 0;
+        };
+
+        unmanagedCallbackPtr = Marshal.GetFunctionPointerForDelegate(unmanagedCallback);
+        nativeHookId = NativeEntitySystem.HookEntityOutputFiltered(className, outputName, callerHandle, activatorHandle, activatorClassName, unmanagedCallbackPtr);
+    }
+
+    ~EntityOutputFilteredHookCallback()
+    {
+        Dispose();
+    }
+
+    public void Dispose()
+    {
+        if (disposed)
+        {
+            return;
+        }
+        disposed = true;
+
+        NativeEntitySystem.UnhookEntityOutput(nativeHookId);
+
+        GC.SuppressFinalize(this);
+    }
+}
@@ -23,6 +23,7 @@ internal class EntitySystemService : IEntitySystemService, IDisposable
     [Obsolete("Use outputHooks instead.")]
     private readonly ConcurrentDictionary<Guid, EntityOutputHookCallback> outputCallbacks = new();
     private readonly ConcurrentDictionary<Guid, EventDelegates.OnEntityFireOutputHookEvent> outputHooks = new();
+    private readonly ConcurrentDictionary<Guid, EntityOutputFilteredHookCallback> filteredOutputHooks = new();
     private readonly ConcurrentDictionary<Guid, EventDelegates.OnEntityIdentityAcceptInputHook> inputHooks = new();
 
     private volatile bool disposed;
@@ -73,6 +74,11 @@ internal class EntitySystemService : IEntitySystemService, IDisposable
         return handle.IsValidPtr() ? new CCSGameRulesImpl(handle) : null;
     }
 
+    public IEntityCommandBuffer CreateCommandBuffer()
+    {
+        return new EntityCommandBuffer();
+    }
+
     public IEnumerable<CEntityInstance> GetAllEntities()
     {
         ThrowIfEntitySystemInvalid();
@@ -178,6 +184,37 @@ internal class EntitySystemService : IEntitySystemService, IDisposable
         return guid;
     }
 
+    public Guid HookEntityOutput( CEntityInstance caller, string outputName, IEntitySystemService.EntityOutputEventHandler callback, CEntityInstance? activator = null, string? activatorDesignerName = null )
+    {
+        ArgumentNullException.ThrowIfNull(caller);
+
+        var callerHandle = NativeEntitySystem.GetEntityHandleFromEntity(caller.Address);
+        return HookEntityOutputFiltered(caller.DesignerName, outputName, callerHandle, callback, activator, activatorDesignerName);
+    }
+
+    public Guid HookEntityOutput( string designerName, string outputName, IEntitySystemService.EntityOutputEventHandler callback, CEntityInstance? activator, string? activatorDesignerName = null )
+    {
+        if (string.IsNullOrWhiteSpace(designerName))
+        {
+            throw new ArgumentException("Designer name cannot be null or empty.");
+        }
+
+        return HookEntityOutputFiltered(designerName.Trim(), outputName, 0xFFFFFFFF, callback, activator, activatorDesignerName);
+    }
+
+    private Guid HookEntityOutputFiltered( string designerName, string outputName, uint callerHandle, IEntitySystemService.EntityOutputEventHandler callback, CEntityInstance? activator, string? activatorDesignerName )
+    {
+        if (string.IsNullOrWhiteSpace(outputName))
+        {
+            throw new ArgumentException("Output name cannot be null or empty.");
+        }
+
+        var activatorHandle = activator != null ? NativeEntitySystem.GetEntityHandleFromEntity(activator.Address) : 0xFFFFFFFF;
+        var hook = new EntityOutputFilteredHookCallback(designerName, outputName.Trim(), callerHandle, activatorHandle, activatorDesignerName?.Trim() ?? string.Empty, callback, loggerFactory, profiler);
+        _ = filteredOutputHooks.TryAdd(hook.Guid, hook);
+        return hook.Guid;
+    }
+
     public Guid HookEntityInput<T>( string inputName, IEntitySystemService.EntityInputEventHandler callback ) where T : class, ISchemaClass<T>
     {
         if (T.ClassName == null)
@@ -252,6 +289,11 @@ internal class EntitySystemService : IEntitySystemService, IDisposable
             eventSubscriber.OnEntityFireOutputHook -= handler;
             return true;
         }
+        else if (filteredOutputHooks.TryRemove(guid, out var filteredHook))
+        {
+            filteredHook.Dispose();
+            return true;
+        }
         return false;
     }
 
@@ -285,6 +327,12 @@ internal class EntitySystemService : IEntitySystemService, IDisposable
         }
         outputHooks.Clear();
 
+        foreach (var hook in filteredOutputHooks.Values)
+        {
+            hook.Dispose();
+        }
+        filteredOutputHooks.Clear();
+
         foreach (var handler in inputHooks.Values)
         {
             eventSubscriber.OnEntityIdentityAcceptInputHook -= handler;
@@ -28,92 +28,120 @@ internal class GameEventAccessor : NativeHandle, IGameEventAccessor, IDisposable
 
   public void SetBool(string key, bool value) {
     CheckIsValid();
-    NativeGameEvents.SetBool(Address, key, value);
+    if (InternedStrings.TryGet(key, out var keyId)) NativeGameEvents.SetBoolById(Address, keyId, value);
+    else NativeGameEvents.SetBool(Address, key, value);
   }
 
   public bool GetBool(string key) {
     CheckIsValid();
-    return NativeGameEvents.GetBool(Address, key);
+    return InternedStrings.TryGet(key, out var keyId)
+      ? NativeGameEvents.GetBoolById(Address, keyId)
+      : NativeGameEvents.GetBool(Address, key);
   }
 
   public void SetInt32(string key, int value) {
     CheckIsValid();
-    NativeGameEvents.SetInt(Address, key, value);
+    if (InternedStrings.TryGet(key, out var keyId)) NativeGameEvents.SetIntById(Address, keyId, value);
+    else NativeGameEvents.SetInt(Address, key, value);
   }
 
   public int GetInt32(string key) {
     CheckIsValid();
-    return NativeGameEvents.GetInt(Address, key);
+    return InternedStrings.TryGet(key, out var keyId)
+      ? NativeGameEvents.GetIntById(Address, keyId)
+      : NativeGameEvents.GetInt(Address, key);
   }
 
   public void SetUInt64(string key, ulong value) {
     CheckIsValid();
-    NativeGameEvents.SetUint64(Address, key, value);
+    if (InternedStrings.TryGet(key, out var keyId)) NativeGameEvents.SetUint64ById(Address, keyId, value);
+    else NativeGameEvents.SetUint64(Address, key, value);
   }
 
   public ulong GetUInt64(string key) {
     CheckIsValid();
-    return NativeGameEvents.GetUint64(Address, key);
+    return InternedStrings.TryGet(key, out var keyId)
+      ? NativeGameEvents.GetUint64ById(Address, keyId)
+      : NativeGameEvents.GetUint64(Address, key);
   }
 
   public void SetFloat(string key, float value) {
     CheckIsValid();
-    NativeGameEvents.SetFloat(Address, key, value);
+    if (InternedStrings.TryGet(key, out var keyId)) NativeGameEvents.SetFloatById(Address, keyId, value);
+    else NativeGameEvents.SetFloat(Address, key, value);
   }
 
   public float GetFloat(string key) {
     CheckIsValid();
-    return NativeGameEvents.GetFloat(Address, key);
+    return InternedStrings.TryGet(key, out var keyId)
+      ? NativeGameEvents.GetFloatById(Address, keyId)
+      : NativeGameEvents.GetFloat(Address, key);
   }
 
   public void SetString(string key, string value) {
     CheckIsValid();
-    NativeGameEvents.SetString(Address, key, value);
+    if (InternedStrings.TryGet(key, out var keyId)) NativeGameEvents.SetStringById(Address, keyId, value);
+    else NativeGameEvents.SetString(Address, key, value);
   }
 
   public string GetString(string key) {
     CheckIsValid();
-    return NativeGameEvents.GetString(Address, key);
+    return InternedStrings.TryGet(key, out var keyId)
+      ? NativeGameEvents.GetStringById(Address, keyId)
+      : NativeGameEvents.GetString(Address, key);
   }
 
   public void SetEntity<K>(string key, K value) where K : CEntityInstance {
     CheckIsValid();
-    NativeGameEvents.SetEntity(Address, key, value.Address);
+    if (InternedStrings.TryGet(key, out var keyId)) NativeGameEvents.SetEntityById(Address, keyId, value.Address);
+    else NativeGameEvents.SetEntity(Address, key, value.Address);
   }
 
   public K GetEntity<K>(string key) where K : CEntityInstance {
     CheckIsValid();
-    return (K)K.From(NativeGameEvents.GetEntity(Address, key));
+    return InternedStrings.TryGet(key, out var keyId)
+      ? (K)K.From(NativeGameEvents.GetEntityById(Address, keyId))
+      : (K)K.From(NativeGameEvents.GetEntity(Address, key));
   }
 
   public void SetEntityIndex(string key, int value) {
     CheckIsValid();
-    NativeGameEvents.SetEntityIndex(Address, key, value);
+    if (InternedStrings.TryGet(key, out var keyId)) NativeGameEvents.SetEntityIndexById(Address, keyId, value);
+    else NativeGameEvents.SetEntityIndex(Address, key, value);
   }
 
   public int GetEntityIndex(string key) {
     CheckIsValid();
-    return NativeGameEvents.GetEntityIndex(Address, key);
+    return InternedStrings.TryGet(key, out var keyId)
+      ? NativeGameEvents.GetEntityIndexById(Address, keyId)
+      : NativeGameEvents.GetEntityIndex(Address, key);
   }
 
   public void SetPlayerSlot(string key, int value) {
     CheckIsValid();
-    NativeGameEvents.SetPlayerSlot(Address, key, value);
+    if (InternedStrings.TryGet(key, out var keyId)) NativeGameEvents.SetPlayerSlotById(Address, keyId, value);
+    else NativeGameEvents.SetPlayerSlot(Address, key, value);
   }
 
   public int GetPlayerSlot(string key) {
     CheckIsValid();
-    return NativeGameEvents.GetPlayerSlot(Address, key);
+    return InternedStrings.TryGet(key, out var keyId)
+      ? NativeGameEvents.GetPlayerSlotById(Address, keyId)
+      : NativeGameEvents.GetPlayerSlot(Address, key);
   }
 
   public CCSPlayerController GetPlayerController(string key) {
     CheckIsValid();
-    return new CCSPlayerControllerImpl(NativeGameEvents.GetPlayerController(Address, key));
+    return InternedStrings.TryGet(key, out var keyId)
+      ? new CCSPlayerControllerImpl(NativeGameEvents.GetPlayerControllerById(Address, keyId))
+      : new CCSPlayerControllerImpl(NativeGameEvents.GetPlayerController(Address, key));
   }
 
   public CCSPlayerPawn GetPlayerPawn(string key) {
     CheckIsValid();
-    return new CCSPlayerPawnImpl(NativeGameEvents.GetPlayerPawn(Address, key));
+    return InternedStrings.TryGet(key, out var keyId)
+      ? new CCSPlayerPawnImpl(NativeGameEvents.GetPlayerPawnById(Address, keyId))
+      : new CCSPlayerPawnImpl(NativeGameEvents.GetPlayerPawn(Address, key));
   }
 
   public IPlayer GetPlayer(string key) {
@@ -123,17 +151,22 @@ internal class GameEventAccessor : NativeHandle, IGameEventAccessor, IDisposable
 
   public void SetPtr(string key, nint value) {
     CheckIsValid();
-    NativeGameEvents.SetPtr(Address, key, value);
+    if (InternedStrings.TryGet(key, out var keyId)) NativeGameEvents.SetPtrById(Address, keyId, value);
+    else NativeGameEvents.SetPtr(Address, key, value);
   }
 
   public nint GetPtr(string key) {
     CheckIsValid();
-    return NativeGameEvents.GetPtr(Address, key);
+    return InternedStrings.TryGet(key, out var keyId)
+      ? NativeGameEvents.GetPtrById(Address, keyId)
+      : NativeGameEvents.GetPtr(Address, key);
   }
 
   public int GetPawnEntityIndex(string key) {
     CheckIsValid();
-    return NativeGameEvents.GetPawnEntityIndex(Address, key);
+    return InternedStrings.TryGet(key, out var keyId)
+      ? NativeGameEvents.GetPawnEntityIndexById(Address, keyId)
+      : NativeGameEvents.GetPawnEntityIndex(Address, key);
   }
 
   public bool IsReliable() {
@@ -1,7 +1,6 @@
 using System.Collections.Concurrent;
 using System.Runtime.InteropServices;
 using System.Runtime.CompilerServices;
-using Spectre.Console;
 using SwiftlyS2.Core.Natives;
 using SwiftlyS2.Shared.Memory;
 
@@ -15,7 +14,7 @@ internal class HookManager
     private class HookNode
     {
         public required Guid Id { get; init; }
-        public nint HookHandle { get; set; }
+        public ulong ListenerId { get; set; }
         public nint OriginalFuncPtr { get; set; }
         public required Func<Func<nint>, Delegate> CallbackBuilder { get; init; }
         public Delegate? BuiltDelegate { get; set; }
@@ -31,10 +30,7 @@ internal class HookManager
 
     private class HookChain
     {
-        public bool Hooked { get; set; } = false;
         public required nint FunctionAddress { get; set; }
-        public nint HookHandle { get; set; }
-        public nint OriginalFunctionAddress { get; set; }
         public List<HookNode> Nodes { get; } = [];
     }
 
@@ -57,14 +53,18 @@ internal class HookManager
 
     public bool IsHooked( nint functionAddress )
     {
-        return chains.TryGetValue(functionAddress, out var chain) && chain.Hooked;
+        return chains.TryGetValue(functionAddress, out var chain) && chain.Nodes.Count > 0;
     }
 
     public nint GetOriginal( nint functionAddress )
     {
-        return chains.TryGetValue(functionAddress, out var chain)
-            ? !chain.Hooked ? functionAddress : chain.Nodes.Count == 0 ? chain.OriginalFunctionAddress : chain.Nodes[^1].OriginalFuncPtr
-            : nint.Zero;
+        if (!chains.TryGetValue(functionAddress, out var chain))
+        {
+            return nint.Zero;
+        }
+
+        var original = NativeHooks.GetHookChainOriginal(functionAddress);
+        return original != nint.Zero ? original : functionAddress;
     }
 
     public Guid AddMidHook( nint address, MidHookDelegate callback )
@@ -117,20 +117,53 @@ internal class HookManager
         return node.Id;
     }
 
-    public Guid AddHook( nint functionAddress, Func<Func<nint>, Delegate> callbackBuilder )
+    public Guid AddHook( nint functionAddress, Func<Func<nint>, Delegate> callbackBuilder, int priority = 0 )
+    {
+        return AddHook(functionAddress, callbackBuilder, null, priority);
+    }
+
+    public Guid AddHook( nint functionAddress, Func<Func<nint>, Delegate> callbackBuilder, HookPredicate? predicate, int priority = 0, string? owner = null )
     {
         var node = new HookNode {
             Id = Guid.NewGuid(),
             CallbackBuilder = callbackBuilder,
         };
 
-        if (!chains.TryGetValue(functionAddress, out var chain))
+        // The native side keeps one detour per function and links the listeners together,
+        // adding or removing one never re-patches the function or touches the other nodes.
+        node.BuiltDelegate = node.CallbackBuilder.Invoke(() => node.OriginalFuncPtr);
+        node.BuiltPointer = Marshal.GetFunctionPointerForDelegate(node.BuiltDelegate);
+        if (predicate == null || predicate.Conditions.Count == 0)
         {
-            chain = new HookChain { FunctionAddress = functionAddress };
-            chains[functionAddress] = chain;
+            node.ListenerId = NativeHooks.AddHookListener(functionAddress, node.BuiltPointer, priority);
+        }
+        else
+        {
+            // calls failing the predicate are passed through natively and never reach the delegate
+            var conditions = predicate.Conditions.ToArray();
+            unsafe
+            {
+                fixed (HookPredicateCondition* conditionsPtr = conditions)
+                {
+                    node.ListenerId = NativeHooks.AddHookListenerFiltered(functionAddress, node.BuiltPointer, priority, (nint)conditionsPtr, conditions.Length);
+                }
+            }
+        }
+        if (node.ListenerId == 0)
+        {
+            throw new InvalidOperationException($"Failed to hook function at 0x{functionAddress:X}.");
+        }
+        node.OriginalFuncPtr = NativeHooks.GetHookListenerNext(node.ListenerId);
+        if (owner != null)
+        {
+            NativeHooks.SetHookListenerOwner(node.ListenerId, owner);
+        }
+
+        var chain = chains.GetOrAdd(functionAddress, address => new HookChain { FunctionAddress = address });
+        lock (chain)
+        {
+            chain.Nodes.Add(node);
         }
-        chain.Nodes.Add(node);
-        RebuildChain(chain);
 
         return node.Id;
     }
@@ -145,65 +178,16 @@ internal class HookManager
 
     public void Remove( List<Guid> nodeIds )
     {
-        chains.Values.Where(c => c.Nodes.Any(n => nodeIds.Contains(n.Id))).ToList().ForEach(chain =>
+        foreach (var chain in chains.Values)
         {
-            _ = chain.Nodes.RemoveAll(n => nodeIds.Contains(n.Id));
-            RebuildChain(chain);
-        });
-    }
-
-    private void RebuildChain( HookChain chain )
-    {
-        try
-        {
-            // Rebuild delegates from first to last, wiring each to previous pointer (or original for first)
-            if (chain.Hooked)
-            {
-                for (var i = 0; i < chain.Nodes.Count; i++)
-                {
-                    chain.Nodes[i].BuiltDelegate = null;
-                    chain.Nodes[i].BuiltPointer = nint.Zero;
-                    if (chain.Nodes[i].HookHandle != 0)
-                    {
-                        NativeHooks.DeallocateHook(chain.Nodes[i].HookHandle);
-                        chain.Nodes[i].HookHandle = 0;
-                    }
-                }
-                chain.OriginalFunctionAddress = 0;
-                NativeHooks.DeallocateHook(chain.HookHandle);
-                chain.HookHandle = 0;
-                chain.Hooked = false;
-            }
-            chain.HookHandle = NativeHooks.AllocateHook();
-
-            for (var i = 0; i < chain.Nodes.Count; i++)
+            lock (chain)
             {
-                var node = chain.Nodes[i];
-
-                var built = node.CallbackBuilder.Invoke(() => node.OriginalFuncPtr);
-                node.BuiltDelegate = built;
-                node.BuiltPointer = Marshal.GetFunctionPointerForDelegate(node.BuiltDelegate);
-                if (i == 0)
-                {
-                    NativeHooks.SetHook(chain.HookHandle, chain.FunctionAddress, node.BuiltPointer);
-                    node.OriginalFuncPtr = NativeHooks.GetHookOriginal(chain.HookHandle);
-                    chain.OriginalFunctionAddress = node.OriginalFuncPtr;
-                    NativeHooks.EnableHook(chain.HookHandle);
-                    chain.Hooked = true;
-                }
-                else
+                foreach (var node in chain.Nodes.Where(n => nodeIds.Contains(n.Id)))
                 {
-                    node.HookHandle = NativeHooks.AllocateHook();
-                    NativeHooks.SetHook(node.HookHandle, chain.Nodes[i - 1].OriginalFuncPtr, node.BuiltPointer);
-                    NativeHooks.EnableHook(node.HookHandle);
-                    node.OriginalFuncPtr = NativeHooks.GetHookOriginal(node.HookHandle);
+                    NativeHooks.RemoveHookListener(node.ListenerId);
                 }
+                _ = chain.Nodes.RemoveAll(n => nodeIds.Contains(n.Id));
             }
         }
-        catch (Exception e)
-        {
-            if (!GlobalExceptionHandler.Handle(e)) return;
-            AnsiConsole.WriteException(e);
-        }
     }
 }
\ No newline at end of file
@@ -3,6 +3,7 @@ using Microsoft.Extensions.Logging;
 using SwiftlyS2.Core.Hooks;
 using SwiftlyS2.Core.Natives;
 using SwiftlyS2.Core.Extensions;
+using SwiftlyS2.Core.Services;
 using SwiftlyS2.Shared.Memory;
 using SwiftlyS2.Shared.Schemas;
 
@@ -14,14 +15,16 @@ internal class MemoryService : IMemoryService, IDisposable
   private readonly ILogger<MemoryService> _Logger;
   private readonly HookManager _HookManager;
   private readonly ILoggerFactory _LoggerFactory;
+  private readonly CoreContext _Context;
   private readonly Dictionary<nint, UnmanagedFunction> _UnmanagedFunctions = new();
   private readonly Dictionary<nint, UnmanagedMemory> _UnmanagedMemories = new();
 
-  public MemoryService( ILogger<MemoryService> logger, HookManager hookManager, ILoggerFactory loggerFactory )
+  public MemoryService( ILogger<MemoryService> logger, HookManager hookManager, ILoggerFactory loggerFactory, CoreContext context )
   {
     _Logger = logger;
     _HookManager = hookManager;
     _LoggerFactory = loggerFactory;
+    _Context = context;
   }
 
   public IUnmanagedFunction<TDelegate> GetUnmanagedFunctionByAddress<TDelegate>( nint address ) where TDelegate : Delegate
@@ -39,7 +42,7 @@ internal class MemoryService : IMemoryService, IDisposable
           throw new Exception($"Cannot have two different delegate type on a same address. The previous one is {function.DelegateType}.");
         }
       }
-      var newFunction = new UnmanagedFunction<TDelegate>(address, _HookManager, _LoggerFactory);
+      var newFunction = new UnmanagedFunction<TDelegate>(address, _HookManager, _LoggerFactory) { Owner = _Context.Name };
       _UnmanagedFunctions.Add(address, newFunction);
       return newFunction;
     }
@@ -153,7 +156,8 @@ internal class MemoryService : IMemoryService, IDisposable
 
   public nint Alloc(ulong size)
   {
-    return NativeAllocator.Alloc(size);
+    // charged to the plugin, so the allocation profiler can attribute it
+    return NativeAllocator.TrackedAlloc(size, _Context.Name, "");
   }
 
   public void Free(nint pointer)
@@ -166,6 +170,26 @@ internal class MemoryService : IMemoryService, IDisposable
     return NativeAllocator.Resize(pointer, newSize);
   }
 
+  public nint FrameAlloc(ulong size)
+  {
+    return NativeAllocator.FrameAlloc(size);
+  }
+
+  public nint ArenaAlloc(ulong size)
+  {
+    return NativeAllocator.ArenaAlloc(_Context.Name, size);
+  }
+
+  public void ResetArena()
+  {
+    NativeAllocator.FreeArena(_Context.Name);
+  }
+
+  public ulong GetArenaAllocated()
+  {
+    return NativeAllocator.GetArenaAllocated(_Context.Name);
+  }
+
   public void Dispose()
   {
     foreach (var function in _UnmanagedFunctions)
@@ -178,5 +202,6 @@ internal class MemoryService : IMemoryService, IDisposable
     }
     _UnmanagedFunctions.Clear();
     _UnmanagedMemories.Clear();
+    NativeAllocator.FreeArena(_Context.Name);
   }
 }
\ No newline at end of file
@@ -41,6 +41,11 @@ internal class UnmanagedFunction<TDelegate> : UnmanagedFunction, IUnmanagedFunct
 
   public List<Guid> Hooks { get; } = new();
 
+  /// <summary>
+  /// Shown next to this function's hooks in the hook stats.
+  /// </summary>
+  public string? Owner { get; init; }
+
   private HookManager _HookManager { get; set; }
 
   private ILogger<UnmanagedFunction<TDelegate>> _Logger { get; set; }
@@ -57,10 +62,20 @@ internal class UnmanagedFunction<TDelegate> : UnmanagedFunction, IUnmanagedFunct
   }
 
   public Guid AddHook( Func<Func<TDelegate>, TDelegate> callbackBuilder )
+  {
+    return AddHook(callbackBuilder, 0);
+  }
+
+  public Guid AddHook( Func<Func<TDelegate>, TDelegate> callbackBuilder, int priority )
+  {
+    return AddHook(callbackBuilder, null, priority);
+  }
+
+  public Guid AddHook( Func<Func<TDelegate>, TDelegate> callbackBuilder, HookPredicate? predicate, int priority = 0 )
   {
     try
     {
-      var id = _HookManager.AddHook(Address, ( builder ) => callbackBuilder(() => Marshal.GetDelegateForFunctionPointer<TDelegate>(builder())));
+      var id = _HookManager.AddHook(Address, ( builder ) => callbackBuilder(() => Marshal.GetDelegateForFunctionPointer<TDelegate>(builder())), predicate, priority, Owner);
       Hooks.Add(id);
       return id;
     }
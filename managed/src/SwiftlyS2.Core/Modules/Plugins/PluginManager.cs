@@ -460,6 +460,7 @@ internal class PluginManager : IPluginManager
             Console.WriteLine(string.Empty);
             logger.LogInformation("Loading plugin: {Path}", fullDisplayPath);
 
+            NativeCore.BeginTimelinePhase(dllName, "plugin");
             try
             {
                 var context = LoadPlugin(pluginDir, false, silent: false);
@@ -491,16 +492,24 @@ internal class PluginManager : IPluginManager
                 }
                 logger.LogWarning(e, "Failed to load plugin: {Path}", fullDisplayPath);
             }
+            finally
+            {
+                NativeCore.EndTimelinePhase();
+            }
 
             Console.WriteLine(string.Empty);
         });
 
+        NativeCore.BeginTimelinePhase("Shared services", "plugin");
         RebuildSharedServices();
+        NativeCore.EndTimelinePhase();
 
+        NativeCore.BeginTimelinePhase("OnAllPluginsLoaded", "plugin");
         plugins
             .Where(p => p.Status == PluginStatus.Loaded)
             .ToList()
             .ForEach(p => p.Plugin?.OnAllPluginsLoaded());
+        NativeCore.EndTimelinePhase();
     }
 
     private PluginContext? LoadPlugin( string dir, bool hotReload, bool silent = false )
@@ -560,6 +569,8 @@ internal class PluginManager : IPluginManager
         var plugin = (BasePlugin)Activator.CreateInstance(pluginType, [core])!;
         core.InitializeObject(plugin);
 
+        // everything the plugin hooks while loading gets patched in at once
+        NativeHooks.BeginTransaction();
         try
         {
             plugin.Load(hotReload);
@@ -591,6 +602,10 @@ internal class PluginManager : IPluginManager
 
             return FailWithError(context, $"Failed to load plugin: {Path.Combine(dir, Path.GetFileName(dir))}.dll");
         }
+        finally
+        {
+            NativeHooks.CommitTransaction();
+        }
     }
 
     private void RebuildSharedServices()
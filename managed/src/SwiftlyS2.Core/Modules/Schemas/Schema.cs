@@ -48,22 +48,48 @@ internal static class Schema
   public static bool isFollowingServerGuidelines = NativeServerHelpers.IsFollowingServerGuidelines();
 
   [MethodImpl(MethodImplOptions.AggressiveInlining)]
-  public static nint GetOffset( ulong hash )
+  public static void ThrowIfDangerous( ulong hash )
   {
     if (isFollowingServerGuidelines && dangerousFields.Contains(hash))
     {
       throw new InvalidOperationException($"Cannot get or set 0x{hash:X16} while \"FollowCS2ServerGuidelines\" is enabled.\n\tTo use this operation, disable the option in core.jsonc.");
     }
+  }
+
+  // Same hash the native schema keys its fields with: FNV-1a 32 over the UTF-8 bytes of each name,
+  // class in the high half and field in the low half.
+  public static ulong GetFieldHash( string className, string fieldName )
+  {
+    return ((ulong)Fnv1a32(className) << 32) | Fnv1a32(fieldName);
+  }
+
+  private static uint Fnv1a32( string value )
+  {
+    var pool = ArrayPool<byte>.Shared;
+    var bytes = pool.Rent(Encoding.UTF8.GetMaxByteCount(value.Length));
+    var size = Encoding.UTF8.GetBytes(value, bytes);
+
+    uint hash = 0x811c9dc5;
+    for (int i = 0; i < size; i++)
+    {
+      hash = (hash ^ bytes[i]) * 0x1000193;
+    }
+
+    pool.Return(bytes);
+    return hash;
+  }
+
+  [MethodImpl(MethodImplOptions.AggressiveInlining)]
+  public static nint GetOffset( ulong hash )
+  {
+    ThrowIfDangerous(hash);
     return NativeSchema.GetOffset(hash);
   }
 
   [MethodImpl(MethodImplOptions.AggressiveInlining)]
   public static void Update( nint handle, ulong hash )
   {
-    if (isFollowingServerGuidelines && dangerousFields.Contains(hash))
-    {
-      throw new InvalidOperationException($"Cannot get or set 0x{hash:X16} while \"FollowCS2ServerGuidelines\" is enabled.\n\tTo use this operation, disable the option in core.jsonc.");
-    }
+    ThrowIfDangerous(hash);
     NativeSchema.SetStateChanged(handle, hash);
   }
 
@@ -0,0 +1,36 @@
+using System.Collections.Concurrent;
+
+namespace SwiftlyS2.Core.Natives;
+
+/// <summary>
+/// Native side ids for strings that are passed to natives over and over (event keys and such),
+/// so the hot natives take a uint instead of marshalling the same string on every call.
+/// </summary>
+internal static class InternedStrings {
+
+  private static readonly ConcurrentDictionary<string, uint> _ids = new();
+  // the table never frees ids, once it's full it stays full
+  private static volatile bool _full;
+
+  public static uint Get(string value) {
+    if (!TryGet(value, out var id)) throw new InvalidOperationException("The native string intern table is full.");
+    return id;
+  }
+
+  /// <summary>
+  /// False once the native table is full, callers then pass the string itself.
+  /// </summary>
+  public static bool TryGet(string value, out uint id) {
+    if (_ids.TryGetValue(value, out id)) return true;
+    if (_full) return false;
+
+    id = NativeCore.InternString(value);
+    if (id == 0) {
+      _full = true;
+      return false;
+    }
+
+    _ids.TryAdd(value, id);
+    return true;
+  }
+}
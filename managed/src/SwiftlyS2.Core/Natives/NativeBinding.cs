@@ -1,4 +1,3 @@
-using System.Reflection;
 using System.Runtime.InteropServices;
 using Spectre.Console;
 using SwiftlyS2.Shared.Natives;
@@ -19,31 +18,31 @@ internal class NativeBinding
         }
     }
 
-    public static void BindNatives( IntPtr nativeTable, int nativeTableSize )
+    public static void BindNatives( IntPtr nativeTable, int nativeTableSize, ulong nativeNamesHash )
     {
         MainThreadID = Environment.CurrentManagedThreadId;
         unsafe
         {
             try
             {
-                var pNativeTables = (NativeFunction*)nativeTable;
-
+                // natives are looked up by id, so both sides have to come from the same natives/ definitions
+                if (nativeTableSize != NativeTable.Count || nativeNamesHash != NativeTable.NamesHash)
+                {
+                    throw new InvalidOperationException($"The core exports {nativeTableSize} natives (names hash {nativeNamesHash:x16}) but the managed side was generated for {NativeTable.Count} (names hash {NativeTable.NamesHash:x16}). Rebuild both from the same natives/ definitions.");
+                }
 
+                var pNativeTables = (NativeFunction*)nativeTable;
                 for (int i = 0; i < nativeTableSize; i++)
                 {
-                    var name = Marshal.PtrToStringUTF8(pNativeTables[i].Name)!;
-
-                    var names = name.Split('.');
-                    var className = names[0];
-                    var funcName = names[1];
-
-                    var nativeNameSpace = "SwiftlyS2.Core.Natives.Native" + className;
-
-                    var nativeClass = Type.GetType(nativeNameSpace)!;
-                    var nativeStaticField = nativeClass.GetField("_" + funcName,
-                        BindingFlags.Static | BindingFlags.Public | BindingFlags.NonPublic);
-                    nativeStaticField!.SetValue(null, pNativeTables[i].Function);
+                    // a null name is a retired id
+                    if (pNativeTables[i].Function == 0 && pNativeTables[i].Name != 0)
+                    {
+                        AnsiConsole.MarkupLine("[yellow]Native {0} isn't implemented by the core.[/]", Markup.Escape(Marshal.PtrToStringUTF8(pNativeTables[i].Name)!));
+                    }
                 }
+
+                // every Native* class binds its fields from the table on first use
+                NativeTable.Bind(pNativeTables);
             }
             catch (Exception e)
             {
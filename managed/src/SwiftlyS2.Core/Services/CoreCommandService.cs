@@ -151,6 +151,15 @@ internal class CoreCommandService
                 case "confilter" when RequireConsoleAccess():
                     ConfilterCommand(context);
                     break;
+                case "memory" when RequireConsoleAccess():
+                    MemoryCommand(context);
+                    break;
+                case "hooks" when RequireConsoleAccess():
+                    HooksCommand(context);
+                    break;
+                case "timeline" when RequireConsoleAccess():
+                    TimelineCommand(context);
+                    break;
                 default:
                     ShowHelp(context);
                     break;
@@ -180,7 +189,10 @@ internal class CoreCommandService
                 .AddRow("confilter", "Console Filter Menu")
                 .AddRow("plugins", "Plugin Management Menu")
                 .AddRow("gc", "Show garbage collection information on managed")
-                .AddRow("profiler", "Profiler Menu");
+                .AddRow("hooks", "Hook Call Stats Menu")
+                .AddRow("memory", "Native Allocation Profiler Menu")
+                .AddRow("profiler", "Profiler Menu")
+                .AddRow("timeline", "Startup and Map Change Timeline Menu");
         }
         _ = table.AddRow("version", "Display Swiftly version");
         AnsiConsole.Write(table);
@@ -310,6 +322,112 @@ internal class CoreCommandService
         }
     }
 
+    private void MemoryCommand( ICommandContext context )
+    {
+        var args = context.Args;
+        if (args.Length == 1)
+        {
+            var table = new Table().AddColumn("Command").AddColumn("Description")
+                .AddRow("enable [sampleRate]", "Enable the allocation profiler, recording 1 in sampleRate allocations (default 1)")
+                .AddRow("disable", "Disable the allocation profiler")
+                .AddRow("status", "Show the size histogram and live memory per owner");
+            AnsiConsole.Write(table);
+            return;
+        }
+
+        switch (args[1].Trim().ToLower())
+        {
+            case "enable":
+                var sampleRate = args.Length >= 3 && uint.TryParse(args[2], out var rate) && rate > 0 ? rate : 1;
+                NativeAllocator.StartProfiling(sampleRate);
+                logger.LogInformation("The allocation profiler has been enabled, sampling 1 in {SampleRate} allocations.", sampleRate);
+                break;
+            case "disable":
+                NativeAllocator.StopProfiling();
+                logger.LogInformation("The allocation profiler has been disabled.");
+                break;
+            case "status":
+                logger.LogInformation("{Output}", NativeAllocator.GetProfilingReport());
+                break;
+            default:
+                logger.LogWarning("Unknown command");
+                break;
+        }
+    }
+
+    private void HooksCommand( ICommandContext context )
+    {
+        var args = context.Args;
+        if (args.Length == 1)
+        {
+            var table = new Table().AddColumn("Command").AddColumn("Description")
+                .AddRow("enable", "Start counting and timing every hook call")
+                .AddRow("disable", "Stop recording hook stats")
+                .AddRow("reset", "Clear the recorded hook stats")
+                .AddRow("status", "Show calls and time spent per hook");
+            AnsiConsole.Write(table);
+            return;
+        }
+
+        switch (args[1].Trim().ToLower())
+        {
+            case "enable":
+                NativeHooks.EnableStats(true);
+                logger.LogInformation("Hook stats have been enabled.");
+                break;
+            case "disable":
+                NativeHooks.EnableStats(false);
+                logger.LogInformation("Hook stats have been disabled.");
+                break;
+            case "reset":
+                NativeHooks.ResetStats();
+                logger.LogInformation("Hook stats have been reset.");
+                break;
+            case "status":
+                logger.LogInformation("{Output}", NativeHooks.GetStatsReport());
+                break;
+            default:
+                logger.LogWarning("Unknown command");
+                break;
+        }
+    }
+
+    private void TimelineCommand( ICommandContext context )
+    {
+        var args = context.Args;
+        if (args.Length == 1)
+        {
+            var table = new Table().AddColumn("Command").AddColumn("Description")
+                .AddRow("status", "Show how long every startup, map change and plugin load phase took")
+                .AddRow("save", "Save the timeline as a trace file");
+            AnsiConsole.Write(table);
+            return;
+        }
+
+        switch (args[1].Trim().ToLower())
+        {
+            case "status":
+                logger.LogInformation("{Output}", NativeCore.GetTimelineSummary());
+                break;
+            case "save":
+                var profilerDir = Path.Combine(rootDirService.GetRoot(), "profilers");
+
+                if (!Directory.Exists(profilerDir))
+                {
+                    _ = Directory.CreateDirectory(profilerDir);
+                }
+
+                var filePath = Path.Combine(profilerDir, $"{DateTime.Now:yyyyMMdd}.{Guid.NewGuid()}.timeline.json");
+
+                File.WriteAllText(filePath, NativeCore.ExportTimeline());
+                logger.LogInformation("Timeline saved to {FilePath}.", filePath);
+                break;
+            default:
+                logger.LogWarning("Unknown command");
+                break;
+        }
+    }
+
     private void PluginCommand( ICommandContext context )
     {
         void ShowPluginList()
@@ -10,6 +10,27 @@ namespace SwiftlyS2.Core.Natives;
 
 internal static class NativeAllocator {
 
+  unsafe static NativeAllocator() {
+    _Alloc = (delegate* unmanaged<ulong, nint>)NativeTable.Get(0);
+    _TrackedAlloc = (delegate* unmanaged<ulong, byte*, byte*, nint>)NativeTable.Get(17);
+    _Free = (delegate* unmanaged<nint, void>)NativeTable.Get(4);
+    _Resize = (delegate* unmanaged<nint, ulong, nint>)NativeTable.Get(14);
+    _GetSize = (delegate* unmanaged<nint, ulong>)NativeTable.Get(9);
+    _GetTotalAllocated = (delegate* unmanaged<ulong>)NativeTable.Get(10);
+    _GetAllocatedByTrackedIdentifier = (delegate* unmanaged<byte*, ulong>)NativeTable.Get(6);
+    _IsPointerValid = (delegate* unmanaged<nint, byte>)NativeTable.Get(11);
+    _Copy = (delegate* unmanaged<nint, nint, ulong, void>)NativeTable.Get(2);
+    _Move = (delegate* unmanaged<nint, nint, ulong, void>)NativeTable.Get(13);
+    _FrameAlloc = (delegate* unmanaged<ulong, nint>)NativeTable.Get(3);
+    _ArenaAlloc = (delegate* unmanaged<byte*, ulong, nint>)NativeTable.Get(1);
+    _FreeArena = (delegate* unmanaged<byte*, void>)NativeTable.Get(5);
+    _GetArenaAllocated = (delegate* unmanaged<byte*, ulong>)NativeTable.Get(7);
+    _StartProfiling = (delegate* unmanaged<uint, void>)NativeTable.Get(15);
+    _StopProfiling = (delegate* unmanaged<void>)NativeTable.Get(16);
+    _IsProfiling = (delegate* unmanaged<byte>)NativeTable.Get(12);
+    _GetProfilingReport = (delegate* unmanaged<byte*, int, int>)NativeTable.Get(8);
+  }
+
   private unsafe static delegate* unmanaged<ulong, nint> _Alloc;
 
   public unsafe static nint Alloc(ulong size) {
@@ -102,4 +123,115 @@ internal static class NativeAllocator {
   public unsafe static void Move(nint dst, nint src, ulong size) {
     _Move(dst, src, size);
   }
+
+  private unsafe static delegate* unmanaged<ulong, nint> _FrameAlloc;
+
+  /// <summary>
+  /// released at the end of the current game frame, main thread only since the reset runs there
+  /// </summary>
+  public unsafe static nint FrameAlloc(ulong size) {
+    if (!NativeBinding.IsMainThread) {
+      throw new InvalidOperationException("This method can only be called from the main thread.");
+    }
+    var ret = _FrameAlloc(size);
+    return ret;
+  }
+
+  private unsafe static delegate* unmanaged<byte*, ulong, nint> _ArenaAlloc;
+
+  /// <summary>
+  /// released when FreeArena is called for the owner
+  /// </summary>
+  public unsafe static nint ArenaAlloc(string owner, ulong size) {
+    var pool = ArrayPool<byte>.Shared;
+    var ownerLength = Encoding.UTF8.GetByteCount(owner);
+    var ownerBuffer = pool.Rent(ownerLength + 1);
+    Encoding.UTF8.GetBytes(owner, ownerBuffer);
+    ownerBuffer[ownerLength] = 0;
+    fixed (byte* ownerBufferPtr = ownerBuffer) {
+      var ret = _ArenaAlloc(ownerBufferPtr, size);
+      pool.Return(ownerBuffer);
+      return ret;
+    }
+  }
+
+  private unsafe static delegate* unmanaged<byte*, void> _FreeArena;
+
+  public unsafe static void FreeArena(string owner) {
+    var pool = ArrayPool<byte>.Shared;
+    var ownerLength = Encoding.UTF8.GetByteCount(owner);
+    var ownerBuffer = pool.Rent(ownerLength + 1);
+    Encoding.UTF8.GetBytes(owner, ownerBuffer);
+    ownerBuffer[ownerLength] = 0;
+    fixed (byte* ownerBufferPtr = ownerBuffer) {
+      _FreeArena(ownerBufferPtr);
+      pool.Return(ownerBuffer);
+    }
+  }
+
+  private unsafe static delegate* unmanaged<byte*, ulong> _GetArenaAllocated;
+
+  public unsafe static ulong GetArenaAllocated(string owner) {
+    var pool = ArrayPool<byte>.Shared;
+    var ownerLength = Encoding.UTF8.GetByteCount(owner);
+    var ownerBuffer = pool.Rent(ownerLength + 1);
+    Encoding.UTF8.GetBytes(owner, ownerBuffer);
+    ownerBuffer[ownerLength] = 0;
+    fixed (byte* ownerBufferPtr = ownerBuffer) {
+      var ret = _GetArenaAllocated(ownerBufferPtr);
+      pool.Return(ownerBuffer);
+      return ret;
+    }
+  }
+
+  private unsafe static delegate* unmanaged<uint, void> _StartProfiling;
+
+  /// <summary>
+  /// records 1 in sampleRate allocations, 1 records everything
+  /// </summary>
+  public unsafe static void StartProfiling(uint sampleRate) {
+    _StartProfiling(sampleRate);
+  }
+
+  private unsafe static delegate* unmanaged<void> _StopProfiling;
+
+  public unsafe static void StopProfiling() {
+    _StopProfiling();
+  }
+
+  private unsafe static delegate* unmanaged<byte> _IsProfiling;
+
+  public unsafe static bool IsProfiling() {
+    var ret = _IsProfiling();
+    return ret == 1;
+  }
+
+  private unsafe static delegate* unmanaged<byte*, int, int> _GetProfilingReport;
+
+  /// <summary>
+  /// size histogram and per owner live bytes
+  /// </summary>
+  public unsafe static string GetProfilingReport() {
+    byte* retStackPtr = stackalloc byte[256];
+    var ret = _GetProfilingReport(retStackPtr, 256);
+    if (ret <= 256) {
+      var retString = Encoding.UTF8.GetString(retStackPtr, ret);
+      return retString;
+    }
+    var pool = ArrayPool<byte>.Shared;
+    while (true) {
+      var retBuffer = pool.Rent(ret);
+      fixed (byte* retBufferPtr = retBuffer) {
+        var retSize = _GetProfilingReport(retBufferPtr, retBuffer.Length);
+        if (retSize <= retBuffer.Length) {
+          ret = retSize;
+          var retString = Encoding.UTF8.GetString(retBufferPtr, ret);
+          pool.Return(retBuffer);
+          return retString;
+        }
+        ret = retSize;
+      }
+      pool.Return(retBuffer);
+    }
+  }
 }
\ No newline at end of file
@@ -10,6 +10,34 @@ namespace SwiftlyS2.Core.Natives;
 
 internal static class NativeBenchmark {
 
+  unsafe static NativeBenchmark() {
+    _VoidToVoid = (delegate* unmanaged<void>)NativeTable.Get(42);
+    _GetBool = (delegate* unmanaged<byte>)NativeTable.Get(22);
+    _GetInt32 = (delegate* unmanaged<int>)NativeTable.Get(25);
+    _GetUInt32 = (delegate* unmanaged<uint>)NativeTable.Get(28);
+    _GetInt64 = (delegate* unmanaged<long>)NativeTable.Get(26);
+    _GetUInt64 = (delegate* unmanaged<ulong>)NativeTable.Get(29);
+    _GetFloat = (delegate* unmanaged<float>)NativeTable.Get(24);
+    _GetDouble = (delegate* unmanaged<double>)NativeTable.Get(23);
+    _GetPtr = (delegate* unmanaged<nint>)NativeTable.Get(27);
+    _BoolToBool = (delegate* unmanaged<byte, byte>)NativeTable.Get(18);
+    _Int32ToInt32 = (delegate* unmanaged<int, int>)NativeTable.Get(30);
+    _UInt32ToUInt32 = (delegate* unmanaged<uint, uint>)NativeTable.Get(39);
+    _Int64ToInt64 = (delegate* unmanaged<long, long>)NativeTable.Get(31);
+    _UInt64ToUInt64 = (delegate* unmanaged<ulong, ulong>)NativeTable.Get(40);
+    _FloatToFloat = (delegate* unmanaged<float, float>)NativeTable.Get(21);
+    _DoubleToDouble = (delegate* unmanaged<double, double>)NativeTable.Get(20);
+    _PtrToPtr = (delegate* unmanaged<nint, nint>)NativeTable.Get(35);
+    _StringToString = (delegate* unmanaged<byte*, int, byte*, int>)NativeTable.Get(38);
+    _StringToPtr = (delegate* unmanaged<byte*, nint>)NativeTable.Get(37);
+    _MultiPrimitives = (delegate* unmanaged<nint, int, float, byte, ulong, int>)NativeTable.Get(32);
+    _MultiWithOneString = (delegate* unmanaged<nint, byte*, nint, int, float, int>)NativeTable.Get(33);
+    _MultiWithTwoStrings = (delegate* unmanaged<nint, byte*, nint, byte*, int, void>)NativeTable.Get(34);
+    _VectorToVector = (delegate* unmanaged<nint, Vector, void>)NativeTable.Get(41);
+    _QAngleToQAngle = (delegate* unmanaged<nint, QAngle, void>)NativeTable.Get(36);
+    _ComplexWithString = (delegate* unmanaged<nint, Vector, byte*, QAngle, void>)NativeTable.Get(19);
+  }
+
   private unsafe static delegate* unmanaged<void> _VoidToVoid;
 
   public unsafe static void VoidToVoid() {
@@ -128,7 +156,7 @@ internal static class NativeBenchmark {
     return ret;
   }
 
-  private unsafe static delegate* unmanaged<byte*, byte*, int> _StringToString;
+  private unsafe static delegate* unmanaged<byte*, int, byte*, int> _StringToString;
 
   public unsafe static string StringToString(string value) {
     var pool = ArrayPool<byte>.Shared;
@@ -137,15 +165,28 @@ internal static class NativeBenchmark {
     Encoding.UTF8.GetBytes(value, valueBuffer);
     valueBuffer[valueLength] = 0;
     fixed (byte* valueBufferPtr = valueBuffer) {
-      var ret = _StringToString(null, valueBufferPtr);
-      var retBuffer = pool.Rent(ret + 1);
-      fixed (byte* retBufferPtr = retBuffer) {
-        ret = _StringToString(retBufferPtr, valueBufferPtr);
-        var retString = Encoding.UTF8.GetString(retBufferPtr, ret);
-        pool.Return(retBuffer);
+      byte* retStackPtr = stackalloc byte[256];
+      var ret = _StringToString(retStackPtr, 256, valueBufferPtr);
+      if (ret <= 256) {
+        var retString = Encoding.UTF8.GetString(retStackPtr, ret);
         pool.Return(valueBuffer);
         return retString;
       }
+      while (true) {
+        var retBuffer = pool.Rent(ret);
+        fixed (byte* retBufferPtr = retBuffer) {
+          var retSize = _StringToString(retBufferPtr, retBuffer.Length, valueBufferPtr);
+          if (retSize <= retBuffer.Length) {
+            ret = retSize;
+            var retString = Encoding.UTF8.GetString(retBufferPtr, ret);
+            pool.Return(retBuffer);
+            pool.Return(valueBuffer);
+            return retString;
+          }
+          ret = retSize;
+        }
+        pool.Return(retBuffer);
+      }
     }
   }
 
@@ -10,6 +10,41 @@ namespace SwiftlyS2.Core.Natives;
 
 internal static class NativeCEntityKeyValues {
 
+  unsafe static NativeCEntityKeyValues() {
+    _Allocate = (delegate* unmanaged<nint>)NativeTable.Get(43);
+    _Deallocate = (delegate* unmanaged<nint, void>)NativeTable.Get(44);
+    _GetBool = (delegate* unmanaged<nint, byte*, byte>)NativeTable.Get(45);
+    _GetInt = (delegate* unmanaged<nint, byte*, int>)NativeTable.Get(49);
+    _GetUint = (delegate* unmanaged<nint, byte*, uint>)NativeTable.Get(55);
+    _GetInt64 = (delegate* unmanaged<nint, byte*, long>)NativeTable.Get(50);
+    _GetUint64 = (delegate* unmanaged<nint, byte*, ulong>)NativeTable.Get(56);
+    _GetFloat = (delegate* unmanaged<nint, byte*, float>)NativeTable.Get(48);
+    _GetDouble = (delegate* unmanaged<nint, byte*, double>)NativeTable.Get(47);
+    _GetString = (delegate* unmanaged<byte*, int, nint, byte*, int>)NativeTable.Get(53);
+    _GetPtr = (delegate* unmanaged<nint, byte*, nint>)NativeTable.Get(51);
+    _GetStringToken = (delegate* unmanaged<nint, byte*, CUtlStringToken>)NativeTable.Get(54);
+    _GetColor = (delegate* unmanaged<nint, byte*, Color>)NativeTable.Get(46);
+    _GetVector = (delegate* unmanaged<nint, byte*, Vector>)NativeTable.Get(57);
+    _GetVector2D = (delegate* unmanaged<nint, byte*, Vector2D>)NativeTable.Get(58);
+    _GetVector4D = (delegate* unmanaged<nint, byte*, Vector4D>)NativeTable.Get(59);
+    _GetQAngle = (delegate* unmanaged<nint, byte*, QAngle>)NativeTable.Get(52);
+    _SetBool = (delegate* unmanaged<nint, byte*, byte, void>)NativeTable.Get(60);
+    _SetInt = (delegate* unmanaged<nint, byte*, int, void>)NativeTable.Get(64);
+    _SetUint = (delegate* unmanaged<nint, byte*, uint, void>)NativeTable.Get(70);
+    _SetInt64 = (delegate* unmanaged<nint, byte*, long, void>)NativeTable.Get(65);
+    _SetUint64 = (delegate* unmanaged<nint, byte*, ulong, void>)NativeTable.Get(71);
+    _SetFloat = (delegate* unmanaged<nint, byte*, float, void>)NativeTable.Get(63);
+    _SetDouble = (delegate* unmanaged<nint, byte*, double, void>)NativeTable.Get(62);
+    _SetString = (delegate* unmanaged<nint, byte*, byte*, void>)NativeTable.Get(68);
+    _SetPtr = (delegate* unmanaged<nint, byte*, nint, void>)NativeTable.Get(66);
+    _SetStringToken = (delegate* unmanaged<nint, byte*, CUtlStringToken, void>)NativeTable.Get(69);
+    _SetColor = (delegate* unmanaged<nint, byte*, Color, void>)NativeTable.Get(61);
+    _SetVector = (delegate* unmanaged<nint, byte*, Vector, void>)NativeTable.Get(72);
+    _SetVector2D = (delegate* unmanaged<nint, byte*, Vector2D, void>)NativeTable.Get(73);
+    _SetVector4D = (delegate* unmanaged<nint, byte*, Vector4D, void>)NativeTable.Get(74);
+    _SetQAngle = (delegate* unmanaged<nint, byte*, QAngle, void>)NativeTable.Get(67);
+  }
+
   private unsafe static delegate* unmanaged<nint> _Allocate;
 
   public unsafe static nint Allocate() {
@@ -128,7 +163,7 @@ internal static class NativeCEntityKeyValues {
     }
   }
 
-  private unsafe static delegate* unmanaged<byte*, nint, byte*, int> _GetString;
+  private unsafe static delegate* unmanaged<byte*, int, nint, byte*, int> _GetString;
 
   public unsafe static string GetString(nint keyvalues, string key) {
     var pool = ArrayPool<byte>.Shared;
@@ -137,15 +172,28 @@ internal static class NativeCEntityKeyValues {
     Encoding.UTF8.GetBytes(key, keyBuffer);
     keyBuffer[keyLength] = 0;
     fixed (byte* keyBufferPtr = keyBuffer) {
-      var ret = _GetString(null, keyvalues, keyBufferPtr);
-      var retBuffer = pool.Rent(ret + 1);
-      fixed (byte* retBufferPtr = retBuffer) {
-        ret = _GetString(retBufferPtr, keyvalues, keyBufferPtr);
-        var retString = Encoding.UTF8.GetString(retBufferPtr, ret);
-        pool.Return(retBuffer);
+      byte* retStackPtr = stackalloc byte[256];
+      var ret = _GetString(retStackPtr, 256, keyvalues, keyBufferPtr);
+      if (ret <= 256) {
+        var retString = Encoding.UTF8.GetString(retStackPtr, ret);
         pool.Return(keyBuffer);
         return retString;
       }
+      while (true) {
+        var retBuffer = pool.Rent(ret);
+        fixed (byte* retBufferPtr = retBuffer) {
+          var retSize = _GetString(retBufferPtr, retBuffer.Length, keyvalues, keyBufferPtr);
+          if (retSize <= retBuffer.Length) {
+            ret = retSize;
+            var retString = Encoding.UTF8.GetString(retBufferPtr, ret);
+            pool.Return(retBuffer);
+            pool.Return(keyBuffer);
+            return retString;
+          }
+          ret = retSize;
+        }
+        pool.Return(retBuffer);
+      }
     }
   }
 
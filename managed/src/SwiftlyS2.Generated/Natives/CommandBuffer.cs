@@ -0,0 +1,29 @@
+#pragma warning disable CS0649
+#pragma warning disable CS0169
+
+using System.Buffers;
+using System.Text;
+using System.Threading;
+using SwiftlyS2.Shared.Natives;
+
+namespace SwiftlyS2.Core.Natives;
+
+internal static class NativeCommandBuffer {
+
+  unsafe static NativeCommandBuffer() {
+    _Execute = (delegate* unmanaged<nint, int, nint, int, int>)NativeTable.Get(75);
+  }
+
+  private unsafe static delegate* unmanaged<nint, int, nint, int, int> _Execute;
+
+  /// <summary>
+  /// runs the encoded ops in order, writes 1 (done) or 0 (skipped) per op to results (at most resultsCapacity of them) and returns how many ops were read
+  /// </summary>
+  public unsafe static int Execute(nint buffer, int size, nint results, int resultsCapacity) {
+    if (!NativeBinding.IsMainThread) {
+      throw new InvalidOperationException("This method can only be called from the main thread.");
+    }
+    var ret = _Execute(buffer, size, results, resultsCapacity);
+    return ret;
+  }
+}
\ No newline at end of file
@@ -10,6 +10,16 @@ namespace SwiftlyS2.Core.Natives;
 
 internal static class NativeCommandLine {
 
+  unsafe static NativeCommandLine() {
+    _HasParameter = (delegate* unmanaged<byte*, byte>)NativeTable.Get(81);
+    _GetParameterCount = (delegate* unmanaged<int>)NativeTable.Get(77);
+    _GetParameterValueString = (delegate* unmanaged<byte*, int, byte*, byte*, int>)NativeTable.Get(80);
+    _GetParameterValueInt = (delegate* unmanaged<byte*, int, int>)NativeTable.Get(79);
+    _GetParameterValueFloat = (delegate* unmanaged<byte*, float, float>)NativeTable.Get(78);
+    _GetCommandLine = (delegate* unmanaged<byte*, int, int>)NativeTable.Get(76);
+    _HasParameters = (delegate* unmanaged<byte>)NativeTable.Get(82);
+  }
+
   private unsafe static delegate* unmanaged<byte*, byte> _HasParameter;
 
   public unsafe static bool HasParameter(string parameter) {
@@ -32,7 +42,7 @@ internal static class NativeCommandLine {
     return ret;
   }
 
-  private unsafe static delegate* unmanaged<byte*, byte*, byte*, int> _GetParameterValueString;
+  private unsafe static delegate* unmanaged<byte*, int, byte*, byte*, int> _GetParameterValueString;
 
   public unsafe static string GetParameterValueString(string parameter, string defaultValue) {
     var pool = ArrayPool<byte>.Shared;
@@ -46,16 +56,30 @@ internal static class NativeCommandLine {
     defaultValueBuffer[defaultValueLength] = 0;
     fixed (byte* parameterBufferPtr = parameterBuffer) {
       fixed (byte* defaultValueBufferPtr = defaultValueBuffer) {
-        var ret = _GetParameterValueString(null, parameterBufferPtr, defaultValueBufferPtr);
-        var retBuffer = pool.Rent(ret + 1);
-        fixed (byte* retBufferPtr = retBuffer) {
-          ret = _GetParameterValueString(retBufferPtr, parameterBufferPtr, defaultValueBufferPtr);
-          var retString = Encoding.UTF8.GetString(retBufferPtr, ret);
-          pool.Return(retBuffer);
+        byte* retStackPtr = stackalloc byte[256];
+        var ret = _GetParameterValueString(retStackPtr, 256, parameterBufferPtr, defaultValueBufferPtr);
+        if (ret <= 256) {
+          var retString = Encoding.UTF8.GetString(retStackPtr, ret);
           pool.Return(parameterBuffer);
           pool.Return(defaultValueBuffer);
           return retString;
         }
+        while (true) {
+          var retBuffer = pool.Rent(ret);
+          fixed (byte* retBufferPtr = retBuffer) {
+            var retSize = _GetParameterValueString(retBufferPtr, retBuffer.Length, parameterBufferPtr, defaultValueBufferPtr);
+            if (retSize <= retBuffer.Length) {
+              ret = retSize;
+              var retString = Encoding.UTF8.GetString(retBufferPtr, ret);
+              pool.Return(retBuffer);
+              pool.Return(parameterBuffer);
+              pool.Return(defaultValueBuffer);
+              return retString;
+            }
+            ret = retSize;
+          }
+          pool.Return(retBuffer);
+        }
       }
     }
   }
@@ -90,17 +114,29 @@ internal static class NativeCommandLine {
     }
   }
 
-  private unsafe static delegate* unmanaged<byte*, int> _GetCommandLine;
+  private unsafe static delegate* unmanaged<byte*, int, int> _GetCommandLine;
 
   public unsafe static string GetCommandLine() {
-    var ret = _GetCommandLine(null);
+    byte* retStackPtr = stackalloc byte[256];
+    var ret = _GetCommandLine(retStackPtr, 256);
+    if (ret <= 256) {
+      var retString = Encoding.UTF8.GetString(retStackPtr, ret);
+      return retString;
+    }
     var pool = ArrayPool<byte>.Shared;
-    var retBuffer = pool.Rent(ret + 1);
-    fixed (byte* retBufferPtr = retBuffer) {
-      ret = _GetCommandLine(retBufferPtr);
-      var retString = Encoding.UTF8.GetString(retBufferPtr, ret);
+    while (true) {
+      var retBuffer = pool.Rent(ret);
+      fixed (byte* retBufferPtr = retBuffer) {
+        var retSize = _GetCommandLine(retBufferPtr, retBuffer.Length);
+        if (retSize <= retBuffer.Length) {
+          ret = retSize;
+          var retString = Encoding.UTF8.GetString(retBufferPtr, ret);
+          pool.Return(retBuffer);
+          return retString;
+        }
+        ret = retSize;
+      }
       pool.Return(retBuffer);
-      return retString;
     }
   }
 
@@ -10,6 +10,19 @@ namespace SwiftlyS2.Core.Natives;
 
 internal static class NativeCommands {
 
+  unsafe static NativeCommands() {
+    _HandleCommandForPlayer = (delegate* unmanaged<int, byte*, int>)NativeTable.Get(83);
+    _RegisterCommand = (delegate* unmanaged<byte*, nint, byte, ulong>)NativeTable.Get(88);
+    _UnregisterCommand = (delegate* unmanaged<ulong, void>)NativeTable.Get(92);
+    _IsCommandRegistered = (delegate* unmanaged<byte*, byte>)NativeTable.Get(84);
+    _RegisterAlias = (delegate* unmanaged<byte*, byte*, byte, ulong>)NativeTable.Get(85);
+    _UnregisterAlias = (delegate* unmanaged<ulong, void>)NativeTable.Get(89);
+    _RegisterClientCommandsListener = (delegate* unmanaged<nint, ulong>)NativeTable.Get(87);
+    _UnregisterClientCommandsListener = (delegate* unmanaged<ulong, void>)NativeTable.Get(91);
+    _RegisterClientChatListener = (delegate* unmanaged<nint, ulong>)NativeTable.Get(86);
+    _UnregisterClientChatListener = (delegate* unmanaged<ulong, void>)NativeTable.Get(90);
+  }
+
   private unsafe static delegate* unmanaged<int, byte*, int> _HandleCommandForPlayer;
 
   /// <summary>
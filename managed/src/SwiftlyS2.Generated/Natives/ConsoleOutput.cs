@@ -10,6 +10,16 @@ namespace SwiftlyS2.Core.Natives;
 
 internal static class NativeConsoleOutput {
 
+  unsafe static NativeConsoleOutput() {
+    _AddConsoleListener = (delegate* unmanaged<nint, ulong>)NativeTable.Get(93);
+    _RemoveConsoleListener = (delegate* unmanaged<ulong, void>)NativeTable.Get(98);
+    _IsEnabled = (delegate* unmanaged<byte>)NativeTable.Get(95);
+    _ToggleFilter = (delegate* unmanaged<void>)NativeTable.Get(99);
+    _ReloadFilterConfiguration = (delegate* unmanaged<void>)NativeTable.Get(97);
+    _NeedsFiltering = (delegate* unmanaged<byte*, byte>)NativeTable.Get(96);
+    _GetCounterText = (delegate* unmanaged<byte*, int, int>)NativeTable.Get(94);
+  }
+
   private unsafe static delegate* unmanaged<nint, ulong> _AddConsoleListener;
 
   /// <summary>
@@ -72,20 +82,32 @@ internal static class NativeConsoleOutput {
     }
   }
 
-  private unsafe static delegate* unmanaged<byte*, int> _GetCounterText;
+  private unsafe static delegate* unmanaged<byte*, int, int> _GetCounterText;
 
   /// <summary>
   /// gets the counter text showing how many messages were filtered
   /// </summary>
   public unsafe static string GetCounterText() {
-    var ret = _GetCounterText(null);
+    byte* retStackPtr = stackalloc byte[256];
+    var ret = _GetCounterText(retStackPtr, 256);
+    if (ret <= 256) {
+      var retString = Encoding.UTF8.GetString(retStackPtr, ret);
+      return retString;
+    }
     var pool = ArrayPool<byte>.Shared;
-    var retBuffer = pool.Rent(ret + 1);
-    fixed (byte* retBufferPtr = retBuffer) {
-      ret = _GetCounterText(retBufferPtr);
-      var retString = Encoding.UTF8.GetString(retBufferPtr, ret);
+    while (true) {
+      var retBuffer = pool.Rent(ret);
+      fixed (byte* retBufferPtr = retBuffer) {
+        var retSize = _GetCounterText(retBufferPtr, retBuffer.Length);
+        if (retSize <= retBuffer.Length) {
+          ret = retSize;
+          var retString = Encoding.UTF8.GetString(retBufferPtr, ret);
+          pool.Return(retBuffer);
+          return retString;
+        }
+        ret = retSize;
+      }
       pool.Return(retBuffer);
-      return retString;
     }
   }
 }
\ No newline at end of file
@@ -10,6 +10,59 @@ namespace SwiftlyS2.Core.Natives;
 
 internal static class NativeConvars {
 
+  unsafe static NativeConvars() {
+    _QueryClientConvar = (delegate* unmanaged<int, byte*, void>)NativeTable.Get(133);
+    _QueryClientConvarWithCallback = (delegate* unmanaged<int, byte*, nint, void>)NativeTable.Get(134);
+    _AddQueryClientCvarCallback = (delegate* unmanaged<nint, int>)NativeTable.Get(103);
+    _RemoveQueryClientCvarCallback = (delegate* unmanaged<int, void>)NativeTable.Get(138);
+    _AddGlobalChangeListener = (delegate* unmanaged<nint, ulong>)NativeTable.Get(102);
+    _RemoveGlobalChangeListener = (delegate* unmanaged<ulong, void>)NativeTable.Get(137);
+    _AddConvarCreatedListener = (delegate* unmanaged<nint, ulong>)NativeTable.Get(101);
+    _RemoveConvarCreatedListener = (delegate* unmanaged<ulong, void>)NativeTable.Get(136);
+    _AddConCommandCreatedListener = (delegate* unmanaged<nint, ulong>)NativeTable.Get(100);
+    _RemoveConCommandCreatedListener = (delegate* unmanaged<ulong, void>)NativeTable.Get(135);
+    _CreateConvarInt16 = (delegate* unmanaged<byte*, int, ulong, byte*, short, nint, nint, void>)NativeTable.Get(108);
+    _CreateConvarUInt16 = (delegate* unmanaged<byte*, int, ulong, byte*, ushort, nint, nint, void>)NativeTable.Get(113);
+    _CreateConvarInt32 = (delegate* unmanaged<byte*, int, ulong, byte*, int, nint, nint, void>)NativeTable.Get(109);
+    _CreateConvarUInt32 = (delegate* unmanaged<byte*, int, ulong, byte*, uint, nint, nint, void>)NativeTable.Get(114);
+    _CreateConvarInt64 = (delegate* unmanaged<byte*, int, ulong, byte*, long, nint, nint, void>)NativeTable.Get(110);
+    _CreateConvarUInt64 = (delegate* unmanaged<byte*, int, ulong, byte*, ulong, nint, nint, void>)NativeTable.Get(115);
+    _CreateConvarBool = (delegate* unmanaged<byte*, int, ulong, byte*, byte, nint, nint, void>)NativeTable.Get(104);
+    _CreateConvarFloat = (delegate* unmanaged<byte*, int, ulong, byte*, float, nint, nint, void>)NativeTable.Get(107);
+    _CreateConvarDouble = (delegate* unmanaged<byte*, int, ulong, byte*, double, nint, nint, void>)NativeTable.Get(106);
+    _CreateConvarColor = (delegate* unmanaged<byte*, int, ulong, byte*, Color, nint, nint, void>)NativeTable.Get(105);
+    _CreateConvarVector2D = (delegate* unmanaged<byte*, int, ulong, byte*, Vector2D, nint, nint, void>)NativeTable.Get(117);
+    _CreateConvarVector = (delegate* unmanaged<byte*, int, ulong, byte*, Vector, nint, nint, void>)NativeTable.Get(116);
+    _CreateConvarVector4D = (delegate* unmanaged<byte*, int, ulong, byte*, Vector4D, nint, nint, void>)NativeTable.Get(118);
+    _CreateConvarQAngle = (delegate* unmanaged<byte*, int, ulong, byte*, QAngle, nint, nint, void>)NativeTable.Get(111);
+    _CreateConvarString = (delegate* unmanaged<byte*, int, ulong, byte*, byte*, nint, nint, void>)NativeTable.Get(112);
+    _DeleteConvar = (delegate* unmanaged<byte*, void>)NativeTable.Get(119);
+    _ExistsConvar = (delegate* unmanaged<byte*, byte>)NativeTable.Get(120);
+    _GetConvarType = (delegate* unmanaged<byte*, int>)NativeTable.Get(121);
+    _SetClientConvarValueString = (delegate* unmanaged<int, byte*, byte*, void>)NativeTable.Get(139);
+    _GetFlags = (delegate* unmanaged<byte*, ulong>)NativeTable.Get(125);
+    _SetFlags = (delegate* unmanaged<byte*, ulong, void>)NativeTable.Get(143);
+    _GetMinValuePtrPtr = (delegate* unmanaged<byte*, nint>)NativeTable.Get(129);
+    _GetMaxValuePtrPtr = (delegate* unmanaged<byte*, nint>)NativeTable.Get(127);
+    _HasDefaultValue = (delegate* unmanaged<byte*, byte>)NativeTable.Get(132);
+    _GetDefaultValuePtr = (delegate* unmanaged<byte*, nint>)NativeTable.Get(123);
+    _SetDefaultValue = (delegate* unmanaged<byte*, nint, void>)NativeTable.Get(140);
+    _SetDefaultValueString = (delegate* unmanaged<byte*, byte*, void>)NativeTable.Get(142);
+    _GetValuePtr = (delegate* unmanaged<byte*, nint>)NativeTable.Get(131);
+    _SetValuePtr = (delegate* unmanaged<byte*, nint, void>)NativeTable.Get(149);
+    _SetValueInternalPtr = (delegate* unmanaged<byte*, nint, void>)NativeTable.Get(148);
+    _SetValueAsString = (delegate* unmanaged<byte*, byte*, byte>)NativeTable.Get(146);
+    _GetValueAsString = (delegate* unmanaged<byte*, int, byte*, int>)NativeTable.Get(130);
+    _SetDefaultValueAsString = (delegate* unmanaged<byte*, byte*, byte>)NativeTable.Get(141);
+    _GetDefaultValueAsString = (delegate* unmanaged<byte*, int, byte*, int>)NativeTable.Get(122);
+    _SetMinValueAsString = (delegate* unmanaged<byte*, byte*, byte>)NativeTable.Get(145);
+    _GetMinValueAsString = (delegate* unmanaged<byte*, int, byte*, int>)NativeTable.Get(128);
+    _SetMaxValueAsString = (delegate* unmanaged<byte*, byte*, byte>)NativeTable.Get(144);
+    _GetMaxValueAsString = (delegate* unmanaged<byte*, int, byte*, int>)NativeTable.Get(126);
+    _SetValueInternalAsString = (delegate* unmanaged<byte*, byte*, void>)NativeTable.Get(147);
+    _GetDescription = (delegate* unmanaged<byte*, int, byte*, int>)NativeTable.Get(124);
+  }
+
   private unsafe static delegate* unmanaged<int, byte*, void> _QueryClientConvar;
 
   public unsafe static void QueryClientConvar(int playerid, string cvarName) {
@@ -27,6 +80,26 @@ internal static class NativeConvars {
     }
   }
 
+  private unsafe static delegate* unmanaged<int, byte*, nint, void> _QueryClientConvarWithCallback;
+
+  /// <summary>
+  /// the callback is invoked once, only for this player and cvar, and should receive the following: int32 playerid, string cvarName, string cvarValue (null when the player disconnected before answering)
+  /// </summary>
+  public unsafe static void QueryClientConvarWithCallback(int playerid, string cvarName, nint callback) {
+    if (!NativeBinding.IsMainThread) {
+      throw new InvalidOperationException("This method can only be called from the main thread.");
+    }
+    var pool = ArrayPool<byte>.Shared;
+    var cvarNameLength = Encoding.UTF8.GetByteCount(cvarName);
+    var cvarNameBuffer = pool.Rent(cvarNameLength + 1);
+    Encoding.UTF8.GetBytes(cvarName, cvarNameBuffer);
+    cvarNameBuffer[cvarNameLength] = 0;
+    fixed (byte* cvarNameBufferPtr = cvarNameBuffer) {
+      _QueryClientConvarWithCallback(playerid, cvarNameBufferPtr, callback);
+      pool.Return(cvarNameBuffer);
+    }
+  }
+
   private unsafe static delegate* unmanaged<nint, int> _AddQueryClientCvarCallback;
 
   /// <summary>
@@ -673,7 +746,7 @@ internal static class NativeConvars {
     }
   }
 
-  private unsafe static delegate* unmanaged<byte*, byte*, int> _GetValueAsString;
+  private unsafe static delegate* unmanaged<byte*, int, byte*, int> _GetValueAsString;
 
   public unsafe static string GetValueAsString(string cvarName) {
     var pool = ArrayPool<byte>.Shared;
@@ -682,15 +755,28 @@ internal static class NativeConvars {
     Encoding.UTF8.GetBytes(cvarName, cvarNameBuffer);
     cvarNameBuffer[cvarNameLength] = 0;
     fixed (byte* cvarNameBufferPtr = cvarNameBuffer) {
-      var ret = _GetValueAsString(null, cvarNameBufferPtr);
-      var retBuffer = pool.Rent(ret + 1);
-      fixed (byte* retBufferPtr = retBuffer) {
-        ret = _GetValueAsString(retBufferPtr, cvarNameBufferPtr);
-        var retString = Encoding.UTF8.GetString(retBufferPtr, ret);
-        pool.Return(retBuffer);
+      byte* retStackPtr = stackalloc byte[256];
+      var ret = _GetValueAsString(retStackPtr, 256, cvarNameBufferPtr);
+      if (ret <= 256) {
+        var retString = Encoding.UTF8.GetString(retStackPtr, ret);
         pool.Return(cvarNameBuffer);
         return retString;
       }
+      while (true) {
+        var retBuffer = pool.Rent(ret);
+        fixed (byte* retBufferPtr = retBuffer) {
+          var retSize = _GetValueAsString(retBufferPtr, retBuffer.Length, cvarNameBufferPtr);
+          if (retSize <= retBuffer.Length) {
+            ret = retSize;
+            var retString = Encoding.UTF8.GetString(retBufferPtr, ret);
+            pool.Return(retBuffer);
+            pool.Return(cvarNameBuffer);
+            return retString;
+          }
+          ret = retSize;
+        }
+        pool.Return(retBuffer);
+      }
     }
   }
 
@@ -716,7 +802,7 @@ internal static class NativeConvars {
     }
   }
 
-  private unsafe static delegate* unmanaged<byte*, byte*, int> _GetDefaultValueAsString;
+  private unsafe static delegate* unmanaged<byte*, int, byte*, int> _GetDefaultValueAsString;
 
   public unsafe static string GetDefaultValueAsString(string cvarName) {
     var pool = ArrayPool<byte>.Shared;
@@ -725,15 +811,28 @@ internal static class NativeConvars {
     Encoding.UTF8.GetBytes(cvarName, cvarNameBuffer);
     cvarNameBuffer[cvarNameLength] = 0;
     fixed (byte* cvarNameBufferPtr = cvarNameBuffer) {
-      var ret = _GetDefaultValueAsString(null, cvarNameBufferPtr);
-      var retBuffer = pool.Rent(ret + 1);
-      fixed (byte* retBufferPtr = retBuffer) {
-        ret = _GetDefaultValueAsString(retBufferPtr, cvarNameBufferPtr);
-        var retString = Encoding.UTF8.GetString(retBufferPtr, ret);
-        pool.Return(retBuffer);
+      byte* retStackPtr = stackalloc byte[256];
+      var ret = _GetDefaultValueAsString(retStackPtr, 256, cvarNameBufferPtr);
+      if (ret <= 256) {
+        var retString = Encoding.UTF8.GetString(retStackPtr, ret);
         pool.Return(cvarNameBuffer);
         return retString;
       }
+      while (true) {
+        var retBuffer = pool.Rent(ret);
+        fixed (byte* retBufferPtr = retBuffer) {
+          var retSize = _GetDefaultValueAsString(retBufferPtr, retBuffer.Length, cvarNameBufferPtr);
+          if (retSize <= retBuffer.Length) {
+            ret = retSize;
+            var retString = Encoding.UTF8.GetString(retBufferPtr, ret);
+            pool.Return(retBuffer);
+            pool.Return(cvarNameBuffer);
+            return retString;
+          }
+          ret = retSize;
+        }
+        pool.Return(retBuffer);
+      }
     }
   }
 
@@ -759,7 +858,7 @@ internal static class NativeConvars {
     }
   }
 
-  private unsafe static delegate* unmanaged<byte*, byte*, int> _GetMinValueAsString;
+  private unsafe static delegate* unmanaged<byte*, int, byte*, int> _GetMinValueAsString;
 
   public unsafe static string GetMinValueAsString(string cvarName) {
     var pool = ArrayPool<byte>.Shared;
@@ -768,15 +867,28 @@ internal static class NativeConvars {
     Encoding.UTF8.GetBytes(cvarName, cvarNameBuffer);
     cvarNameBuffer[cvarNameLength] = 0;
     fixed (byte* cvarNameBufferPtr = cvarNameBuffer) {
-      var ret = _GetMinValueAsString(null, cvarNameBufferPtr);
-      var retBuffer = pool.Rent(ret + 1);
-      fixed (byte* retBufferPtr = retBuffer) {
-        ret = _GetMinValueAsString(retBufferPtr, cvarNameBufferPtr);
-        var retString = Encoding.UTF8.GetString(retBufferPtr, ret);
-        pool.Return(retBuffer);
+      byte* retStackPtr = stackalloc byte[256];
+      var ret = _GetMinValueAsString(retStackPtr, 256, cvarNameBufferPtr);
+      if (ret <= 256) {
+        var retString = Encoding.UTF8.GetString(retStackPtr, ret);
         pool.Return(cvarNameBuffer);
         return retString;
       }
+      while (true) {
+        var retBuffer = pool.Rent(ret);
+        fixed (byte* retBufferPtr = retBuffer) {
+          var retSize = _GetMinValueAsString(retBufferPtr, retBuffer.Length, cvarNameBufferPtr);
+          if (retSize <= retBuffer.Length) {
+            ret = retSize;
+            var retString = Encoding.UTF8.GetString(retBufferPtr, ret);
+            pool.Return(retBuffer);
+            pool.Return(cvarNameBuffer);
+            return retString;
+          }
+          ret = retSize;
+        }
+        pool.Return(retBuffer);
+      }
     }
   }
 
@@ -802,7 +914,7 @@ internal static class NativeConvars {
     }
   }
 
-  private unsafe static delegate* unmanaged<byte*, byte*, int> _GetMaxValueAsString;
+  private unsafe static delegate* unmanaged<byte*, int, byte*, int> _GetMaxValueAsString;
 
   public unsafe static string GetMaxValueAsString(string cvarName) {
     var pool = ArrayPool<byte>.Shared;
@@ -811,15 +923,28 @@ internal static class NativeConvars {
     Encoding.UTF8.GetBytes(cvarName, cvarNameBuffer);
     cvarNameBuffer[cvarNameLength] = 0;
     fixed (byte* cvarNameBufferPtr = cvarNameBuffer) {
-      var ret = _GetMaxValueAsString(null, cvarNameBufferPtr);
-      var retBuffer = pool.Rent(ret + 1);
-      fixed (byte* retBufferPtr = retBuffer) {
-        ret = _GetMaxValueAsString(retBufferPtr, cvarNameBufferPtr);
-        var retString = Encoding.UTF8.GetString(retBufferPtr, ret);
-        pool.Return(retBuffer);
+      byte* retStackPtr = stackalloc byte[256];
+      var ret = _GetMaxValueAsString(retStackPtr, 256, cvarNameBufferPtr);
+      if (ret <= 256) {
+        var retString = Encoding.UTF8.GetString(retStackPtr, ret);
         pool.Return(cvarNameBuffer);
         return retString;
       }
+      while (true) {
+        var retBuffer = pool.Rent(ret);
+        fixed (byte* retBufferPtr = retBuffer) {
+          var retSize = _GetMaxValueAsString(retBufferPtr, retBuffer.Length, cvarNameBufferPtr);
+          if (retSize <= retBuffer.Length) {
+            ret = retSize;
+            var retString = Encoding.UTF8.GetString(retBufferPtr, ret);
+            pool.Return(retBuffer);
+            pool.Return(cvarNameBuffer);
+            return retString;
+          }
+          ret = retSize;
+        }
+        pool.Return(retBuffer);
+      }
     }
   }
 
@@ -844,7 +969,7 @@ internal static class NativeConvars {
     }
   }
 
-  private unsafe static delegate* unmanaged<byte*, byte*, int> _GetDescription;
+  private unsafe static delegate* unmanaged<byte*, int, byte*, int> _GetDescription;
 
   public unsafe static string GetDescription(string cvarName) {
     var pool = ArrayPool<byte>.Shared;
@@ -853,15 +978,28 @@ internal static class NativeConvars {
     Encoding.UTF8.GetBytes(cvarName, cvarNameBuffer);
     cvarNameBuffer[cvarNameLength] = 0;
     fixed (byte* cvarNameBufferPtr = cvarNameBuffer) {
-      var ret = _GetDescription(null, cvarNameBufferPtr);
-      var retBuffer = pool.Rent(ret + 1);
-      fixed (byte* retBufferPtr = retBuffer) {
-        ret = _GetDescription(retBufferPtr, cvarNameBufferPtr);
-        var retString = Encoding.UTF8.GetString(retBufferPtr, ret);
-        pool.Return(retBuffer);
+      byte* retStackPtr = stackalloc byte[256];
+      var ret = _GetDescription(retStackPtr, 256, cvarNameBufferPtr);
+      if (ret <= 256) {
+        var retString = Encoding.UTF8.GetString(retStackPtr, ret);
         pool.Return(cvarNameBuffer);
         return retString;
       }
+      while (true) {
+        var retBuffer = pool.Rent(ret);
+        fixed (byte* retBufferPtr = retBuffer) {
+          var retSize = _GetDescription(retBufferPtr, retBuffer.Length, cvarNameBufferPtr);
+          if (retSize <= retBuffer.Length) {
+            ret = retSize;
+            var retString = Encoding.UTF8.GetString(retBufferPtr, ret);
+            pool.Return(retBuffer);
+            pool.Return(cvarNameBuffer);
+            return retString;
+          }
+          ret = retSize;
+        }
+        pool.Return(retBuffer);
+      }
     }
   }
 }
\ No newline at end of file
@@ -10,6 +10,17 @@ namespace SwiftlyS2.Core.Natives;
 
 internal static class NativeCore {
 
+  unsafe static NativeCore() {
+    _PluginManualLoadState = (delegate* unmanaged<byte>)NativeTable.Get(159);
+    _PluginLoadOrder = (delegate* unmanaged<byte*, int, int>)NativeTable.Get(158);
+    _EnableProfilerByDefault = (delegate* unmanaged<byte>)NativeTable.Get(151);
+    _BeginTimelinePhase = (delegate* unmanaged<byte*, byte*, void>)NativeTable.Get(150);
+    _EndTimelinePhase = (delegate* unmanaged<void>)NativeTable.Get(152);
+    _GetTimelineSummary = (delegate* unmanaged<byte*, int, int>)NativeTable.Get(156);
+    _ExportTimeline = (delegate* unmanaged<byte*, int, int>)NativeTable.Get(153);
+    _InternString = (delegate* unmanaged<byte*, uint>)NativeTable.Get(157);
+  }
+
   private unsafe static delegate* unmanaged<byte> _PluginManualLoadState;
 
   public unsafe static bool PluginManualLoadState() {
@@ -17,17 +28,29 @@ internal static class NativeCore {
     return ret == 1;
   }
 
-  private unsafe static delegate* unmanaged<byte*, int> _PluginLoadOrder;
+  private unsafe static delegate* unmanaged<byte*, int, int> _PluginLoadOrder;
 
   public unsafe static string PluginLoadOrder() {
-    var ret = _PluginLoadOrder(null);
+    byte* retStackPtr = stackalloc byte[256];
+    var ret = _PluginLoadOrder(retStackPtr, 256);
+    if (ret <= 256) {
+      var retString = Encoding.UTF8.GetString(retStackPtr, ret);
+      return retString;
+    }
     var pool = ArrayPool<byte>.Shared;
-    var retBuffer = pool.Rent(ret + 1);
-    fixed (byte* retBufferPtr = retBuffer) {
-      ret = _PluginLoadOrder(retBufferPtr);
-      var retString = Encoding.UTF8.GetString(retBufferPtr, ret);
+    while (true) {
+      var retBuffer = pool.Rent(ret);
+      fixed (byte* retBufferPtr = retBuffer) {
+        var retSize = _PluginLoadOrder(retBufferPtr, retBuffer.Length);
+        if (retSize <= retBuffer.Length) {
+          ret = retSize;
+          var retString = Encoding.UTF8.GetString(retBufferPtr, ret);
+          pool.Return(retBuffer);
+          return retString;
+        }
+        ret = retSize;
+      }
       pool.Return(retBuffer);
-      return retString;
     }
   }
 
@@ -37,4 +60,107 @@ internal static class NativeCore {
     var ret = _EnableProfilerByDefault();
     return ret == 1;
   }
+
+  private unsafe static delegate* unmanaged<byte*, byte*, void> _BeginTimelinePhase;
+
+  /// <summary>
+  /// phases nest, they show up in `sw timeline` and in its saved trace
+  /// </summary>
+  public unsafe static void BeginTimelinePhase(string name, string category) {
+    var pool = ArrayPool<byte>.Shared;
+    var nameLength = Encoding.UTF8.GetByteCount(name);
+    var nameBuffer = pool.Rent(nameLength + 1);
+    Encoding.UTF8.GetBytes(name, nameBuffer);
+    nameBuffer[nameLength] = 0;
+    var categoryLength = Encoding.UTF8.GetByteCount(category);
+    var categoryBuffer = pool.Rent(categoryLength + 1);
+    Encoding.UTF8.GetBytes(category, categoryBuffer);
+    categoryBuffer[categoryLength] = 0;
+    fixed (byte* nameBufferPtr = nameBuffer) {
+      fixed (byte* categoryBufferPtr = categoryBuffer) {
+        _BeginTimelinePhase(nameBufferPtr, categoryBufferPtr);
+        pool.Return(nameBuffer);
+        pool.Return(categoryBuffer);
+      }
+    }
+  }
+
+  private unsafe static delegate* unmanaged<void> _EndTimelinePhase;
+
+  public unsafe static void EndTimelinePhase() {
+    _EndTimelinePhase();
+  }
+
+  private unsafe static delegate* unmanaged<byte*, int, int> _GetTimelineSummary;
+
+  public unsafe static string GetTimelineSummary() {
+    byte* retStackPtr = stackalloc byte[256];
+    var ret = _GetTimelineSummary(retStackPtr, 256);
+    if (ret <= 256) {
+      var retString = Encoding.UTF8.GetString(retStackPtr, ret);
+      return retString;
+    }
+    var pool = ArrayPool<byte>.Shared;
+    while (true) {
+      var retBuffer = pool.Rent(ret);
+      fixed (byte* retBufferPtr = retBuffer) {
+        var retSize = _GetTimelineSummary(retBufferPtr, retBuffer.Length);
+        if (retSize <= retBuffer.Length) {
+          ret = retSize;
+          var retString = Encoding.UTF8.GetString(retBufferPtr, ret);
+          pool.Return(retBuffer);
+          return retString;
+        }
+        ret = retSize;
+      }
+      pool.Return(retBuffer);
+    }
+  }
+
+  private unsafe static delegate* unmanaged<byte*, int, int> _ExportTimeline;
+
+  /// <summary>
+  /// chrome trace json
+  /// </summary>
+  public unsafe static string ExportTimeline() {
+    byte* retStackPtr = stackalloc byte[256];
+    var ret = _ExportTimeline(retStackPtr, 256);
+    if (ret <= 256) {
+      var retString = Encoding.UTF8.GetString(retStackPtr, ret);
+      return retString;
+    }
+    var pool = ArrayPool<byte>.Shared;
+    while (true) {
+      var retBuffer = pool.Rent(ret);
+      fixed (byte* retBufferPtr = retBuffer) {
+        var retSize = _ExportTimeline(retBufferPtr, retBuffer.Length);
+        if (retSize <= retBuffer.Length) {
+          ret = retSize;
+          var retString = Encoding.UTF8.GetString(retBufferPtr, ret);
+          pool.Return(retBuffer);
+          return retString;
+        }
+        ret = retSize;
+      }
+      pool.Return(retBuffer);
+    }
+  }
+
+  private unsafe static delegate* unmanaged<byte*, uint> _InternString;
+
+  /// <summary>
+  /// stable id for the string, natives taking a key id accept it instead of the string
+  /// </summary>
+  public unsafe static uint InternString(string value) {
+    var pool = ArrayPool<byte>.Shared;
+    var valueLength = Encoding.UTF8.GetByteCount(value);
+    var valueBuffer = pool.Rent(valueLength + 1);
+    Encoding.UTF8.GetBytes(value, valueBuffer);
+    valueBuffer[valueLength] = 0;
+    fixed (byte* valueBufferPtr = valueBuffer) {
+      var ret = _InternString(valueBufferPtr);
+      pool.Return(valueBuffer);
+      return ret;
+    }
+  }
 }
\ No newline at end of file
@@ -10,35 +10,73 @@ namespace SwiftlyS2.Core.Natives;
 
 internal static class NativeDatabase {
 
-  private unsafe static delegate* unmanaged<byte*, int> _GetDefaultDriver;
+  unsafe static NativeDatabase() {
+    _GetDefaultDriver = (delegate* unmanaged<byte*, int, int>)NativeTable.Get(170);
+    _GetDefaultConnectionName = (delegate* unmanaged<byte*, int, int>)NativeTable.Get(169);
+    _GetConnectionDriver = (delegate* unmanaged<byte*, int, byte*, int>)NativeTable.Get(162);
+    _GetConnectionHost = (delegate* unmanaged<byte*, int, byte*, int>)NativeTable.Get(163);
+    _GetConnectionDatabase = (delegate* unmanaged<byte*, int, byte*, int>)NativeTable.Get(161);
+    _GetConnectionUser = (delegate* unmanaged<byte*, int, byte*, int>)NativeTable.Get(168);
+    _GetConnectionPass = (delegate* unmanaged<byte*, int, byte*, int>)NativeTable.Get(164);
+    _GetConnectionTimeout = (delegate* unmanaged<byte*, uint>)NativeTable.Get(167);
+    _GetConnectionPort = (delegate* unmanaged<byte*, ushort>)NativeTable.Get(165);
+    _GetConnectionRawUri = (delegate* unmanaged<byte*, int, byte*, int>)NativeTable.Get(166);
+    _ConnectionExists = (delegate* unmanaged<byte*, byte>)NativeTable.Get(160);
+  }
+
+  private unsafe static delegate* unmanaged<byte*, int, int> _GetDefaultDriver;
 
   public unsafe static string GetDefaultDriver() {
-    var ret = _GetDefaultDriver(null);
+    byte* retStackPtr = stackalloc byte[256];
+    var ret = _GetDefaultDriver(retStackPtr, 256);
+    if (ret <= 256) {
+      var retString = Encoding.UTF8.GetString(retStackPtr, ret);
+      return retString;
+    }
     var pool = ArrayPool<byte>.Shared;
-    var retBuffer = pool.Rent(ret + 1);
-    fixed (byte* retBufferPtr = retBuffer) {
-      ret = _GetDefaultDriver(retBufferPtr);
-      var retString = Encoding.UTF8.GetString(retBufferPtr, ret);
+    while (true) {
+      var retBuffer = pool.Rent(ret);
+      fixed (byte* retBufferPtr = retBuffer) {
+        var retSize = _GetDefaultDriver(retBufferPtr, retBuffer.Length);
+        if (retSize <= retBuffer.Length) {
+          ret = retSize;
+          var retString = Encoding.UTF8.GetString(retBufferPtr, ret);
+          pool.Return(retBuffer);
+          return retString;
+        }
+        ret = retSize;
+      }
       pool.Return(retBuffer);
-      return retString;
     }
   }
 
-  private unsafe static delegate* unmanaged<byte*, int> _GetDefaultConnectionName;
+  private unsafe static delegate* unmanaged<byte*, int, int> _GetDefaultConnectionName;
 
   public unsafe static string GetDefaultConnectionName() {
-    var ret = _GetDefaultConnectionName(null);
+    byte* retStackPtr = stackalloc byte[256];
+    var ret = _GetDefaultConnectionName(retStackPtr, 256);
+    if (ret <= 256) {
+      var retString = Encoding.UTF8.GetString(retStackPtr, ret);
+      return retString;
+    }
     var pool = ArrayPool<byte>.Shared;
-    var retBuffer = pool.Rent(ret + 1);
-    fixed (byte* retBufferPtr = retBuffer) {
-      ret = _GetDefaultConnectionName(retBufferPtr);
-      var retString = Encoding.UTF8.GetString(retBufferPtr, ret);
+    while (true) {
+      var retBuffer = pool.Rent(ret);
+      fixed (byte* retBufferPtr = retBuffer) {
+        var retSize = _GetDefaultConnectionName(retBufferPtr, retBuffer.Length);
+        if (retSize <= retBuffer.Length) {
+          ret = retSize;
+          var retString = Encoding.UTF8.GetString(retBufferPtr, ret);
+          pool.Return(retBuffer);
+          return retString;
+        }
+        ret = retSize;
+      }
       pool.Return(retBuffer);
-      return retString;
     }
   }
 
-  private unsafe static delegate* unmanaged<byte*, byte*, int> _GetConnectionDriver;
+  private unsafe static delegate* unmanaged<byte*, int, byte*, int> _GetConnectionDriver;
 
   public unsafe static string GetConnectionDriver(string connectionName) {
     var pool = ArrayPool<byte>.Shared;
@@ -47,19 +85,32 @@ internal static class NativeDatabase {
     Encoding.UTF8.GetBytes(connectionName, connectionNameBuffer);
     connectionNameBuffer[connectionNameLength] = 0;
     fixed (byte* connectionNameBufferPtr = connectionNameBuffer) {
-      var ret = _GetConnectionDriver(null, connectionNameBufferPtr);
-      var retBuffer = pool.Rent(ret + 1);
-      fixed (byte* retBufferPtr = retBuffer) {
-        ret = _GetConnectionDriver(retBufferPtr, connectionNameBufferPtr);
-        var retString = Encoding.UTF8.GetString(retBufferPtr, ret);
-        pool.Return(retBuffer);
+      byte* retStackPtr = stackalloc byte[256];
+      var ret = _GetConnectionDriver(retStackPtr, 256, connectionNameBufferPtr);
+      if (ret <= 256) {
+        var retString = Encoding.UTF8.GetString(retStackPtr, ret);
         pool.Return(connectionNameBuffer);
         return retString;
       }
+      while (true) {
+        var retBuffer = pool.Rent(ret);
+        fixed (byte* retBufferPtr = retBuffer) {
+          var retSize = _GetConnectionDriver(retBufferPtr, retBuffer.Length, connectionNameBufferPtr);
+          if (retSize <= retBuffer.Length) {
+            ret = retSize;
+            var retString = Encoding.UTF8.GetString(retBufferPtr, ret);
+            pool.Return(retBuffer);
+            pool.Return(connectionNameBuffer);
+            return retString;
+          }
+          ret = retSize;
+        }
+        pool.Return(retBuffer);
+      }
     }
   }
 
-  private unsafe static delegate* unmanaged<byte*, byte*, int> _GetConnectionHost;
+  private unsafe static delegate* unmanaged<byte*, int, byte*, int> _GetConnectionHost;
 
   public unsafe static string GetConnectionHost(string connectionName) {
     var pool = ArrayPool<byte>.Shared;
@@ -68,19 +119,32 @@ internal static class NativeDatabase {
     Encoding.UTF8.GetBytes(connectionName, connectionNameBuffer);
     connectionNameBuffer[connectionNameLength] = 0;
     fixed (byte* connectionNameBufferPtr = connectionNameBuffer) {
-      var ret = _GetConnectionHost(null, connectionNameBufferPtr);
-      var retBuffer = pool.Rent(ret + 1);
-      fixed (byte* retBufferPtr = retBuffer) {
-        ret = _GetConnectionHost(retBufferPtr, connectionNameBufferPtr);
-        var retString = Encoding.UTF8.GetString(retBufferPtr, ret);
-        pool.Return(retBuffer);
+      byte* retStackPtr = stackalloc byte[256];
+      var ret = _GetConnectionHost(retStackPtr, 256, connectionNameBufferPtr);
+      if (ret <= 256) {
+        var retString = Encoding.UTF8.GetString(retStackPtr, ret);
         pool.Return(connectionNameBuffer);
         return retString;
       }
+      while (true) {
+        var retBuffer = pool.Rent(ret);
+        fixed (byte* retBufferPtr = retBuffer) {
+          var retSize = _GetConnectionHost(retBufferPtr, retBuffer.Length, connectionNameBufferPtr);
+          if (retSize <= retBuffer.Length) {
+            ret = retSize;
+            var retString = Encoding.UTF8.GetString(retBufferPtr, ret);
+            pool.Return(retBuffer);
+            pool.Return(connectionNameBuffer);
+            return retString;
+          }
+          ret = retSize;
+        }
+        pool.Return(retBuffer);
+      }
     }
   }
 
-  private unsafe static delegate* unmanaged<byte*, byte*, int> _GetConnectionDatabase;
+  private unsafe static delegate* unmanaged<byte*, int, byte*, int> _GetConnectionDatabase;
 
   public unsafe static string GetConnectionDatabase(string connectionName) {
     var pool = ArrayPool<byte>.Shared;
@@ -89,19 +153,32 @@ internal static class NativeDatabase {
     Encoding.UTF8.GetBytes(connectionName, connectionNameBuffer);
     connectionNameBuffer[connectionNameLength] = 0;
     fixed (byte* connectionNameBufferPtr = connectionNameBuffer) {
-      var ret = _GetConnectionDatabase(null, connectionNameBufferPtr);
-      var retBuffer = pool.Rent(ret + 1);
-      fixed (byte* retBufferPtr = retBuffer) {
-        ret = _GetConnectionDatabase(retBufferPtr, connectionNameBufferPtr);
-        var retString = Encoding.UTF8.GetString(retBufferPtr, ret);
-        pool.Return(retBuffer);
+      byte* retStackPtr = stackalloc byte[256];
+      var ret = _GetConnectionDatabase(retStackPtr, 256, connectionNameBufferPtr);
+      if (ret <= 256) {
+        var retString = Encoding.UTF8.GetString(retStackPtr, ret);
         pool.Return(connectionNameBuffer);
         return retString;
       }
+      while (true) {
+        var retBuffer = pool.Rent(ret);
+        fixed (byte* retBufferPtr = retBuffer) {
+          var retSize = _GetConnectionDatabase(retBufferPtr, retBuffer.Length, connectionNameBufferPtr);
+          if (retSize <= retBuffer.Length) {
+            ret = retSize;
+            var retString = Encoding.UTF8.GetString(retBufferPtr, ret);
+            pool.Return(retBuffer);
+            pool.Return(connectionNameBuffer);
+            return retString;
+          }
+          ret = retSize;
+        }
+        pool.Return(retBuffer);
+      }
     }
   }
 
-  private unsafe static delegate* unmanaged<byte*, byte*, int> _GetConnectionUser;
+  private unsafe static delegate* unmanaged<byte*, int, byte*, int> _GetConnectionUser;
 
   public unsafe static string GetConnectionUser(string connectionName) {
     var pool = ArrayPool<byte>.Shared;
@@ -110,19 +187,32 @@ internal static class NativeDatabase {
     Encoding.UTF8.GetBytes(connectionName, connectionNameBuffer);
     connectionNameBuffer[connectionNameLength] = 0;
     fixed (byte* connectionNameBufferPtr = connectionNameBuffer) {
-      var ret = _GetConnectionUser(null, connectionNameBufferPtr);
-      var retBuffer = pool.Rent(ret + 1);
-      fixed (byte* retBufferPtr = retBuffer) {
-        ret = _GetConnectionUser(retBufferPtr, connectionNameBufferPtr);
-        var retString = Encoding.UTF8.GetString(retBufferPtr, ret);
-        pool.Return(retBuffer);
+      byte* retStackPtr = stackalloc byte[256];
+      var ret = _GetConnectionUser(retStackPtr, 256, connectionNameBufferPtr);
+      if (ret <= 256) {
+        var retString = Encoding.UTF8.GetString(retStackPtr, ret);
         pool.Return(connectionNameBuffer);
         return retString;
       }
+      while (true) {
+        var retBuffer = pool.Rent(ret);
+        fixed (byte* retBufferPtr = retBuffer) {
+          var retSize = _GetConnectionUser(retBufferPtr, retBuffer.Length, connectionNameBufferPtr);
+          if (retSize <= retBuffer.Length) {
+            ret = retSize;
+            var retString = Encoding.UTF8.GetString(retBufferPtr, ret);
+            pool.Return(retBuffer);
+            pool.Return(connectionNameBuffer);
+            return retString;
+          }
+          ret = retSize;
+        }
+        pool.Return(retBuffer);
+      }
     }
   }
 
-  private unsafe static delegate* unmanaged<byte*, byte*, int> _GetConnectionPass;
+  private unsafe static delegate* unmanaged<byte*, int, byte*, int> _GetConnectionPass;
 
   public unsafe static string GetConnectionPass(string connectionName) {
     var pool = ArrayPool<byte>.Shared;
@@ -131,15 +221,28 @@ internal static class NativeDatabase {
     Encoding.UTF8.GetBytes(connectionName, connectionNameBuffer);
     connectionNameBuffer[connectionNameLength] = 0;
     fixed (byte* connectionNameBufferPtr = connectionNameBuffer) {
-      var ret = _GetConnectionPass(null, connectionNameBufferPtr);
-      var retBuffer = pool.Rent(ret + 1);
-      fixed (byte* retBufferPtr = retBuffer) {
-        ret = _GetConnectionPass(retBufferPtr, connectionNameBufferPtr);
-        var retString = Encoding.UTF8.GetString(retBufferPtr, ret);
-        pool.Return(retBuffer);
+      byte* retStackPtr = stackalloc byte[256];
+      var ret = _GetConnectionPass(retStackPtr, 256, connectionNameBufferPtr);
+      if (ret <= 256) {
+        var retString = Encoding.UTF8.GetString(retStackPtr, ret);
         pool.Return(connectionNameBuffer);
         return retString;
       }
+      while (true) {
+        var retBuffer = pool.Rent(ret);
+        fixed (byte* retBufferPtr = retBuffer) {
+          var retSize = _GetConnectionPass(retBufferPtr, retBuffer.Length, connectionNameBufferPtr);
+          if (retSize <= retBuffer.Length) {
+            ret = retSize;
+            var retString = Encoding.UTF8.GetString(retBufferPtr, ret);
+            pool.Return(retBuffer);
+            pool.Return(connectionNameBuffer);
+            return retString;
+          }
+          ret = retSize;
+        }
+        pool.Return(retBuffer);
+      }
     }
   }
 
@@ -173,7 +276,7 @@ internal static class NativeDatabase {
     }
   }
 
-  private unsafe static delegate* unmanaged<byte*, byte*, int> _GetConnectionRawUri;
+  private unsafe static delegate* unmanaged<byte*, int, byte*, int> _GetConnectionRawUri;
 
   public unsafe static string GetConnectionRawUri(string connectionName) {
     var pool = ArrayPool<byte>.Shared;
@@ -182,15 +285,28 @@ internal static class NativeDatabase {
     Encoding.UTF8.GetBytes(connectionName, connectionNameBuffer);
     connectionNameBuffer[connectionNameLength] = 0;
     fixed (byte* connectionNameBufferPtr = connectionNameBuffer) {
-      var ret = _GetConnectionRawUri(null, connectionNameBufferPtr);
-      var retBuffer = pool.Rent(ret + 1);
-      fixed (byte* retBufferPtr = retBuffer) {
-        ret = _GetConnectionRawUri(retBufferPtr, connectionNameBufferPtr);
-        var retString = Encoding.UTF8.GetString(retBufferPtr, ret);
-        pool.Return(retBuffer);
+      byte* retStackPtr = stackalloc byte[256];
+      var ret = _GetConnectionRawUri(retStackPtr, 256, connectionNameBufferPtr);
+      if (ret <= 256) {
+        var retString = Encoding.UTF8.GetString(retStackPtr, ret);
         pool.Return(connectionNameBuffer);
         return retString;
       }
+      while (true) {
+        var retBuffer = pool.Rent(ret);
+        fixed (byte* retBufferPtr = retBuffer) {
+          var retSize = _GetConnectionRawUri(retBufferPtr, retBuffer.Length, connectionNameBufferPtr);
+          if (retSize <= retBuffer.Length) {
+            ret = retSize;
+            var retString = Encoding.UTF8.GetString(retBufferPtr, ret);
+            pool.Return(retBuffer);
+            pool.Return(connectionNameBuffer);
+            return retString;
+          }
+          ret = retSize;
+        }
+        pool.Return(retBuffer);
+      }
     }
   }
 
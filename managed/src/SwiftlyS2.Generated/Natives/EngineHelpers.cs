@@ -10,17 +10,46 @@ namespace SwiftlyS2.Core.Natives;
 
 internal static class NativeEngineHelpers {
 
-  private unsafe static delegate* unmanaged<byte*, int> _GetIP;
+  unsafe static NativeEngineHelpers() {
+    _GetIP = (delegate* unmanaged<byte*, int, int>)NativeTable.Get(177);
+    _IsMapValid = (delegate* unmanaged<byte*, byte>)NativeTable.Get(183);
+    _ExecuteCommand = (delegate* unmanaged<byte*, void>)NativeTable.Get(171);
+    _FindGameSystemByName = (delegate* unmanaged<byte*, nint>)NativeTable.Get(172);
+    _SendMessageToConsole = (delegate* unmanaged<byte*, void>)NativeTable.Get(184);
+    _GetTraceManager = (delegate* unmanaged<nint>)NativeTable.Get(181);
+    _GetCurrentGame = (delegate* unmanaged<byte*, int, int>)NativeTable.Get(174);
+    _GetNativeVersion = (delegate* unmanaged<byte*, int, int>)NativeTable.Get(179);
+    _GetMenuSettings = (delegate* unmanaged<byte*, int, int>)NativeTable.Get(178);
+    _GetGlobalVars = (delegate* unmanaged<nint>)NativeTable.Get(176);
+    _GetNetworkGameServer = (delegate* unmanaged<nint>)NativeTable.Get(180);
+    _GetCSGODirectoryPath = (delegate* unmanaged<byte*, int, int>)NativeTable.Get(173);
+    _GetGameDirectoryPath = (delegate* unmanaged<byte*, int, int>)NativeTable.Get(175);
+    _GetWorkshopId = (delegate* unmanaged<byte*, int, int>)NativeTable.Get(182);
+  }
+
+  private unsafe static delegate* unmanaged<byte*, int, int> _GetIP;
 
   public unsafe static string GetIP() {
-    var ret = _GetIP(null);
+    byte* retStackPtr = stackalloc byte[256];
+    var ret = _GetIP(retStackPtr, 256);
+    if (ret <= 256) {
+      var retString = Encoding.UTF8.GetString(retStackPtr, ret);
+      return retString;
+    }
     var pool = ArrayPool<byte>.Shared;
-    var retBuffer = pool.Rent(ret + 1);
-    fixed (byte* retBufferPtr = retBuffer) {
-      ret = _GetIP(retBufferPtr);
-      var retString = Encoding.UTF8.GetString(retBufferPtr, ret);
+    while (true) {
+      var retBuffer = pool.Rent(ret);
+      fixed (byte* retBufferPtr = retBuffer) {
+        var retSize = _GetIP(retBufferPtr, retBuffer.Length);
+        if (retSize <= retBuffer.Length) {
+          ret = retSize;
+          var retString = Encoding.UTF8.GetString(retBufferPtr, ret);
+          pool.Return(retBuffer);
+          return retString;
+        }
+        ret = retSize;
+      }
       pool.Return(retBuffer);
-      return retString;
     }
   }
 
@@ -95,45 +124,81 @@ internal static class NativeEngineHelpers {
     return ret;
   }
 
-  private unsafe static delegate* unmanaged<byte*, int> _GetCurrentGame;
+  private unsafe static delegate* unmanaged<byte*, int, int> _GetCurrentGame;
 
   public unsafe static string GetCurrentGame() {
-    var ret = _GetCurrentGame(null);
+    byte* retStackPtr = stackalloc byte[256];
+    var ret = _GetCurrentGame(retStackPtr, 256);
+    if (ret <= 256) {
+      var retString = Encoding.UTF8.GetString(retStackPtr, ret);
+      return retString;
+    }
     var pool = ArrayPool<byte>.Shared;
-    var retBuffer = pool.Rent(ret + 1);
-    fixed (byte* retBufferPtr = retBuffer) {
-      ret = _GetCurrentGame(retBufferPtr);
-      var retString = Encoding.UTF8.GetString(retBufferPtr, ret);
+    while (true) {
+      var retBuffer = pool.Rent(ret);
+      fixed (byte* retBufferPtr = retBuffer) {
+        var retSize = _GetCurrentGame(retBufferPtr, retBuffer.Length);
+        if (retSize <= retBuffer.Length) {
+          ret = retSize;
+          var retString = Encoding.UTF8.GetString(retBufferPtr, ret);
+          pool.Return(retBuffer);
+          return retString;
+        }
+        ret = retSize;
+      }
       pool.Return(retBuffer);
-      return retString;
     }
   }
 
-  private unsafe static delegate* unmanaged<byte*, int> _GetNativeVersion;
+  private unsafe static delegate* unmanaged<byte*, int, int> _GetNativeVersion;
 
   public unsafe static string GetNativeVersion() {
-    var ret = _GetNativeVersion(null);
+    byte* retStackPtr = stackalloc byte[256];
+    var ret = _GetNativeVersion(retStackPtr, 256);
+    if (ret <= 256) {
+      var retString = Encoding.UTF8.GetString(retStackPtr, ret);
+      return retString;
+    }
     var pool = ArrayPool<byte>.Shared;
-    var retBuffer = pool.Rent(ret + 1);
-    fixed (byte* retBufferPtr = retBuffer) {
-      ret = _GetNativeVersion(retBufferPtr);
-      var retString = Encoding.UTF8.GetString(retBufferPtr, ret);
+    while (true) {
+      var retBuffer = pool.Rent(ret);
+      fixed (byte* retBufferPtr = retBuffer) {
+        var retSize = _GetNativeVersion(retBufferPtr, retBuffer.Length);
+        if (retSize <= retBuffer.Length) {
+          ret = retSize;
+          var retString = Encoding.UTF8.GetString(retBufferPtr, ret);
+          pool.Return(retBuffer);
+          return retString;
+        }
+        ret = retSize;
+      }
       pool.Return(retBuffer);
-      return retString;
     }
   }
 
-  private unsafe static delegate* unmanaged<byte*, int> _GetMenuSettings;
+  private unsafe static delegate* unmanaged<byte*, int, int> _GetMenuSettings;
 
   public unsafe static string GetMenuSettings() {
-    var ret = _GetMenuSettings(null);
+    byte* retStackPtr = stackalloc byte[256];
+    var ret = _GetMenuSettings(retStackPtr, 256);
+    if (ret <= 256) {
+      var retString = Encoding.UTF8.GetString(retStackPtr, ret);
+      return retString;
+    }
     var pool = ArrayPool<byte>.Shared;
-    var retBuffer = pool.Rent(ret + 1);
-    fixed (byte* retBufferPtr = retBuffer) {
-      ret = _GetMenuSettings(retBufferPtr);
-      var retString = Encoding.UTF8.GetString(retBufferPtr, ret);
+    while (true) {
+      var retBuffer = pool.Rent(ret);
+      fixed (byte* retBufferPtr = retBuffer) {
+        var retSize = _GetMenuSettings(retBufferPtr, retBuffer.Length);
+        if (retSize <= retBuffer.Length) {
+          ret = retSize;
+          var retString = Encoding.UTF8.GetString(retBufferPtr, ret);
+          pool.Return(retBuffer);
+          return retString;
+        }
+        ret = retSize;
+      }
       pool.Return(retBuffer);
-      return retString;
     }
   }
 
@@ -151,45 +216,81 @@ internal static class NativeEngineHelpers {
     return ret;
   }
 
-  private unsafe static delegate* unmanaged<byte*, int> _GetCSGODirectoryPath;
+  private unsafe static delegate* unmanaged<byte*, int, int> _GetCSGODirectoryPath;
 
   public unsafe static string GetCSGODirectoryPath() {
-    var ret = _GetCSGODirectoryPath(null);
+    byte* retStackPtr = stackalloc byte[256];
+    var ret = _GetCSGODirectoryPath(retStackPtr, 256);
+    if (ret <= 256) {
+      var retString = Encoding.UTF8.GetString(retStackPtr, ret);
+      return retString;
+    }
     var pool = ArrayPool<byte>.Shared;
-    var retBuffer = pool.Rent(ret + 1);
-    fixed (byte* retBufferPtr = retBuffer) {
-      ret = _GetCSGODirectoryPath(retBufferPtr);
-      var retString = Encoding.UTF8.GetString(retBufferPtr, ret);
+    while (true) {
+      var retBuffer = pool.Rent(ret);
+      fixed (byte* retBufferPtr = retBuffer) {
+        var retSize = _GetCSGODirectoryPath(retBufferPtr, retBuffer.Length);
+        if (retSize <= retBuffer.Length) {
+          ret = retSize;
+          var retString = Encoding.UTF8.GetString(retBufferPtr, ret);
+          pool.Return(retBuffer);
+          return retString;
+        }
+        ret = retSize;
+      }
       pool.Return(retBuffer);
-      return retString;
     }
   }
 
-  private unsafe static delegate* unmanaged<byte*, int> _GetGameDirectoryPath;
+  private unsafe static delegate* unmanaged<byte*, int, int> _GetGameDirectoryPath;
 
   public unsafe static string GetGameDirectoryPath() {
-    var ret = _GetGameDirectoryPath(null);
+    byte* retStackPtr = stackalloc byte[256];
+    var ret = _GetGameDirectoryPath(retStackPtr, 256);
+    if (ret <= 256) {
+      var retString = Encoding.UTF8.GetString(retStackPtr, ret);
+      return retString;
+    }
     var pool = ArrayPool<byte>.Shared;
-    var retBuffer = pool.Rent(ret + 1);
-    fixed (byte* retBufferPtr = retBuffer) {
-      ret = _GetGameDirectoryPath(retBufferPtr);
-      var retString = Encoding.UTF8.GetString(retBufferPtr, ret);
+    while (true) {
+      var retBuffer = pool.Rent(ret);
+      fixed (byte* retBufferPtr = retBuffer) {
+        var retSize = _GetGameDirectoryPath(retBufferPtr, retBuffer.Length);
+        if (retSize <= retBuffer.Length) {
+          ret = retSize;
+          var retString = Encoding.UTF8.GetString(retBufferPtr, ret);
+          pool.Return(retBuffer);
+          return retString;
+        }
+        ret = retSize;
+      }
       pool.Return(retBuffer);
-      return retString;
     }
   }
 
-  private unsafe static delegate* unmanaged<byte*, int> _GetWorkshopId;
+  private unsafe static delegate* unmanaged<byte*, int, int> _GetWorkshopId;
 
   public unsafe static string GetWorkshopId() {
-    var ret = _GetWorkshopId(null);
+    byte* retStackPtr = stackalloc byte[256];
+    var ret = _GetWorkshopId(retStackPtr, 256);
+    if (ret <= 256) {
+      var retString = Encoding.UTF8.GetString(retStackPtr, ret);
+      return retString;
+    }
     var pool = ArrayPool<byte>.Shared;
-    var retBuffer = pool.Rent(ret + 1);
-    fixed (byte* retBufferPtr = retBuffer) {
-      ret = _GetWorkshopId(retBufferPtr);
-      var retString = Encoding.UTF8.GetString(retBufferPtr, ret);
+    while (true) {
+      var retBuffer = pool.Rent(ret);
+      fixed (byte* retBufferPtr = retBuffer) {
+        var retSize = _GetWorkshopId(retBufferPtr, retBuffer.Length);
+        if (retSize <= retBuffer.Length) {
+          ret = retSize;
+          var retString = Encoding.UTF8.GetString(retBufferPtr, ret);
+          pool.Return(retBuffer);
+          return retString;
+        }
+        ret = retSize;
+      }
       pool.Return(retBuffer);
-      return retString;
     }
   }
 }
\ No newline at end of file
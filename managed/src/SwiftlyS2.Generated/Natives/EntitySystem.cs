@@ -10,6 +10,26 @@ namespace SwiftlyS2.Core.Natives;
 
 internal static class NativeEntitySystem {
 
+  unsafe static NativeEntitySystem() {
+    _Spawn = (delegate* unmanaged<nint, nint, void>)NativeTable.Get(200);
+    _Despawn = (delegate* unmanaged<nint, void>)NativeTable.Get(188);
+    _CreateEntityByName = (delegate* unmanaged<byte*, nint>)NativeTable.Get(187);
+    _AcceptInput = (delegate* unmanaged<nint, byte*, nint, nint, nint, int, void>)NativeTable.Get(185);
+    _AddEntityIOEvent = (delegate* unmanaged<nint, byte*, nint, nint, nint, float, void>)NativeTable.Get(186);
+    _IsValidEntity = (delegate* unmanaged<nint, byte>)NativeTable.Get(199);
+    _GetGameRules = (delegate* unmanaged<nint>)NativeTable.Get(195);
+    _GetEntitySystem = (delegate* unmanaged<nint>)NativeTable.Get(193);
+    _EntityHandleIsValid = (delegate* unmanaged<uint, byte>)NativeTable.Get(190);
+    _EntityHandleGet = (delegate* unmanaged<uint, nint>)NativeTable.Get(189);
+    _GetEntityHandleFromEntity = (delegate* unmanaged<nint, uint>)NativeTable.Get(192);
+    _GetFirstActiveEntity = (delegate* unmanaged<nint>)NativeTable.Get(194);
+    _HookEntityOutput = (delegate* unmanaged<byte*, byte*, nint, ulong>)NativeTable.Get(196);
+    _HookEntityOutputFiltered = (delegate* unmanaged<byte*, byte*, uint, uint, byte*, nint, ulong>)NativeTable.Get(197);
+    _UnhookEntityOutput = (delegate* unmanaged<ulong, void>)NativeTable.Get(201);
+    _GetEntityByIndex = (delegate* unmanaged<uint, nint>)NativeTable.Get(191);
+    _IsValid = (delegate* unmanaged<byte>)NativeTable.Get(198);
+  }
+
   private unsafe static delegate* unmanaged<nint, nint, void> _Spawn;
 
   public unsafe static void Spawn(nint entity, nint keyvalues) {
@@ -151,6 +171,38 @@ internal static class NativeEntitySystem {
     }
   }
 
+  private unsafe static delegate* unmanaged<byte*, byte*, uint, uint, byte*, nint, ulong> _HookEntityOutputFiltered;
+
+  /// <summary>
+  /// CEntityIOOutput*, string outputName, CEntityInstance* activator, CEntityInstance* caller, CVariant* value, float delay -> int (HookResult), 0xFFFFFFFF handles and an empty activatorClassName match anything
+  /// </summary>
+  public unsafe static ulong HookEntityOutputFiltered(string className, string outputName, uint callerHandle, uint activatorHandle, string activatorClassName, nint callback) {
+    var pool = ArrayPool<byte>.Shared;
+    var classNameLength = Encoding.UTF8.GetByteCount(className);
+    var classNameBuffer = pool.Rent(classNameLength + 1);
+    Encoding.UTF8.GetBytes(className, classNameBuffer);
+    classNameBuffer[classNameLength] = 0;
+    var outputNameLength = Encoding.UTF8.GetByteCount(outputName);
+    var outputNameBuffer = pool.Rent(outputNameLength + 1);
+    Encoding.UTF8.GetBytes(outputName, outputNameBuffer);
+    outputNameBuffer[outputNameLength] = 0;
+    var activatorClassNameLength = Encoding.UTF8.GetByteCount(activatorClassName);
+    var activatorClassNameBuffer = pool.Rent(activatorClassNameLength + 1);
+    Encoding.UTF8.GetBytes(activatorClassName, activatorClassNameBuffer);
+    activatorClassNameBuffer[activatorClassNameLength] = 0;
+    fixed (byte* classNameBufferPtr = classNameBuffer) {
+      fixed (byte* outputNameBufferPtr = outputNameBuffer) {
+        fixed (byte* activatorClassNameBufferPtr = activatorClassNameBuffer) {
+          var ret = _HookEntityOutputFiltered(classNameBufferPtr, outputNameBufferPtr, callerHandle, activatorHandle, activatorClassNameBufferPtr, callback);
+          pool.Return(classNameBuffer);
+          pool.Return(outputNameBuffer);
+          pool.Return(activatorClassNameBuffer);
+          return ret;
+        }
+      }
+    }
+  }
+
   private unsafe static delegate* unmanaged<ulong, void> _UnhookEntityOutput;
 
   public unsafe static void UnhookEntityOutput(ulong hookid) {
@@ -10,6 +10,27 @@ namespace SwiftlyS2.Core.Natives;
 
 internal static class NativeEvents {
 
+  unsafe static NativeEvents() {
+    _RegisterOnGameTickCallback = (delegate* unmanaged<nint, void>)NativeTable.Get(214);
+    _RegisterOnClientConnectCallback = (delegate* unmanaged<nint, void>)NativeTable.Get(202);
+    _RegisterOnClientDisconnectCallback = (delegate* unmanaged<nint, void>)NativeTable.Get(203);
+    _RegisterOnClientKeyStateChangedCallback = (delegate* unmanaged<nint, void>)NativeTable.Get(204);
+    _RegisterOnClientProcessUsercmdsCallback = (delegate* unmanaged<nint, void>)NativeTable.Get(205);
+    _RegisterOnClientPutInServerCallback = (delegate* unmanaged<nint, void>)NativeTable.Get(206);
+    _RegisterOnClientSteamAuthorizeCallback = (delegate* unmanaged<nint, void>)NativeTable.Get(207);
+    _RegisterOnClientSteamAuthorizeFailCallback = (delegate* unmanaged<nint, void>)NativeTable.Get(208);
+    _RegisterOnEntityCreatedCallback = (delegate* unmanaged<nint, void>)NativeTable.Get(209);
+    _RegisterOnEntityDeletedCallback = (delegate* unmanaged<nint, void>)NativeTable.Get(210);
+    _RegisterOnEntityParentChangedCallback = (delegate* unmanaged<nint, void>)NativeTable.Get(211);
+    _RegisterOnEntitySpawnedCallback = (delegate* unmanaged<nint, void>)NativeTable.Get(212);
+    _RegisterOnMapLoadCallback = (delegate* unmanaged<nint, void>)NativeTable.Get(215);
+    _RegisterOnMapUnloadCallback = (delegate* unmanaged<nint, void>)NativeTable.Get(216);
+    _RegisterOnEntityTakeDamageCallback = (delegate* unmanaged<nint, void>)NativeTable.Get(213);
+    _RegisterOnPrecacheResourceCallback = (delegate* unmanaged<nint, void>)NativeTable.Get(217);
+    _RegisterOnPreworldUpdateCallback = (delegate* unmanaged<nint, void>)NativeTable.Get(218);
+    _RegisterOnStartupServerCallback = (delegate* unmanaged<nint, void>)NativeTable.Get(219);
+  }
+
   private unsafe static delegate* unmanaged<nint, void> _RegisterOnGameTickCallback;
 
   /// <summary>
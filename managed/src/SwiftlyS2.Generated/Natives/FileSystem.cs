@@ -10,7 +10,23 @@ namespace SwiftlyS2.Core.Natives;
 
 internal static class NativeFileSystem {
 
-  private unsafe static delegate* unmanaged<byte*, byte*, int, int, int> _GetSearchPath;
+  unsafe static NativeFileSystem() {
+    _GetSearchPath = (delegate* unmanaged<byte*, int, byte*, int, int, int>)NativeTable.Get(224);
+    _AddSearchPath = (delegate* unmanaged<byte*, byte*, int, int, void>)NativeTable.Get(220);
+    _RemoveSearchPath = (delegate* unmanaged<byte*, byte*, byte>)NativeTable.Get(230);
+    _FileExists = (delegate* unmanaged<byte*, byte*, byte>)NativeTable.Get(221);
+    _IsDirectory = (delegate* unmanaged<byte*, byte*, byte>)NativeTable.Get(225);
+    _PrintSearchPaths = (delegate* unmanaged<void>)NativeTable.Get(228);
+    _ReadFile = (delegate* unmanaged<byte*, int, byte*, byte*, int>)NativeTable.Get(229);
+    _WriteFile = (delegate* unmanaged<byte*, byte*, byte*, byte>)NativeTable.Get(232);
+    _GetFileSize = (delegate* unmanaged<byte*, byte*, uint>)NativeTable.Get(223);
+    _PrecacheFile = (delegate* unmanaged<byte*, byte*, byte>)NativeTable.Get(227);
+    _IsFileWritable = (delegate* unmanaged<byte*, byte*, byte>)NativeTable.Get(226);
+    _SetFileWritable = (delegate* unmanaged<byte*, byte*, byte, byte>)NativeTable.Get(231);
+    _FindFileAbsoluteList = (delegate* unmanaged<nint, byte*, byte*, void>)NativeTable.Get(222);
+  }
+
+  private unsafe static delegate* unmanaged<byte*, int, byte*, int, int, int> _GetSearchPath;
 
   public unsafe static string GetSearchPath(string pathId, int searchPathType, int searchPathsToGet) {
     var pool = ArrayPool<byte>.Shared;
@@ -19,15 +35,28 @@ internal static class NativeFileSystem {
     Encoding.UTF8.GetBytes(pathId, pathIdBuffer);
     pathIdBuffer[pathIdLength] = 0;
     fixed (byte* pathIdBufferPtr = pathIdBuffer) {
-      var ret = _GetSearchPath(null, pathIdBufferPtr, searchPathType, searchPathsToGet);
-      var retBuffer = pool.Rent(ret + 1);
-      fixed (byte* retBufferPtr = retBuffer) {
-        ret = _GetSearchPath(retBufferPtr, pathIdBufferPtr, searchPathType, searchPathsToGet);
-        var retString = Encoding.UTF8.GetString(retBufferPtr, ret);
-        pool.Return(retBuffer);
+      byte* retStackPtr = stackalloc byte[256];
+      var ret = _GetSearchPath(retStackPtr, 256, pathIdBufferPtr, searchPathType, searchPathsToGet);
+      if (ret <= 256) {
+        var retString = Encoding.UTF8.GetString(retStackPtr, ret);
         pool.Return(pathIdBuffer);
         return retString;
       }
+      while (true) {
+        var retBuffer = pool.Rent(ret);
+        fixed (byte* retBufferPtr = retBuffer) {
+          var retSize = _GetSearchPath(retBufferPtr, retBuffer.Length, pathIdBufferPtr, searchPathType, searchPathsToGet);
+          if (retSize <= retBuffer.Length) {
+            ret = retSize;
+            var retString = Encoding.UTF8.GetString(retBufferPtr, ret);
+            pool.Return(retBuffer);
+            pool.Return(pathIdBuffer);
+            return retString;
+          }
+          ret = retSize;
+        }
+        pool.Return(retBuffer);
+      }
     }
   }
 
@@ -127,7 +156,7 @@ internal static class NativeFileSystem {
     _PrintSearchPaths();
   }
 
-  private unsafe static delegate* unmanaged<byte*, byte*, byte*, int> _ReadFile;
+  private unsafe static delegate* unmanaged<byte*, int, byte*, byte*, int> _ReadFile;
 
   public unsafe static string ReadFile(string fileName, string pathId) {
     var pool = ArrayPool<byte>.Shared;
@@ -141,16 +170,30 @@ internal static class NativeFileSystem {
     pathIdBuffer[pathIdLength] = 0;
     fixed (byte* fileNameBufferPtr = fileNameBuffer) {
       fixed (byte* pathIdBufferPtr = pathIdBuffer) {
-        var ret = _ReadFile(null, fileNameBufferPtr, pathIdBufferPtr);
-        var retBuffer = pool.Rent(ret + 1);
-        fixed (byte* retBufferPtr = retBuffer) {
-          ret = _ReadFile(retBufferPtr, fileNameBufferPtr, pathIdBufferPtr);
-          var retString = Encoding.UTF8.GetString(retBufferPtr, ret);
-          pool.Return(retBuffer);
+        byte* retStackPtr = stackalloc byte[256];
+        var ret = _ReadFile(retStackPtr, 256, fileNameBufferPtr, pathIdBufferPtr);
+        if (ret <= 256) {
+          var retString = Encoding.UTF8.GetString(retStackPtr, ret);
           pool.Return(fileNameBuffer);
           pool.Return(pathIdBuffer);
           return retString;
         }
+        while (true) {
+          var retBuffer = pool.Rent(ret);
+          fixed (byte* retBufferPtr = retBuffer) {
+            var retSize = _ReadFile(retBufferPtr, retBuffer.Length, fileNameBufferPtr, pathIdBufferPtr);
+            if (retSize <= retBuffer.Length) {
+              ret = retSize;
+              var retString = Encoding.UTF8.GetString(retBufferPtr, ret);
+              pool.Return(retBuffer);
+              pool.Return(fileNameBuffer);
+              pool.Return(pathIdBuffer);
+              return retString;
+            }
+            ret = retSize;
+          }
+          pool.Return(retBuffer);
+        }
       }
     }
   }
@@ -10,6 +10,67 @@ namespace SwiftlyS2.Core.Natives;
 
 internal static class NativeGameEvents {
 
+  unsafe static NativeGameEvents() {
+    _GetBool = (delegate* unmanaged<nint, byte*, byte>)NativeTable.Get(239);
+    _GetInt = (delegate* unmanaged<nint, byte*, int>)NativeTable.Get(248);
+    _GetUint64 = (delegate* unmanaged<nint, byte*, ulong>)NativeTable.Get(263);
+    _GetFloat = (delegate* unmanaged<nint, byte*, float>)NativeTable.Get(246);
+    _GetString = (delegate* unmanaged<byte*, int, nint, byte*, int>)NativeTable.Get(261);
+    _GetPtr = (delegate* unmanaged<nint, byte*, nint>)NativeTable.Get(259);
+    _GetEHandle = (delegate* unmanaged<nint, byte*, nint>)NativeTable.Get(241);
+    _GetEntity = (delegate* unmanaged<nint, byte*, nint>)NativeTable.Get(242);
+    _GetEntityIndex = (delegate* unmanaged<nint, byte*, int>)NativeTable.Get(244);
+    _GetPlayerSlot = (delegate* unmanaged<nint, byte*, int>)NativeTable.Get(257);
+    _GetPlayerController = (delegate* unmanaged<nint, byte*, nint>)NativeTable.Get(253);
+    _GetPlayerPawn = (delegate* unmanaged<nint, byte*, nint>)NativeTable.Get(255);
+    _GetPawnEHandle = (delegate* unmanaged<nint, byte*, nint>)NativeTable.Get(250);
+    _GetPawnEntityIndex = (delegate* unmanaged<nint, byte*, int>)NativeTable.Get(251);
+    _SetBool = (delegate* unmanaged<nint, byte*, byte, void>)NativeTable.Get(274);
+    _SetInt = (delegate* unmanaged<nint, byte*, int, void>)NativeTable.Get(282);
+    _SetUint64 = (delegate* unmanaged<nint, byte*, ulong, void>)NativeTable.Get(290);
+    _SetFloat = (delegate* unmanaged<nint, byte*, float, void>)NativeTable.Get(280);
+    _SetString = (delegate* unmanaged<nint, byte*, byte*, void>)NativeTable.Get(288);
+    _SetPtr = (delegate* unmanaged<nint, byte*, nint, void>)NativeTable.Get(286);
+    _SetEntity = (delegate* unmanaged<nint, byte*, nint, void>)NativeTable.Get(276);
+    _SetEntityIndex = (delegate* unmanaged<nint, byte*, int, void>)NativeTable.Get(278);
+    _SetPlayerSlot = (delegate* unmanaged<nint, byte*, int, void>)NativeTable.Get(284);
+    _HasKey = (delegate* unmanaged<nint, byte*, byte>)NativeTable.Get(265);
+    _GetBoolById = (delegate* unmanaged<nint, uint, byte>)NativeTable.Get(240);
+    _GetIntById = (delegate* unmanaged<nint, uint, int>)NativeTable.Get(249);
+    _GetUint64ById = (delegate* unmanaged<nint, uint, ulong>)NativeTable.Get(264);
+    _GetFloatById = (delegate* unmanaged<nint, uint, float>)NativeTable.Get(247);
+    _GetStringById = (delegate* unmanaged<byte*, int, nint, uint, int>)NativeTable.Get(262);
+    _GetPtrById = (delegate* unmanaged<nint, uint, nint>)NativeTable.Get(260);
+    _GetEntityById = (delegate* unmanaged<nint, uint, nint>)NativeTable.Get(243);
+    _GetEntityIndexById = (delegate* unmanaged<nint, uint, int>)NativeTable.Get(245);
+    _GetPlayerSlotById = (delegate* unmanaged<nint, uint, int>)NativeTable.Get(258);
+    _GetPlayerControllerById = (delegate* unmanaged<nint, uint, nint>)NativeTable.Get(254);
+    _GetPlayerPawnById = (delegate* unmanaged<nint, uint, nint>)NativeTable.Get(256);
+    _GetPawnEntityIndexById = (delegate* unmanaged<nint, uint, int>)NativeTable.Get(252);
+    _SetBoolById = (delegate* unmanaged<nint, uint, byte, void>)NativeTable.Get(275);
+    _SetIntById = (delegate* unmanaged<nint, uint, int, void>)NativeTable.Get(283);
+    _SetUint64ById = (delegate* unmanaged<nint, uint, ulong, void>)NativeTable.Get(291);
+    _SetFloatById = (delegate* unmanaged<nint, uint, float, void>)NativeTable.Get(281);
+    _SetStringById = (delegate* unmanaged<nint, uint, byte*, void>)NativeTable.Get(289);
+    _SetPtrById = (delegate* unmanaged<nint, uint, nint, void>)NativeTable.Get(287);
+    _SetEntityById = (delegate* unmanaged<nint, uint, nint, void>)NativeTable.Get(277);
+    _SetEntityIndexById = (delegate* unmanaged<nint, uint, int, void>)NativeTable.Get(279);
+    _SetPlayerSlotById = (delegate* unmanaged<nint, uint, int, void>)NativeTable.Get(285);
+    _IsReliable = (delegate* unmanaged<nint, byte>)NativeTable.Get(270);
+    _IsLocal = (delegate* unmanaged<nint, byte>)NativeTable.Get(267);
+    _RegisterListener = (delegate* unmanaged<byte*, void>)NativeTable.Get(271);
+    _AddListenerPreCallback = (delegate* unmanaged<nint, ulong>)NativeTable.Get(234);
+    _AddListenerPostCallback = (delegate* unmanaged<nint, ulong>)NativeTable.Get(233);
+    _RemoveListenerPreCallback = (delegate* unmanaged<ulong, void>)NativeTable.Get(273);
+    _RemoveListenerPostCallback = (delegate* unmanaged<ulong, void>)NativeTable.Get(272);
+    _CreateEvent = (delegate* unmanaged<byte*, nint>)NativeTable.Get(235);
+    _FreeEvent = (delegate* unmanaged<nint, void>)NativeTable.Get(238);
+    _FireEvent = (delegate* unmanaged<nint, byte, void>)NativeTable.Get(236);
+    _FireEventToClient = (delegate* unmanaged<nint, int, void>)NativeTable.Get(237);
+    _IsPlayerListeningToEventName = (delegate* unmanaged<int, byte*, byte>)NativeTable.Get(269);
+    _IsPlayerListeningToEvent = (delegate* unmanaged<int, nint, byte>)NativeTable.Get(268);
+  }
+
   private unsafe static delegate* unmanaged<nint, byte*, byte> _GetBool;
 
   public unsafe static bool GetBool(nint _event, string key) {
@@ -70,7 +131,7 @@ internal static class NativeGameEvents {
     }
   }
 
-  private unsafe static delegate* unmanaged<byte*, nint, byte*, int> _GetString;
+  private unsafe static delegate* unmanaged<byte*, int, nint, byte*, int> _GetString;
 
   public unsafe static string GetString(nint _event, string key) {
     var pool = ArrayPool<byte>.Shared;
@@ -79,15 +140,28 @@ internal static class NativeGameEvents {
     Encoding.UTF8.GetBytes(key, keyBuffer);
     keyBuffer[keyLength] = 0;
     fixed (byte* keyBufferPtr = keyBuffer) {
-      var ret = _GetString(null, _event, keyBufferPtr);
-      var retBuffer = pool.Rent(ret + 1);
-      fixed (byte* retBufferPtr = retBuffer) {
-        ret = _GetString(retBufferPtr, _event, keyBufferPtr);
-        var retString = Encoding.UTF8.GetString(retBufferPtr, ret);
-        pool.Return(retBuffer);
+      byte* retStackPtr = stackalloc byte[256];
+      var ret = _GetString(retStackPtr, 256, _event, keyBufferPtr);
+      if (ret <= 256) {
+        var retString = Encoding.UTF8.GetString(retStackPtr, ret);
         pool.Return(keyBuffer);
         return retString;
       }
+      while (true) {
+        var retBuffer = pool.Rent(ret);
+        fixed (byte* retBufferPtr = retBuffer) {
+          var retSize = _GetString(retBufferPtr, retBuffer.Length, _event, keyBufferPtr);
+          if (retSize <= retBuffer.Length) {
+            ret = retSize;
+            var retString = Encoding.UTF8.GetString(retBufferPtr, ret);
+            pool.Return(retBuffer);
+            pool.Return(keyBuffer);
+            return retString;
+          }
+          ret = retSize;
+        }
+        pool.Return(retBuffer);
+      }
     }
   }
 
@@ -380,6 +454,174 @@ internal static class NativeGameEvents {
     }
   }
 
+  private unsafe static delegate* unmanaged<nint, uint, byte> _GetBoolById;
+
+  /// <summary>
+  /// the ById variants take a key interned with Core.InternString
+  /// </summary>
+  public unsafe static bool GetBoolById(nint _event, uint keyId) {
+    var ret = _GetBoolById(_event, keyId);
+    return ret == 1;
+  }
+
+  private unsafe static delegate* unmanaged<nint, uint, int> _GetIntById;
+
+  public unsafe static int GetIntById(nint _event, uint keyId) {
+    var ret = _GetIntById(_event, keyId);
+    return ret;
+  }
+
+  private unsafe static delegate* unmanaged<nint, uint, ulong> _GetUint64ById;
+
+  public unsafe static ulong GetUint64ById(nint _event, uint keyId) {
+    var ret = _GetUint64ById(_event, keyId);
+    return ret;
+  }
+
+  private unsafe static delegate* unmanaged<nint, uint, float> _GetFloatById;
+
+  public unsafe static float GetFloatById(nint _event, uint keyId) {
+    var ret = _GetFloatById(_event, keyId);
+    return ret;
+  }
+
+  private unsafe static delegate* unmanaged<byte*, int, nint, uint, int> _GetStringById;
+
+  public unsafe static string GetStringById(nint _event, uint keyId) {
+    byte* retStackPtr = stackalloc byte[256];
+    var ret = _GetStringById(retStackPtr, 256, _event, keyId);
+    if (ret <= 256) {
+      var retString = Encoding.UTF8.GetString(retStackPtr, ret);
+      return retString;
+    }
+    var pool = ArrayPool<byte>.Shared;
+    while (true) {
+      var retBuffer = pool.Rent(ret);
+      fixed (byte* retBufferPtr = retBuffer) {
+        var retSize = _GetStringById(retBufferPtr, retBuffer.Length, _event, keyId);
+        if (retSize <= retBuffer.Length) {
+          ret = retSize;
+          var retString = Encoding.UTF8.GetString(retBufferPtr, ret);
+          pool.Return(retBuffer);
+          return retString;
+        }
+        ret = retSize;
+      }
+      pool.Return(retBuffer);
+    }
+  }
+
+  private unsafe static delegate* unmanaged<nint, uint, nint> _GetPtrById;
+
+  public unsafe static nint GetPtrById(nint _event, uint keyId) {
+    var ret = _GetPtrById(_event, keyId);
+    return ret;
+  }
+
+  private unsafe static delegate* unmanaged<nint, uint, nint> _GetEntityById;
+
+  public unsafe static nint GetEntityById(nint _event, uint keyId) {
+    var ret = _GetEntityById(_event, keyId);
+    return ret;
+  }
+
+  private unsafe static delegate* unmanaged<nint, uint, int> _GetEntityIndexById;
+
+  public unsafe static int GetEntityIndexById(nint _event, uint keyId) {
+    var ret = _GetEntityIndexById(_event, keyId);
+    return ret;
+  }
+
+  private unsafe static delegate* unmanaged<nint, uint, int> _GetPlayerSlotById;
+
+  public unsafe static int GetPlayerSlotById(nint _event, uint keyId) {
+    var ret = _GetPlayerSlotById(_event, keyId);
+    return ret;
+  }
+
+  private unsafe static delegate* unmanaged<nint, uint, nint> _GetPlayerControllerById;
+
+  public unsafe static nint GetPlayerControllerById(nint _event, uint keyId) {
+    var ret = _GetPlayerControllerById(_event, keyId);
+    return ret;
+  }
+
+  private unsafe static delegate* unmanaged<nint, uint, nint> _GetPlayerPawnById;
+
+  public unsafe static nint GetPlayerPawnById(nint _event, uint keyId) {
+    var ret = _GetPlayerPawnById(_event, keyId);
+    return ret;
+  }
+
+  private unsafe static delegate* unmanaged<nint, uint, int> _GetPawnEntityIndexById;
+
+  public unsafe static int GetPawnEntityIndexById(nint _event, uint keyId) {
+    var ret = _GetPawnEntityIndexById(_event, keyId);
+    return ret;
+  }
+
+  private unsafe static delegate* unmanaged<nint, uint, byte, void> _SetBoolById;
+
+  public unsafe static void SetBoolById(nint _event, uint keyId, bool value) {
+    _SetBoolById(_event, keyId, value ? (byte)1 : (byte)0);
+  }
+
+  private unsafe static delegate* unmanaged<nint, uint, int, void> _SetIntById;
+
+  public unsafe static void SetIntById(nint _event, uint keyId, int value) {
+    _SetIntById(_event, keyId, value);
+  }
+
+  private unsafe static delegate* unmanaged<nint, uint, ulong, void> _SetUint64ById;
+
+  public unsafe static void SetUint64ById(nint _event, uint keyId, ulong value) {
+    _SetUint64ById(_event, keyId, value);
+  }
+
+  private unsafe static delegate* unmanaged<nint, uint, float, void> _SetFloatById;
+
+  public unsafe static void SetFloatById(nint _event, uint keyId, float value) {
+    _SetFloatById(_event, keyId, value);
+  }
+
+  private unsafe static delegate* unmanaged<nint, uint, byte*, void> _SetStringById;
+
+  public unsafe static void SetStringById(nint _event, uint keyId, string value) {
+    var pool = ArrayPool<byte>.Shared;
+    var valueLength = Encoding.UTF8.GetByteCount(value);
+    var valueBuffer = pool.Rent(valueLength + 1);
+    Encoding.UTF8.GetBytes(value, valueBuffer);
+    valueBuffer[valueLength] = 0;
+    fixed (byte* valueBufferPtr = valueBuffer) {
+      _SetStringById(_event, keyId, valueBufferPtr);
+      pool.Return(valueBuffer);
+    }
+  }
+
+  private unsafe static delegate* unmanaged<nint, uint, nint, void> _SetPtrById;
+
+  public unsafe static void SetPtrById(nint _event, uint keyId, nint value) {
+    _SetPtrById(_event, keyId, value);
+  }
+
+  private unsafe static delegate* unmanaged<nint, uint, nint, void> _SetEntityById;
+
+  public unsafe static void SetEntityById(nint _event, uint keyId, nint value) {
+    _SetEntityById(_event, keyId, value);
+  }
+
+  private unsafe static delegate* unmanaged<nint, uint, int, void> _SetEntityIndexById;
+
+  public unsafe static void SetEntityIndexById(nint _event, uint keyId, int value) {
+    _SetEntityIndexById(_event, keyId, value);
+  }
+
+  private unsafe static delegate* unmanaged<nint, uint, int, void> _SetPlayerSlotById;
+
+  public unsafe static void SetPlayerSlotById(nint _event, uint keyId, int value) {
+    _SetPlayerSlotById(_event, keyId, value);
+  }
+
   private unsafe static delegate* unmanaged<nint, byte> _IsReliable;
 
   public unsafe static bool IsReliable(nint _event) {
@@ -10,6 +10,41 @@ namespace SwiftlyS2.Core.Natives;
 
 internal static class NativeHooks {
 
+  unsafe static NativeHooks() {
+    _AllocateHook = (delegate* unmanaged<nint>)NativeTable.Get(294);
+    _AllocateVHook = (delegate* unmanaged<nint>)NativeTable.Get(296);
+    _AllocateMHook = (delegate* unmanaged<nint>)NativeTable.Get(295);
+    _DeallocateHook = (delegate* unmanaged<nint, void>)NativeTable.Get(299);
+    _DeallocateVHook = (delegate* unmanaged<nint, void>)NativeTable.Get(301);
+    _DeallocateMHook = (delegate* unmanaged<nint, void>)NativeTable.Get(300);
+    _SetHook = (delegate* unmanaged<nint, nint, nint, void>)NativeTable.Get(320);
+    _SetVHook = (delegate* unmanaged<nint, nint, int, nint, byte, void>)NativeTable.Get(323);
+    _SetMHook = (delegate* unmanaged<nint, nint, nint, void>)NativeTable.Get(322);
+    _EnableHook = (delegate* unmanaged<nint, void>)NativeTable.Get(305);
+    _EnableVHook = (delegate* unmanaged<nint, void>)NativeTable.Get(308);
+    _EnableMHook = (delegate* unmanaged<nint, void>)NativeTable.Get(306);
+    _DisableHook = (delegate* unmanaged<nint, void>)NativeTable.Get(302);
+    _DisableVHook = (delegate* unmanaged<nint, void>)NativeTable.Get(304);
+    _DisableMHook = (delegate* unmanaged<nint, void>)NativeTable.Get(303);
+    _IsHookEnabled = (delegate* unmanaged<nint, byte>)NativeTable.Get(314);
+    _IsVHookEnabled = (delegate* unmanaged<nint, byte>)NativeTable.Get(317);
+    _IsMHookEnabled = (delegate* unmanaged<nint, byte>)NativeTable.Get(315);
+    _GetHookOriginal = (delegate* unmanaged<nint, nint>)NativeTable.Get(311);
+    _GetVHookOriginal = (delegate* unmanaged<nint, nint>)NativeTable.Get(313);
+    _AddHookListener = (delegate* unmanaged<nint, nint, int, ulong>)NativeTable.Get(292);
+    _AddHookListenerFiltered = (delegate* unmanaged<nint, nint, int, nint, int, ulong>)NativeTable.Get(293);
+    _RemoveHookListener = (delegate* unmanaged<ulong, void>)NativeTable.Get(318);
+    _GetHookListenerNext = (delegate* unmanaged<ulong, nint>)NativeTable.Get(310);
+    _GetHookChainOriginal = (delegate* unmanaged<nint, nint>)NativeTable.Get(309);
+    _BeginTransaction = (delegate* unmanaged<void>)NativeTable.Get(297);
+    _CommitTransaction = (delegate* unmanaged<void>)NativeTable.Get(298);
+    _EnableStats = (delegate* unmanaged<byte, void>)NativeTable.Get(307);
+    _IsStatsEnabled = (delegate* unmanaged<byte>)NativeTable.Get(316);
+    _ResetStats = (delegate* unmanaged<void>)NativeTable.Get(319);
+    _GetStatsReport = (delegate* unmanaged<byte*, int, int>)NativeTable.Get(312);
+    _SetHookListenerOwner = (delegate* unmanaged<ulong, byte*, void>)NativeTable.Get(321);
+  }
+
   private unsafe static delegate* unmanaged<nint> _AllocateHook;
 
   public unsafe static nint AllocateHook() {
@@ -146,4 +181,127 @@ internal static class NativeHooks {
     var ret = _GetVHookOriginal(hook);
     return ret;
   }
+
+  private unsafe static delegate* unmanaged<nint, nint, int, ulong> _AddHookListener;
+
+  /// <summary>
+  /// one detour per target shared by every listener, higher priority runs first. the callback has the exact signature of the function and continues through GetHookListenerNext
+  /// </summary>
+  public unsafe static ulong AddHookListener(nint target, nint callback, int priority) {
+    var ret = _AddHookListener(target, callback, priority);
+    return ret;
+  }
+
+  private unsafe static delegate* unmanaged<nint, nint, int, nint, int, ulong> _AddHookListenerFiltered;
+
+  /// <summary>
+  /// like AddHookListener, conditions points to count HookPredicateCondition structs (int32 argument, int32 op, int32 size, int32 offset, int64 value) that all have to pass for the callback to run
+  /// </summary>
+  public unsafe static ulong AddHookListenerFiltered(nint target, nint callback, int priority, nint conditions, int count) {
+    var ret = _AddHookListenerFiltered(target, callback, priority, conditions, count);
+    return ret;
+  }
+
+  private unsafe static delegate* unmanaged<ulong, void> _RemoveHookListener;
+
+  public unsafe static void RemoveHookListener(ulong listenerId) {
+    _RemoveHookListener(listenerId);
+  }
+
+  private unsafe static delegate* unmanaged<ulong, nint> _GetHookListenerNext;
+
+  public unsafe static nint GetHookListenerNext(ulong listenerId) {
+    var ret = _GetHookListenerNext(listenerId);
+    return ret;
+  }
+
+  private unsafe static delegate* unmanaged<nint, nint> _GetHookChainOriginal;
+
+  /// <summary>
+  /// the unhooked original, null if the target has no listeners
+  /// </summary>
+  public unsafe static nint GetHookChainOriginal(nint target) {
+    var ret = _GetHookChainOriginal(target);
+    return ret;
+  }
+
+  private unsafe static delegate* unmanaged<void> _BeginTransaction;
+
+  /// <summary>
+  /// hooks added until the matching CommitTransaction are patched in together on commit, transactions nest
+  /// </summary>
+  public unsafe static void BeginTransaction() {
+    _BeginTransaction();
+  }
+
+  private unsafe static delegate* unmanaged<void> _CommitTransaction;
+
+  public unsafe static void CommitTransaction() {
+    _CommitTransaction();
+  }
+
+  private unsafe static delegate* unmanaged<byte, void> _EnableStats;
+
+  /// <summary>
+  /// call counts and timings of detours, entity output, net message and game event hooks, free while disabled
+  /// </summary>
+  public unsafe static void EnableStats(bool enable) {
+    _EnableStats(enable ? (byte)1 : (byte)0);
+  }
+
+  private unsafe static delegate* unmanaged<byte> _IsStatsEnabled;
+
+  public unsafe static bool IsStatsEnabled() {
+    var ret = _IsStatsEnabled();
+    return ret == 1;
+  }
+
+  private unsafe static delegate* unmanaged<void> _ResetStats;
+
+  public unsafe static void ResetStats() {
+    _ResetStats();
+  }
+
+  private unsafe static delegate* unmanaged<byte*, int, int> _GetStatsReport;
+
+  public unsafe static string GetStatsReport() {
+    byte* retStackPtr = stackalloc byte[256];
+    var ret = _GetStatsReport(retStackPtr, 256);
+    if (ret <= 256) {
+      var retString = Encoding.UTF8.GetString(retStackPtr, ret);
+      return retString;
+    }
+    var pool = ArrayPool<byte>.Shared;
+    while (true) {
+      var retBuffer = pool.Rent(ret);
+      fixed (byte* retBufferPtr = retBuffer) {
+        var retSize = _GetStatsReport(retBufferPtr, retBuffer.Length);
+        if (retSize <= retBuffer.Length) {
+          ret = retSize;
+          var retString = Encoding.UTF8.GetString(retBufferPtr, ret);
+          pool.Return(retBuffer);
+          return retString;
+        }
+        ret = retSize;
+      }
+      pool.Return(retBuffer);
+    }
+  }
+
+  private unsafe static delegate* unmanaged<ulong, byte*, void> _SetHookListenerOwner;
+
+  /// <summary>
+  /// shown next to the listener in the stats report
+  /// </summary>
+  public unsafe static void SetHookListenerOwner(ulong listenerId, string owner) {
+    var pool = ArrayPool<byte>.Shared;
+    var ownerLength = Encoding.UTF8.GetByteCount(owner);
+    var ownerBuffer = pool.Rent(ownerLength + 1);
+    Encoding.UTF8.GetBytes(owner, ownerBuffer);
+    ownerBuffer[ownerLength] = 0;
+    fixed (byte* ownerBufferPtr = ownerBuffer) {
+      _SetHookListenerOwner(listenerId, ownerBufferPtr);
+      pool.Return(ownerBuffer);
+    }
+  }
 }
\ No newline at end of file
@@ -10,6 +10,11 @@ namespace SwiftlyS2.Core.Natives;
 
 internal static class NativeKeyValuesSystem {
 
+  unsafe static NativeKeyValuesSystem() {
+    _GetSymbolForString = (delegate* unmanaged<byte*, uint>)NativeTable.Get(325);
+    _GetStringForSymbol = (delegate* unmanaged<byte*, int, uint, int>)NativeTable.Get(324);
+  }
+
   private unsafe static delegate* unmanaged<byte*, uint> _GetSymbolForString;
 
   public unsafe static uint GetSymbolForString(string str) {
@@ -25,17 +30,29 @@ internal static class NativeKeyValuesSystem {
     }
   }
 
-  private unsafe static delegate* unmanaged<byte*, uint, int> _GetStringForSymbol;
+  private unsafe static delegate* unmanaged<byte*, int, uint, int> _GetStringForSymbol;
 
   public unsafe static string GetStringForSymbol(uint symbol) {
-    var ret = _GetStringForSymbol(null, symbol);
+    byte* retStackPtr = stackalloc byte[256];
+    var ret = _GetStringForSymbol(retStackPtr, 256, symbol);
+    if (ret <= 256) {
+      var retString = Encoding.UTF8.GetString(retStackPtr, ret);
+      return retString;
+    }
     var pool = ArrayPool<byte>.Shared;
-    var retBuffer = pool.Rent(ret + 1);
-    fixed (byte* retBufferPtr = retBuffer) {
-      ret = _GetStringForSymbol(retBufferPtr, symbol);
-      var retString = Encoding.UTF8.GetString(retBufferPtr, ret);
+    while (true) {
+      var retBuffer = pool.Rent(ret);
+      fixed (byte* retBufferPtr = retBuffer) {
+        var retSize = _GetStringForSymbol(retBufferPtr, retBuffer.Length, symbol);
+        if (retSize <= retBuffer.Length) {
+          ret = retSize;
+          var retString = Encoding.UTF8.GetString(retBufferPtr, ret);
+          pool.Return(retBuffer);
+          return retString;
+        }
+        ret = retSize;
+      }
       pool.Return(retBuffer);
-      return retString;
     }
   }
 }
\ No newline at end of file
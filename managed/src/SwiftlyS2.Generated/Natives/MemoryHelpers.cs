@@ -10,6 +10,16 @@ namespace SwiftlyS2.Core.Natives;
 
 internal static class NativeMemoryHelpers {
 
+  unsafe static NativeMemoryHelpers() {
+    _FetchInterfaceByName = (delegate* unmanaged<byte*, nint>)NativeTable.Get(326);
+    _GetVirtualTableAddress = (delegate* unmanaged<byte*, byte*, nint>)NativeTable.Get(329);
+    _GetVirtualTableAddressNested2 = (delegate* unmanaged<byte*, byte*, byte*, nint>)NativeTable.Get(330);
+    _GetAddressBySignature = (delegate* unmanaged<byte*, byte*, int, byte, nint>)NativeTable.Get(327);
+    _GetObjectPtrVtableName = (delegate* unmanaged<byte*, int, nint, int>)NativeTable.Get(328);
+    _ObjectPtrHasVtable = (delegate* unmanaged<nint, byte>)NativeTable.Get(332);
+    _ObjectPtrHasBaseClass = (delegate* unmanaged<nint, byte*, byte>)NativeTable.Get(331);
+  }
+
   private unsafe static delegate* unmanaged<byte*, nint> _FetchInterfaceByName;
 
   /// <summary>
@@ -101,17 +111,29 @@ internal static class NativeMemoryHelpers {
     }
   }
 
-  private unsafe static delegate* unmanaged<byte*, nint, int> _GetObjectPtrVtableName;
+  private unsafe static delegate* unmanaged<byte*, int, nint, int> _GetObjectPtrVtableName;
 
   public unsafe static string GetObjectPtrVtableName(nint objptr) {
-    var ret = _GetObjectPtrVtableName(null, objptr);
+    byte* retStackPtr = stackalloc byte[256];
+    var ret = _GetObjectPtrVtableName(retStackPtr, 256, objptr);
+    if (ret <= 256) {
+      var retString = Encoding.UTF8.GetString(retStackPtr, ret);
+      return retString;
+    }
     var pool = ArrayPool<byte>.Shared;
-    var retBuffer = pool.Rent(ret + 1);
-    fixed (byte* retBufferPtr = retBuffer) {
-      ret = _GetObjectPtrVtableName(retBufferPtr, objptr);
-      var retString = Encoding.UTF8.GetString(retBufferPtr, ret);
+    while (true) {
+      var retBuffer = pool.Rent(ret);
+      fixed (byte* retBufferPtr = retBuffer) {
+        var retSize = _GetObjectPtrVtableName(retBufferPtr, retBuffer.Length, objptr);
+        if (retSize <= retBuffer.Length) {
+          ret = retSize;
+          var retString = Encoding.UTF8.GetString(retBufferPtr, ret);
+          pool.Return(retBuffer);
+          return retString;
+        }
+        ret = retSize;
+      }
       pool.Return(retBuffer);
-      return retString;
     }
   }
 
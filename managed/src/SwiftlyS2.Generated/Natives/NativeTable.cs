@@ -0,0 +1,16 @@
+namespace SwiftlyS2.Core.Natives;
+
+internal static unsafe class NativeTable {
+  public const int Count = 505;
+  public const ulong NamesHash = 0x0556c433a63af12aUL;
+
+  private static NativeFunction* _table;
+
+  public static void Bind(NativeFunction* table) {
+    _table = table;
+  }
+
+  public static void* Get(int id) {
+    return (void*)_table[id].Function;
+  }
+}
\ No newline at end of file
@@ -10,6 +10,92 @@ namespace SwiftlyS2.Core.Natives;
 
 internal static class NativeNetMessages {
 
+  unsafe static NativeNetMessages() {
+    _AllocateNetMessageByID = (delegate* unmanaged<int, nint>)NativeTable.Get(350);
+    _AllocateNetMessageByPartialName = (delegate* unmanaged<byte*, nint>)NativeTable.Get(351);
+    _DeallocateNetMessage = (delegate* unmanaged<nint, void>)NativeTable.Get(354);
+    _HasField = (delegate* unmanaged<nint, byte*, byte>)NativeTable.Get(384);
+    _GetInt32 = (delegate* unmanaged<nint, byte*, int>)NativeTable.Get(360);
+    _GetRepeatedInt32 = (delegate* unmanaged<nint, byte*, int, int>)NativeTable.Get(370);
+    _SetInt32 = (delegate* unmanaged<nint, byte*, int, void>)NativeTable.Get(395);
+    _SetRepeatedInt32 = (delegate* unmanaged<nint, byte*, int, int, void>)NativeTable.Get(403);
+    _AddInt32 = (delegate* unmanaged<nint, byte*, int, void>)NativeTable.Get(338);
+    _GetInt64 = (delegate* unmanaged<nint, byte*, long>)NativeTable.Get(361);
+    _GetRepeatedInt64 = (delegate* unmanaged<nint, byte*, int, long>)NativeTable.Get(371);
+    _SetInt64 = (delegate* unmanaged<nint, byte*, long, void>)NativeTable.Get(396);
+    _SetRepeatedInt64 = (delegate* unmanaged<nint, byte*, int, long, void>)NativeTable.Get(404);
+    _AddInt64 = (delegate* unmanaged<nint, byte*, long, void>)NativeTable.Get(339);
+    _GetUInt32 = (delegate* unmanaged<nint, byte*, uint>)NativeTable.Get(380);
+    _GetRepeatedUInt32 = (delegate* unmanaged<nint, byte*, int, uint>)NativeTable.Get(375);
+    _SetUInt32 = (delegate* unmanaged<nint, byte*, uint, void>)NativeTable.Get(412);
+    _SetRepeatedUInt32 = (delegate* unmanaged<nint, byte*, int, uint, void>)NativeTable.Get(407);
+    _AddUInt32 = (delegate* unmanaged<nint, byte*, uint, void>)NativeTable.Get(346);
+    _GetUInt64 = (delegate* unmanaged<nint, byte*, ulong>)NativeTable.Get(381);
+    _GetRepeatedUInt64 = (delegate* unmanaged<nint, byte*, int, ulong>)NativeTable.Get(376);
+    _SetUInt64 = (delegate* unmanaged<nint, byte*, ulong, void>)NativeTable.Get(413);
+    _SetRepeatedUInt64 = (delegate* unmanaged<nint, byte*, int, ulong, void>)NativeTable.Get(408);
+    _AddUInt64 = (delegate* unmanaged<nint, byte*, ulong, void>)NativeTable.Get(347);
+    _GetBool = (delegate* unmanaged<nint, byte*, byte>)NativeTable.Get(355);
+    _GetRepeatedBool = (delegate* unmanaged<nint, byte*, int, byte>)NativeTable.Get(364);
+    _SetBool = (delegate* unmanaged<nint, byte*, byte, void>)NativeTable.Get(390);
+    _SetRepeatedBool = (delegate* unmanaged<nint, byte*, int, byte, void>)NativeTable.Get(398);
+    _AddBool = (delegate* unmanaged<nint, byte*, byte, void>)NativeTable.Get(333);
+    _GetFloat = (delegate* unmanaged<nint, byte*, float>)NativeTable.Get(359);
+    _GetRepeatedFloat = (delegate* unmanaged<nint, byte*, int, float>)NativeTable.Get(369);
+    _SetFloat = (delegate* unmanaged<nint, byte*, float, void>)NativeTable.Get(394);
+    _SetRepeatedFloat = (delegate* unmanaged<nint, byte*, int, float, void>)NativeTable.Get(402);
+    _AddFloat = (delegate* unmanaged<nint, byte*, float, void>)NativeTable.Get(337);
+    _GetDouble = (delegate* unmanaged<nint, byte*, double>)NativeTable.Get(358);
+    _GetRepeatedDouble = (delegate* unmanaged<nint, byte*, int, double>)NativeTable.Get(367);
+    _SetDouble = (delegate* unmanaged<nint, byte*, double, void>)NativeTable.Get(393);
+    _SetRepeatedDouble = (delegate* unmanaged<nint, byte*, int, double, void>)NativeTable.Get(401);
+    _AddDouble = (delegate* unmanaged<nint, byte*, double, void>)NativeTable.Get(336);
+    _GetString = (delegate* unmanaged<byte*, int, nint, byte*, int>)NativeTable.Get(379);
+    _GetRepeatedString = (delegate* unmanaged<byte*, int, nint, byte*, int, int>)NativeTable.Get(374);
+    _SetString = (delegate* unmanaged<nint, byte*, byte*, void>)NativeTable.Get(411);
+    _SetRepeatedString = (delegate* unmanaged<nint, byte*, int, byte*, void>)NativeTable.Get(406);
+    _AddString = (delegate* unmanaged<nint, byte*, byte*, void>)NativeTable.Get(345);
+    _GetVector2D = (delegate* unmanaged<nint, byte*, Vector2D>)NativeTable.Get(383);
+    _GetRepeatedVector2D = (delegate* unmanaged<nint, byte*, int, Vector2D>)NativeTable.Get(378);
+    _SetVector2D = (delegate* unmanaged<nint, byte*, Vector2D, void>)NativeTable.Get(415);
+    _SetRepeatedVector2D = (delegate* unmanaged<nint, byte*, int, Vector2D, void>)NativeTable.Get(410);
+    _AddVector2D = (delegate* unmanaged<nint, byte*, Vector2D, void>)NativeTable.Get(349);
+    _GetVector = (delegate* unmanaged<nint, byte*, Vector>)NativeTable.Get(382);
+    _GetRepeatedVector = (delegate* unmanaged<nint, byte*, int, Vector>)NativeTable.Get(377);
+    _SetVector = (delegate* unmanaged<nint, byte*, Vector, void>)NativeTable.Get(414);
+    _SetRepeatedVector = (delegate* unmanaged<nint, byte*, int, Vector, void>)NativeTable.Get(409);
+    _AddVector = (delegate* unmanaged<nint, byte*, Vector, void>)NativeTable.Get(348);
+    _GetColor = (delegate* unmanaged<nint, byte*, Color>)NativeTable.Get(357);
+    _GetRepeatedColor = (delegate* unmanaged<nint, byte*, int, Color>)NativeTable.Get(366);
+    _SetColor = (delegate* unmanaged<nint, byte*, Color, void>)NativeTable.Get(392);
+    _SetRepeatedColor = (delegate* unmanaged<nint, byte*, int, Color, void>)NativeTable.Get(400);
+    _AddColor = (delegate* unmanaged<nint, byte*, Color, void>)NativeTable.Get(335);
+    _GetQAngle = (delegate* unmanaged<nint, byte*, QAngle>)NativeTable.Get(363);
+    _GetRepeatedQAngle = (delegate* unmanaged<nint, byte*, int, QAngle>)NativeTable.Get(373);
+    _SetQAngle = (delegate* unmanaged<nint, byte*, QAngle, void>)NativeTable.Get(397);
+    _SetRepeatedQAngle = (delegate* unmanaged<nint, byte*, int, QAngle, void>)NativeTable.Get(405);
+    _AddQAngle = (delegate* unmanaged<nint, byte*, QAngle, void>)NativeTable.Get(344);
+    _GetBytes = (delegate* unmanaged<byte*, int, nint, byte*, int>)NativeTable.Get(356);
+    _GetRepeatedBytes = (delegate* unmanaged<byte*, int, nint, byte*, int, int>)NativeTable.Get(365);
+    _SetBytes = (delegate* unmanaged<nint, byte*, byte*, int, void>)NativeTable.Get(391);
+    _SetRepeatedBytes = (delegate* unmanaged<nint, byte*, int, byte*, int, void>)NativeTable.Get(399);
+    _AddBytes = (delegate* unmanaged<nint, byte*, byte*, int, void>)NativeTable.Get(334);
+    _GetNestedMessage = (delegate* unmanaged<nint, byte*, nint>)NativeTable.Get(362);
+    _GetRepeatedNestedMessage = (delegate* unmanaged<nint, byte*, int, nint>)NativeTable.Get(372);
+    _AddNestedMessage = (delegate* unmanaged<nint, byte*, nint>)NativeTable.Get(340);
+    _GetRepeatedFieldSize = (delegate* unmanaged<nint, byte*, int>)NativeTable.Get(368);
+    _ClearRepeatedField = (delegate* unmanaged<nint, byte*, void>)NativeTable.Get(353);
+    _Clear = (delegate* unmanaged<nint, void>)NativeTable.Get(352);
+    _SendMessage = (delegate* unmanaged<nint, int, int, void>)NativeTable.Get(388);
+    _SendMessageToPlayers = (delegate* unmanaged<nint, int, ulong, void>)NativeTable.Get(389);
+    _AddNetMessageServerHook = (delegate* unmanaged<nint, ulong>)NativeTable.Get(342);
+    _RemoveNetMessageServerHook = (delegate* unmanaged<ulong, void>)NativeTable.Get(386);
+    _AddNetMessageClientHook = (delegate* unmanaged<nint, ulong>)NativeTable.Get(341);
+    _RemoveNetMessageClientHook = (delegate* unmanaged<ulong, void>)NativeTable.Get(385);
+    _AddNetMessageServerHookInternal = (delegate* unmanaged<nint, ulong>)NativeTable.Get(343);
+    _RemoveNetMessageServerHookInternal = (delegate* unmanaged<ulong, void>)NativeTable.Get(387);
+  }
+
   private unsafe static delegate* unmanaged<int, nint> _AllocateNetMessageByID;
 
   public unsafe static nint AllocateNetMessageByID(int msgid) {
@@ -557,7 +643,7 @@ internal static class NativeNetMessages {
     }
   }
 
-  private unsafe static delegate* unmanaged<byte*, nint, byte*, int> _GetString;
+  private unsafe static delegate* unmanaged<byte*, int, nint, byte*, int> _GetString;
 
   public unsafe static string GetString(nint netmsg, string fieldName) {
     var pool = ArrayPool<byte>.Shared;
@@ -566,19 +652,32 @@ internal static class NativeNetMessages {
     Encoding.UTF8.GetBytes(fieldName, fieldNameBuffer);
     fieldNameBuffer[fieldNameLength] = 0;
     fixed (byte* fieldNameBufferPtr = fieldNameBuffer) {
-      var ret = _GetString(null, netmsg, fieldNameBufferPtr);
-      var retBuffer = pool.Rent(ret + 1);
-      fixed (byte* retBufferPtr = retBuffer) {
-        ret = _GetString(retBufferPtr, netmsg, fieldNameBufferPtr);
-        var retString = Encoding.UTF8.GetString(retBufferPtr, ret);
-        pool.Return(retBuffer);
+      byte* retStackPtr = stackalloc byte[256];
+      var ret = _GetString(retStackPtr, 256, netmsg, fieldNameBufferPtr);
+      if (ret <= 256) {
+        var retString = Encoding.UTF8.GetString(retStackPtr, ret);
         pool.Return(fieldNameBuffer);
         return retString;
       }
+      while (true) {
+        var retBuffer = pool.Rent(ret);
+        fixed (byte* retBufferPtr = retBuffer) {
+          var retSize = _GetString(retBufferPtr, retBuffer.Length, netmsg, fieldNameBufferPtr);
+          if (retSize <= retBuffer.Length) {
+            ret = retSize;
+            var retString = Encoding.UTF8.GetString(retBufferPtr, ret);
+            pool.Return(retBuffer);
+            pool.Return(fieldNameBuffer);
+            return retString;
+          }
+          ret = retSize;
+        }
+        pool.Return(retBuffer);
+      }
     }
   }
 
-  private unsafe static delegate* unmanaged<byte*, nint, byte*, int, int> _GetRepeatedString;
+  private unsafe static delegate* unmanaged<byte*, int, nint, byte*, int, int> _GetRepeatedString;
 
   public unsafe static string GetRepeatedString(nint netmsg, string fieldName, int index) {
     var pool = ArrayPool<byte>.Shared;
@@ -587,15 +686,28 @@ internal static class NativeNetMessages {
     Encoding.UTF8.GetBytes(fieldName, fieldNameBuffer);
     fieldNameBuffer[fieldNameLength] = 0;
     fixed (byte* fieldNameBufferPtr = fieldNameBuffer) {
-      var ret = _GetRepeatedString(null, netmsg, fieldNameBufferPtr, index);
-      var retBuffer = pool.Rent(ret + 1);
-      fixed (byte* retBufferPtr = retBuffer) {
-        ret = _GetRepeatedString(retBufferPtr, netmsg, fieldNameBufferPtr, index);
-        var retString = Encoding.UTF8.GetString(retBufferPtr, ret);
-        pool.Return(retBuffer);
+      byte* retStackPtr = stackalloc byte[256];
+      var ret = _GetRepeatedString(retStackPtr, 256, netmsg, fieldNameBufferPtr, index);
+      if (ret <= 256) {
+        var retString = Encoding.UTF8.GetString(retStackPtr, ret);
         pool.Return(fieldNameBuffer);
         return retString;
       }
+      while (true) {
+        var retBuffer = pool.Rent(ret);
+        fixed (byte* retBufferPtr = retBuffer) {
+          var retSize = _GetRepeatedString(retBufferPtr, retBuffer.Length, netmsg, fieldNameBufferPtr, index);
+          if (retSize <= retBuffer.Length) {
+            ret = retSize;
+            var retString = Encoding.UTF8.GetString(retBufferPtr, ret);
+            pool.Return(retBuffer);
+            pool.Return(fieldNameBuffer);
+            return retString;
+          }
+          ret = retSize;
+        }
+        pool.Return(retBuffer);
+      }
     }
   }
 
@@ -950,7 +1062,7 @@ internal static class NativeNetMessages {
     }
   }
 
-  private unsafe static delegate* unmanaged<byte*, nint, byte*, int> _GetBytes;
+  private unsafe static delegate* unmanaged<byte*, int, nint, byte*, int> _GetBytes;
 
   public unsafe static byte[] GetBytes(nint netmsg, string fieldName) {
     var pool = ArrayPool<byte>.Shared;
@@ -959,20 +1071,32 @@ internal static class NativeNetMessages {
     Encoding.UTF8.GetBytes(fieldName, fieldNameBuffer);
     fieldNameBuffer[fieldNameLength] = 0;
     fixed (byte* fieldNameBufferPtr = fieldNameBuffer) {
-      var ret = _GetBytes(null, netmsg, fieldNameBufferPtr);
-      var retBuffer = pool.Rent(ret + 1);
-      fixed (byte* retBufferPtr = retBuffer) {
-        ret = _GetBytes(retBufferPtr, netmsg, fieldNameBufferPtr);
-        var retBytes = new byte[ret];
-        for (int i = 0; i < ret; i++) retBytes[i] = retBufferPtr[i];
-        pool.Return(retBuffer);
+      byte* retStackPtr = stackalloc byte[256];
+      var ret = _GetBytes(retStackPtr, 256, netmsg, fieldNameBufferPtr);
+      if (ret <= 256) {
+        var retBytes = new ReadOnlySpan<byte>(retStackPtr, ret).ToArray();
         pool.Return(fieldNameBuffer);
         return retBytes;
       }
+      while (true) {
+        var retBuffer = pool.Rent(ret);
+        fixed (byte* retBufferPtr = retBuffer) {
+          var retSize = _GetBytes(retBufferPtr, retBuffer.Length, netmsg, fieldNameBufferPtr);
+          if (retSize <= retBuffer.Length) {
+            ret = retSize;
+            var retBytes = new ReadOnlySpan<byte>(retBufferPtr, ret).ToArray();
+            pool.Return(retBuffer);
+            pool.Return(fieldNameBuffer);
+            return retBytes;
+          }
+          ret = retSize;
+        }
+        pool.Return(retBuffer);
+      }
     }
   }
 
-  private unsafe static delegate* unmanaged<byte*, nint, byte*, int, int> _GetRepeatedBytes;
+  private unsafe static delegate* unmanaged<byte*, int, nint, byte*, int, int> _GetRepeatedBytes;
 
   public unsafe static byte[] GetRepeatedBytes(nint netmsg, string fieldName, int index) {
     var pool = ArrayPool<byte>.Shared;
@@ -981,16 +1105,28 @@ internal static class NativeNetMessages {
     Encoding.UTF8.GetBytes(fieldName, fieldNameBuffer);
     fieldNameBuffer[fieldNameLength] = 0;
     fixed (byte* fieldNameBufferPtr = fieldNameBuffer) {
-      var ret = _GetRepeatedBytes(null, netmsg, fieldNameBufferPtr, index);
-      var retBuffer = pool.Rent(ret + 1);
-      fixed (byte* retBufferPtr = retBuffer) {
-        ret = _GetRepeatedBytes(retBufferPtr, netmsg, fieldNameBufferPtr, index);
-        var retBytes = new byte[ret];
-        for (int i = 0; i < ret; i++) retBytes[i] = retBufferPtr[i];
-        pool.Return(retBuffer);
+      byte* retStackPtr = stackalloc byte[256];
+      var ret = _GetRepeatedBytes(retStackPtr, 256, netmsg, fieldNameBufferPtr, index);
+      if (ret <= 256) {
+        var retBytes = new ReadOnlySpan<byte>(retStackPtr, ret).ToArray();
         pool.Return(fieldNameBuffer);
         return retBytes;
       }
+      while (true) {
+        var retBuffer = pool.Rent(ret);
+        fixed (byte* retBufferPtr = retBuffer) {
+          var retSize = _GetRepeatedBytes(retBufferPtr, retBuffer.Length, netmsg, fieldNameBufferPtr, index);
+          if (retSize <= retBuffer.Length) {
+            ret = retSize;
+            var retBytes = new ReadOnlySpan<byte>(retBufferPtr, ret).ToArray();
+            pool.Return(retBuffer);
+            pool.Return(fieldNameBuffer);
+            return retBytes;
+          }
+          ret = retSize;
+        }
+        pool.Return(retBuffer);
+      }
     }
   }
 
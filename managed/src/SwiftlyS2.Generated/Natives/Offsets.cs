@@ -10,6 +10,11 @@ namespace SwiftlyS2.Core.Natives;
 
 internal static class NativeOffsets {
 
+  unsafe static NativeOffsets() {
+    _Exists = (delegate* unmanaged<byte*, byte>)NativeTable.Get(416);
+    _Fetch = (delegate* unmanaged<byte*, int>)NativeTable.Get(417);
+  }
+
   private unsafe static delegate* unmanaged<byte*, byte> _Exists;
 
   public unsafe static bool Exists(string name) {
@@ -10,6 +10,12 @@ namespace SwiftlyS2.Core.Natives;
 
 internal static class NativePatches {
 
+  unsafe static NativePatches() {
+    _Apply = (delegate* unmanaged<byte*, void>)NativeTable.Get(418);
+    _Revert = (delegate* unmanaged<byte*, void>)NativeTable.Get(420);
+    _Exists = (delegate* unmanaged<byte*, byte>)NativeTable.Get(419);
+  }
+
   private unsafe static delegate* unmanaged<byte*, void> _Apply;
 
   public unsafe static void Apply(string patchName) {
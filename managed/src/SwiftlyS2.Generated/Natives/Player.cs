@@ -10,6 +10,36 @@ namespace SwiftlyS2.Core.Natives;
 
 internal static class NativePlayer {
 
+  unsafe static NativePlayer() {
+    _SendMessage = (delegate* unmanaged<int, int, byte*, int, void>)NativeTable.Get(442);
+    _IsFakeClient = (delegate* unmanaged<int, byte>)NativeTable.Get(437);
+    _IsAuthorized = (delegate* unmanaged<int, byte>)NativeTable.Get(436);
+    _GetConnectedTime = (delegate* unmanaged<int, uint>)NativeTable.Get(425);
+    _GetUnauthorizedSteamID = (delegate* unmanaged<int, ulong>)NativeTable.Get(433);
+    _GetSteamID = (delegate* unmanaged<int, ulong>)NativeTable.Get(432);
+    _GetController = (delegate* unmanaged<int, nint>)NativeTable.Get(426);
+    _GetPawn = (delegate* unmanaged<int, nint>)NativeTable.Get(429);
+    _GetPlayerPawn = (delegate* unmanaged<int, nint>)NativeTable.Get(430);
+    _GetPressedButtons = (delegate* unmanaged<int, ulong>)NativeTable.Get(431);
+    _PerformCommand = (delegate* unmanaged<int, byte*, void>)NativeTable.Get(441);
+    _GetIPAddress = (delegate* unmanaged<byte*, int, int, int>)NativeTable.Get(427);
+    _Kick = (delegate* unmanaged<int, byte*, int, void>)NativeTable.Get(440);
+    _ShouldBlockTransmitEntity = (delegate* unmanaged<int, int, byte, void>)NativeTable.Get(444);
+    _IsTransmitEntityBlocked = (delegate* unmanaged<int, int, byte>)NativeTable.Get(439);
+    _ClearTransmitEntityBlocked = (delegate* unmanaged<int, void>)NativeTable.Get(423);
+    _ChangeTeam = (delegate* unmanaged<int, int, void>)NativeTable.Get(421);
+    _SwitchTeam = (delegate* unmanaged<int, int, void>)NativeTable.Get(445);
+    _TakeDamage = (delegate* unmanaged<int, nint, void>)NativeTable.Get(446);
+    _Teleport = (delegate* unmanaged<int, Vector, QAngle, Vector, void>)NativeTable.Get(447);
+    _GetLanguage = (delegate* unmanaged<byte*, int, int, int>)NativeTable.Get(428);
+    _SetCenterMenuRender = (delegate* unmanaged<int, byte*, void>)NativeTable.Get(443);
+    _ClearCenterMenuRender = (delegate* unmanaged<int, void>)NativeTable.Get(422);
+    _HasMenuShown = (delegate* unmanaged<int, byte>)NativeTable.Get(435);
+    _ExecuteCommand = (delegate* unmanaged<int, byte*, void>)NativeTable.Get(424);
+    _IsFirstSpawn = (delegate* unmanaged<int, byte>)NativeTable.Get(438);
+    _GetUserID = (delegate* unmanaged<int, int>)NativeTable.Get(434);
+  }
+
   private unsafe static delegate* unmanaged<int, int, byte*, int, void> _SendMessage;
 
   public unsafe static void SendMessage(int playerid, int kind, string message, int htmlDuration) {
@@ -107,17 +137,29 @@ internal static class NativePlayer {
     }
   }
 
-  private unsafe static delegate* unmanaged<byte*, int, int> _GetIPAddress;
+  private unsafe static delegate* unmanaged<byte*, int, int, int> _GetIPAddress;
 
   public unsafe static string GetIPAddress(int playerid) {
-    var ret = _GetIPAddress(null, playerid);
+    byte* retStackPtr = stackalloc byte[256];
+    var ret = _GetIPAddress(retStackPtr, 256, playerid);
+    if (ret <= 256) {
+      var retString = Encoding.UTF8.GetString(retStackPtr, ret);
+      return retString;
+    }
     var pool = ArrayPool<byte>.Shared;
-    var retBuffer = pool.Rent(ret + 1);
-    fixed (byte* retBufferPtr = retBuffer) {
-      ret = _GetIPAddress(retBufferPtr, playerid);
-      var retString = Encoding.UTF8.GetString(retBufferPtr, ret);
+    while (true) {
+      var retBuffer = pool.Rent(ret);
+      fixed (byte* retBufferPtr = retBuffer) {
+        var retSize = _GetIPAddress(retBufferPtr, retBuffer.Length, playerid);
+        if (retSize <= retBuffer.Length) {
+          ret = retSize;
+          var retString = Encoding.UTF8.GetString(retBufferPtr, ret);
+          pool.Return(retBuffer);
+          return retString;
+        }
+        ret = retSize;
+      }
       pool.Return(retBuffer);
-      return retString;
     }
   }
 
@@ -193,17 +235,29 @@ internal static class NativePlayer {
     _Teleport(playerid, pos, angle, velocity);
   }
 
-  private unsafe static delegate* unmanaged<byte*, int, int> _GetLanguage;
+  private unsafe static delegate* unmanaged<byte*, int, int, int> _GetLanguage;
 
   public unsafe static string GetLanguage(int playerid) {
-    var ret = _GetLanguage(null, playerid);
+    byte* retStackPtr = stackalloc byte[256];
+    var ret = _GetLanguage(retStackPtr, 256, playerid);
+    if (ret <= 256) {
+      var retString = Encoding.UTF8.GetString(retStackPtr, ret);
+      return retString;
+    }
     var pool = ArrayPool<byte>.Shared;
-    var retBuffer = pool.Rent(ret + 1);
-    fixed (byte* retBufferPtr = retBuffer) {
-      ret = _GetLanguage(retBufferPtr, playerid);
-      var retString = Encoding.UTF8.GetString(retBufferPtr, ret);
+    while (true) {
+      var retBuffer = pool.Rent(ret);
+      fixed (byte* retBufferPtr = retBuffer) {
+        var retSize = _GetLanguage(retBufferPtr, retBuffer.Length, playerid);
+        if (retSize <= retBuffer.Length) {
+          ret = retSize;
+          var retString = Encoding.UTF8.GetString(retBufferPtr, ret);
+          pool.Return(retBuffer);
+          return retString;
+        }
+        ret = retSize;
+      }
       pool.Return(retBuffer);
-      return retString;
     }
   }
 
@@ -10,6 +10,15 @@ namespace SwiftlyS2.Core.Natives;
 
 internal static class NativePlayerManager {
 
+  unsafe static NativePlayerManager() {
+    _IsPlayerOnline = (delegate* unmanaged<int, byte>)NativeTable.Get(451);
+    _GetPlayerCount = (delegate* unmanaged<int>)NativeTable.Get(450);
+    _GetPlayerCap = (delegate* unmanaged<int>)NativeTable.Get(449);
+    _SendMessage = (delegate* unmanaged<int, byte*, int, void>)NativeTable.Get(452);
+    _ShouldBlockTransmitEntity = (delegate* unmanaged<int, byte, void>)NativeTable.Get(453);
+    _ClearAllBlockedTransmitEntity = (delegate* unmanaged<void>)NativeTable.Get(448);
+  }
+
   private unsafe static delegate* unmanaged<int, byte> _IsPlayerOnline;
 
   public unsafe static bool IsPlayerOnline(int playerid) {
@@ -10,6 +10,17 @@ namespace SwiftlyS2.Core.Natives;
 
 internal static class NativeSchema {
 
+  unsafe static NativeSchema() {
+    _SetStateChanged = (delegate* unmanaged<nint, ulong, void>)NativeTable.Get(460);
+    _FindChainOffset = (delegate* unmanaged<byte*, uint>)NativeTable.Get(454);
+    _GetOffset = (delegate* unmanaged<ulong, int>)NativeTable.Get(455);
+    _IsStruct = (delegate* unmanaged<byte*, byte>)NativeTable.Get(459);
+    _IsClassLoaded = (delegate* unmanaged<byte*, byte>)NativeTable.Get(458);
+    _GetPropPtr = (delegate* unmanaged<nint, ulong, nint>)NativeTable.Get(456);
+    _WritePropPtr = (delegate* unmanaged<nint, ulong, nint, uint, void>)NativeTable.Get(461);
+    _GetVData = (delegate* unmanaged<nint, nint>)NativeTable.Get(457);
+  }
+
   private unsafe static delegate* unmanaged<nint, ulong, void> _SetStateChanged;
 
   public unsafe static void SetStateChanged(nint entity, ulong hash) {
@@ -10,17 +10,36 @@ namespace SwiftlyS2.Core.Natives;
 
 internal static class NativeServerHelpers {
 
-  private unsafe static delegate* unmanaged<byte*, int> _GetServerLanguage;
+  unsafe static NativeServerHelpers() {
+    _GetServerLanguage = (delegate* unmanaged<byte*, int, int>)NativeTable.Get(462);
+    _UsePlayerLanguage = (delegate* unmanaged<byte>)NativeTable.Get(465);
+    _IsFollowingServerGuidelines = (delegate* unmanaged<byte>)NativeTable.Get(463);
+    _UseAutoHotReload = (delegate* unmanaged<byte>)NativeTable.Get(464);
+  }
+
+  private unsafe static delegate* unmanaged<byte*, int, int> _GetServerLanguage;
 
   public unsafe static string GetServerLanguage() {
-    var ret = _GetServerLanguage(null);
+    byte* retStackPtr = stackalloc byte[256];
+    var ret = _GetServerLanguage(retStackPtr, 256);
+    if (ret <= 256) {
+      var retString = Encoding.UTF8.GetString(retStackPtr, ret);
+      return retString;
+    }
     var pool = ArrayPool<byte>.Shared;
-    var retBuffer = pool.Rent(ret + 1);
-    fixed (byte* retBufferPtr = retBuffer) {
-      ret = _GetServerLanguage(retBufferPtr);
-      var retString = Encoding.UTF8.GetString(retBufferPtr, ret);
+    while (true) {
+      var retBuffer = pool.Rent(ret);
+      fixed (byte* retBufferPtr = retBuffer) {
+        var retSize = _GetServerLanguage(retBufferPtr, retBuffer.Length);
+        if (retSize <= retBuffer.Length) {
+          ret = retSize;
+          var retString = Encoding.UTF8.GetString(retBufferPtr, ret);
+          pool.Return(retBuffer);
+          return retString;
+        }
+        ret = retSize;
+      }
       pool.Return(retBuffer);
-      return retString;
     }
   }
 
@@ -10,6 +10,11 @@ namespace SwiftlyS2.Core.Natives;
 
 internal static class NativeSignatures {
 
+  unsafe static NativeSignatures() {
+    _Exists = (delegate* unmanaged<byte*, byte>)NativeTable.Get(466);
+    _Fetch = (delegate* unmanaged<byte*, nint>)NativeTable.Get(467);
+  }
+
   private unsafe static delegate* unmanaged<byte*, byte> _Exists;
 
   public unsafe static bool Exists(string signatureName) {
@@ -10,6 +10,35 @@ namespace SwiftlyS2.Core.Natives;
 
 internal static class NativeSounds {
 
+  unsafe static NativeSounds() {
+    _CreateSoundEvent = (delegate* unmanaged<nint>)NativeTable.Get(471);
+    _DestroySoundEvent = (delegate* unmanaged<nint, void>)NativeTable.Get(472);
+    _Emit = (delegate* unmanaged<nint, uint>)NativeTable.Get(473);
+    _SetName = (delegate* unmanaged<nint, byte*, void>)NativeTable.Get(490);
+    _GetName = (delegate* unmanaged<byte*, int, nint, int>)NativeTable.Get(479);
+    _SetSourceEntityIndex = (delegate* unmanaged<nint, int, void>)NativeTable.Get(491);
+    _GetSourceEntityIndex = (delegate* unmanaged<nint, int>)NativeTable.Get(480);
+    _AddClient = (delegate* unmanaged<nint, int, void>)NativeTable.Get(469);
+    _RemoveClient = (delegate* unmanaged<nint, int, void>)NativeTable.Get(484);
+    _ClearClients = (delegate* unmanaged<nint, void>)NativeTable.Get(470);
+    _AddAllClients = (delegate* unmanaged<nint, void>)NativeTable.Get(468);
+    _HasField = (delegate* unmanaged<nint, byte*, byte>)NativeTable.Get(483);
+    _SetBool = (delegate* unmanaged<nint, byte*, byte, void>)NativeTable.Get(485);
+    _GetBool = (delegate* unmanaged<nint, byte*, byte>)NativeTable.Get(474);
+    _SetInt32 = (delegate* unmanaged<nint, byte*, int, void>)NativeTable.Get(489);
+    _GetInt32 = (delegate* unmanaged<nint, byte*, int>)NativeTable.Get(478);
+    _SetUInt32 = (delegate* unmanaged<nint, byte*, uint, void>)NativeTable.Get(492);
+    _GetUInt32 = (delegate* unmanaged<nint, byte*, uint>)NativeTable.Get(481);
+    _SetUInt64 = (delegate* unmanaged<nint, byte*, ulong, void>)NativeTable.Get(493);
+    _GetUInt64 = (delegate* unmanaged<nint, byte*, ulong>)NativeTable.Get(482);
+    _SetFloat = (delegate* unmanaged<nint, byte*, float, void>)NativeTable.Get(487);
+    _GetFloat = (delegate* unmanaged<nint, byte*, float>)NativeTable.Get(476);
+    _SetFloat3 = (delegate* unmanaged<nint, byte*, Vector, void>)NativeTable.Get(488);
+    _GetFloat3 = (delegate* unmanaged<nint, byte*, Vector>)NativeTable.Get(477);
+    _GetClients = (delegate* unmanaged<nint, ulong>)NativeTable.Get(475);
+    _SetClients = (delegate* unmanaged<nint, ulong, void>)NativeTable.Get(486);
+  }
+
   private unsafe static delegate* unmanaged<nint> _CreateSoundEvent;
 
   public unsafe static nint CreateSoundEvent() {
@@ -47,17 +76,29 @@ internal static class NativeSounds {
     }
   }
 
-  private unsafe static delegate* unmanaged<byte*, nint, int> _GetName;
+  private unsafe static delegate* unmanaged<byte*, int, nint, int> _GetName;
 
   public unsafe static string GetName(nint soundEvent) {
-    var ret = _GetName(null, soundEvent);
+    byte* retStackPtr = stackalloc byte[256];
+    var ret = _GetName(retStackPtr, 256, soundEvent);
+    if (ret <= 256) {
+      var retString = Encoding.UTF8.GetString(retStackPtr, ret);
+      return retString;
+    }
     var pool = ArrayPool<byte>.Shared;
-    var retBuffer = pool.Rent(ret + 1);
-    fixed (byte* retBufferPtr = retBuffer) {
-      ret = _GetName(retBufferPtr, soundEvent);
-      var retString = Encoding.UTF8.GetString(retBufferPtr, ret);
+    while (true) {
+      var retBuffer = pool.Rent(ret);
+      fixed (byte* retBufferPtr = retBuffer) {
+        var retSize = _GetName(retBufferPtr, retBuffer.Length, soundEvent);
+        if (retSize <= retBuffer.Length) {
+          ret = retSize;
+          var retString = Encoding.UTF8.GetString(retBufferPtr, ret);
+          pool.Return(retBuffer);
+          return retString;
+        }
+        ret = retSize;
+      }
       pool.Return(retBuffer);
-      return retString;
     }
   }
 
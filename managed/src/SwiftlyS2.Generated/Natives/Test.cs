@@ -10,6 +10,10 @@ namespace SwiftlyS2.Core.Natives;
 
 internal static class NativeTest {
 
+  unsafe static NativeTest() {
+    _Test = (delegate* unmanaged<nint>)NativeTable.Get(494);
+  }
+
   private unsafe static delegate* unmanaged<nint> _Test;
 
   public unsafe static nint Test() {
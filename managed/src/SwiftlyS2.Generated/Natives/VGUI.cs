@@ -10,6 +10,15 @@ namespace SwiftlyS2.Core.Natives;
 
 internal static class NativeVGUI {
 
+  unsafe static NativeVGUI() {
+    _RegisterScreenText = (delegate* unmanaged<ulong>)NativeTable.Get(495);
+    _UnregisterScreenText = (delegate* unmanaged<ulong, void>)NativeTable.Get(500);
+    _ScreenTextCreate = (delegate* unmanaged<ulong, Color, int, byte, byte, void>)NativeTable.Get(496);
+    _ScreenTextSetText = (delegate* unmanaged<ulong, byte*, void>)NativeTable.Get(499);
+    _ScreenTextSetColor = (delegate* unmanaged<ulong, Color, void>)NativeTable.Get(497);
+    _ScreenTextSetPosition = (delegate* unmanaged<ulong, float, float, void>)NativeTable.Get(498);
+  }
+
   private unsafe static delegate* unmanaged<ulong> _RegisterScreenText;
 
   public unsafe static ulong RegisterScreenText() {
@@ -10,6 +10,13 @@ namespace SwiftlyS2.Core.Natives;
 
 internal static class NativeVoiceManager {
 
+  unsafe static NativeVoiceManager() {
+    _SetClientListenOverride = (delegate* unmanaged<int, int, int, void>)NativeTable.Get(503);
+    _GetClientListenOverride = (delegate* unmanaged<int, int, int>)NativeTable.Get(501);
+    _SetClientVoiceFlags = (delegate* unmanaged<int, int, void>)NativeTable.Get(504);
+    _GetClientVoiceFlags = (delegate* unmanaged<int, int>)NativeTable.Get(502);
+  }
+
   private unsafe static delegate* unmanaged<int, int, int, void> _SetClientListenOverride;
 
   public unsafe static void SetClientListenOverride(int playerid, int targetid, int listenOverride) {
@@ -82,7 +82,7 @@ public interface IConVar
     /// Query the value of the convar from specified client.
     /// </summary>
     /// <param name="clientId"></param>
-    /// <param name="callback">The action to execute with the value.</param>
+    /// <param name="callback">The action to execute with the value. Not called if the client disconnects before answering.</param>
     void QueryClient(int clientId, Action<string> callback);
 
     /// <summary>
@@ -168,7 +168,7 @@ public interface IConVar<T> : IConVar
     /// Query the value of the convar from specified client.
     /// </summary>
     /// <param name="clientId"></param>
-    /// <param name="callback">The action to execute with the value.</param>
+    /// <param name="callback">The action to execute with the value. Not called if the client disconnects before answering.</param>
     void QueryClient(int clientId, Action<string> callback);
 
     /// <summary>
@@ -0,0 +1,72 @@
+using SwiftlyS2.Shared.Natives;
+using SwiftlyS2.Shared.SchemaDefinitions;
+
+namespace SwiftlyS2.Shared.EntitySystem;
+
+/// <summary>
+/// Records entity operations and runs all of them with a single native call.
+/// Use it when a plugin touches many entities in the same tick, the cost of crossing into native code
+/// is then paid once per <see cref="Execute"/> instead of once per operation.
+/// </summary>
+public interface IEntityCommandBuffer : IDisposable
+{
+    /// <summary>
+    /// Number of recorded operations that weren't executed yet.
+    /// </summary>
+    public int Count { get; }
+
+    /// <summary>
+    /// Record a state change notification for a networked field.
+    /// </summary>
+    /// <param name="entity">Entity instance.</param>
+    /// <param name="className">Schema class that declares the field, e.g. "CBaseEntity".</param>
+    /// <param name="fieldName">Schema field name, e.g. "m_iHealth".</param>
+    /// <exception cref="InvalidOperationException">Thrown when the field is blocked by "FollowCS2ServerGuidelines".</exception>
+    public void SetStateChanged( CEntityInstance entity, string className, string fieldName );
+
+    /// <summary>
+    /// Record a write to a schema field, followed by its state change notification.
+    /// </summary>
+    /// <typeparam name="T">Field type.</typeparam>
+    /// <param name="entity">Entity instance.</param>
+    /// <param name="className">Schema class that declares the field, e.g. "CBaseEntity".</param>
+    /// <param name="fieldName">Schema field name, e.g. "m_iHealth".</param>
+    /// <param name="value">Value to write.</param>
+    /// <exception cref="InvalidOperationException">Thrown when the field is blocked by "FollowCS2ServerGuidelines".</exception>
+    public void Write<T>( CEntityInstance entity, string className, string fieldName, T value ) where T : unmanaged;
+
+    /// <summary>
+    /// Record a teleport. Null values are left unchanged.
+    /// </summary>
+    /// <param name="entity">Entity instance.</param>
+    /// <param name="position">New position.</param>
+    /// <param name="angle">New angle.</param>
+    /// <param name="velocity">New velocity.</param>
+    public void Teleport( CBaseEntity entity, Vector? position, QAngle? angle, Vector? velocity );
+
+    /// <summary>
+    /// Record an input.
+    /// </summary>
+    /// <typeparam name="T">Value type.</typeparam>
+    /// <param name="entity">Entity instance.</param>
+    /// <param name="input">Input name.</param>
+    /// <param name="value">Input value.</param>
+    /// <param name="activator">Activator entity.</param>
+    /// <param name="caller">Caller entity.</param>
+    /// <param name="outputID">Output ID.</param>
+    public void AcceptInput<T>( CEntityInstance entity, string input, T? value, CEntityInstance? activator = null, CEntityInstance? caller = null, int outputID = 0 );
+
+    /// <summary>
+    /// Run every recorded operation in order and clear the buffer.
+    /// Must be called from the main thread.
+    /// </summary>
+    /// <returns>One entry per operation, false when it was skipped (the entity was no longer valid or the field wasn't found).
+    /// The span is only valid until the next call on this buffer.</returns>
+    /// <exception cref="InvalidOperationException">Thrown when called outside of the main thread.</exception>
+    public ReadOnlySpan<bool> Execute();
+
+    /// <summary>
+    /// Drop every recorded operation without running it.
+    /// </summary>
+    public void Clear();
+}
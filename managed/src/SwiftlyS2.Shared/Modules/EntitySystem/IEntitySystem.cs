@@ -71,6 +71,12 @@ public interface IEntitySystemService
     /// <exception cref="InvalidOperationException">Thrown when called too early that entity system is not valid at this moment.</exception>
     public CCSGameRules? GetGameRules();
 
+    /// <summary>
+    /// Create a buffer that records entity operations and runs them with a single native call.
+    /// </summary>
+    /// <returns>An empty command buffer.</returns>
+    public IEntityCommandBuffer CreateCommandBuffer();
+
     /// <summary>
     /// Get all entities.
     /// </summary>
@@ -126,6 +132,32 @@ public interface IEntitySystemService
     /// <returns>A <see cref="Guid"/> that uniquely identifies the hook. This identifier can be used to remove the hook.</returns>
     public Guid HookEntityOutput( string designerName, string outputName, EntityOutputEventHandler callback );
 
+    /// <summary>
+    /// Hooks an output of a single entity to a callback function.
+    /// </summary>
+    /// <remarks>The entity and activator filters are evaluated natively before crossing into managed code,
+    /// so the callback is only invoked for outputs fired by <paramref name="caller"/> that pass the filters.
+    /// The hook stays registered until it's removed with <see cref="UnhookEntityOutput(Guid)"/>.</remarks>
+    /// <param name="caller">The entity whose outputs should be hooked.</param>
+    /// <param name="outputName">The name of the output to hook, or "*" for every output of the entity.</param>
+    /// <param name="callback">The callback function to invoke when the output is triggered. This value cannot be <see langword="null"/>.</param>
+    /// <param name="activator">If set, only outputs activated by this entity invoke the callback.</param>
+    /// <param name="activatorDesignerName">If set, only outputs whose activator has this designer name invoke the callback.</param>
+    /// <returns>A <see cref="Guid"/> that uniquely identifies the hook. This identifier can be used to remove the hook.</returns>
+    public Guid HookEntityOutput( CEntityInstance caller, string outputName, EntityOutputEventHandler callback, CEntityInstance? activator = null, string? activatorDesignerName = null );
+
+    /// <summary>
+    /// Hooks an output of the specified entity type to a callback function, filtered by its activator.
+    /// </summary>
+    /// <remarks>The activator filters are evaluated natively before crossing into managed code.</remarks>
+    /// <param name="designerName">The designer name of the entity to hook, or "*" for every entity.</param>
+    /// <param name="outputName">The name of the output to hook, or "*" for every output.</param>
+    /// <param name="callback">The callback function to invoke when the output is triggered. This value cannot be <see langword="null"/>.</param>
+    /// <param name="activator">If set, only outputs activated by this entity invoke the callback.</param>
+    /// <param name="activatorDesignerName">If set, only outputs whose activator has this designer name invoke the callback.</param>
+    /// <returns>A <see cref="Guid"/> that uniquely identifies the hook. This identifier can be used to remove the hook.</returns>
+    public Guid HookEntityOutput( string designerName, string outputName, EntityOutputEventHandler callback, CEntityInstance? activator, string? activatorDesignerName = null );
+
     /// <summary>
     /// Hooks an output of the specified entity type to a callback function.
     /// </summary>
@@ -0,0 +1,72 @@
+using System.Runtime.InteropServices;
+
+namespace SwiftlyS2.Shared.Memory;
+
+public enum HookCompareOp : int {
+  Equal = 0,
+  NotEqual,
+  Less,
+  LessOrEqual,
+  Greater,
+  GreaterOrEqual,
+  /// <summary>
+  /// (value &amp; constant) != 0
+  /// </summary>
+  AnyBits,
+  /// <summary>
+  /// (value &amp; constant) == 0
+  /// </summary>
+  NoBits,
+}
+
+/// <summary>
+/// A single native check, laid out the way the native side reads it.
+/// </summary>
+[StructLayout(LayoutKind.Sequential)]
+public readonly record struct HookPredicateCondition( int Argument, HookCompareOp Op, int Size, int Offset, long Value );
+
+/// <summary>
+/// Conditions a hooked call's arguments have to pass before the managed callback is entered.
+/// They are evaluated natively, calls that fail any of them go straight to the next hook or the original
+/// without transitioning into managed code.
+///
+/// Arguments are indexed from 0 (`this` is 0 on member functions). The checked argument and every argument
+/// before it have to be integers or pointers. Values are compared as signed integers of <c>size</c> bytes (1, 2, 4 or 8).
+/// </summary>
+public sealed class HookPredicate {
+
+  private readonly List<HookPredicateCondition> conditions = new();
+
+  public IReadOnlyList<HookPredicateCondition> Conditions => conditions;
+
+  /// <summary>
+  /// Creates a predicate comparing an argument with a constant.
+  /// </summary>
+  public static HookPredicate Where( int argument, HookCompareOp op, long value, int size = 8 ) => new HookPredicate().And(argument, op, value, size);
+
+  /// <summary>
+  /// Creates a predicate comparing the value an argument points to at <paramref name="offset"/> with a constant.
+  /// A null pointer fails the check.
+  /// </summary>
+  public static HookPredicate WhereField( int argument, int offset, HookCompareOp op, long value, int size = 4 ) => new HookPredicate().AndField(argument, offset, op, value, size);
+
+  /// <summary>
+  /// Adds a comparison of an argument with a constant.
+  /// </summary>
+  public HookPredicate And( int argument, HookCompareOp op, long value, int size = 8 )
+  {
+    conditions.Add(new HookPredicateCondition(argument, op, size, -1, value));
+    return this;
+  }
+
+  /// <summary>
+  /// Adds a comparison of the value an argument points to at <paramref name="offset"/> with a constant.
+  /// A null pointer fails the check.
+  /// </summary>
+  public HookPredicate AndField( int argument, int offset, HookCompareOp op, long value, int size = 4 )
+  {
+    ArgumentOutOfRangeException.ThrowIfNegative(offset);
+    conditions.Add(new HookPredicateCondition(argument, op, size, offset, value));
+    return this;
+  }
+}
@@ -89,7 +89,7 @@ public interface IMemoryService
   T ToSchemaClass<T>(nint address) where T : class, ISchemaClass<T>;
 
   /// <summary>
-  /// Allocate a block of memory.
+  /// Allocate a block of memory. It is accounted to this plugin in the allocation profiler report.
   /// </summary>
   /// <param name="size">The size of the memory block to allocate.</param>
   /// <returns>The address of the allocated memory block.</returns>
@@ -108,4 +108,31 @@ public interface IMemoryService
   /// <param name="newSize">The new size of the memory block.</param>
   /// <returns>The address of the resized memory block.</returns>
   nint Resize(nint pointer, ulong newSize);
+
+  /// <summary>
+  /// Allocate a block of memory that is released automatically at the end of the current game frame.
+  /// Can only be called from the main thread.
+  /// </summary>
+  /// <param name="size">The size of the memory block to allocate.</param>
+  /// <returns>The address of the allocated memory block.</returns>
+  nint FrameAlloc(ulong size);
+
+  /// <summary>
+  /// Allocate a block of memory from this plugin's arena.
+  /// The block can't be freed on its own, the whole arena is released on ResetArena or when the plugin unloads.
+  /// </summary>
+  /// <param name="size">The size of the memory block to allocate.</param>
+  /// <returns>The address of the allocated memory block.</returns>
+  nint ArenaAlloc(ulong size);
+
+  /// <summary>
+  /// Release every block allocated through ArenaAlloc by this plugin.
+  /// </summary>
+  void ResetArena();
+
+  /// <summary>
+  /// Get the amount of bytes currently allocated in this plugin's arena.
+  /// </summary>
+  /// <returns>The allocated bytes.</returns>
+  ulong GetArenaAllocated();
 }
\ No newline at end of file
@@ -30,6 +30,28 @@ public interface IUnmanagedFunction<TDelegate> where TDelegate : Delegate {
   /// <returns>a guid for the hook.</returns>
   Guid AddHook(Func<Func<TDelegate>, TDelegate> callbackBuilder);
 
+  /// <summary>
+  /// Hook a native function at the specified address with a managed callback and an explicit priority.
+  /// Every hook on the same function shares a single detour, callbacks with a higher <paramref name="priority"/> run first,
+  /// callbacks with the same priority run in the order they were added.
+  /// Code before calling "next" acts as a pre hook, code after it as a post hook, and returning a different value overrides the result.
+  /// </summary>
+  /// <param name="callbackBuilder">Builder that receives the next function pointer and returns the managed callback.</param>
+  /// <param name="priority">The priority of the callback, 0 by default.</param>
+  /// <returns>a guid for the hook.</returns>
+  Guid AddHook(Func<Func<TDelegate>, TDelegate> callbackBuilder, int priority);
+
+  /// <summary>
+  /// Hook a native function with a managed callback that only runs for calls passing <paramref name="predicate"/>.
+  /// The predicate is evaluated natively, every other call continues to the next hook or the original
+  /// without entering managed code, which keeps hooks on hot functions cheap.
+  /// </summary>
+  /// <param name="callbackBuilder">Builder that receives the next function pointer and returns the managed callback.</param>
+  /// <param name="predicate">The conditions the call's arguments have to pass, null hooks every call.</param>
+  /// <param name="priority">The priority of the callback, 0 by default.</param>
+  /// <returns>a guid for the hook.</returns>
+  Guid AddHook(Func<Func<TDelegate>, TDelegate> callbackBuilder, HookPredicate? predicate, int priority = 0);
+
   /// <summary>
   /// Unhook a hook by its id.
   /// </summary>
@@ -30,6 +30,9 @@
 #include <public/mathlib/vector4d.h>
 
 using ConvarValue = std::variant<int16_t, uint16_t, int32_t, uint32_t, int64_t, uint64_t, bool, float, double, Color, Vector2D, Vector, Vector4D, QAngle, std::string>;
+using ClientCvarQueryCallback = std::function<void(int, const std::string&, const std::string&)>;
+// runs exactly once, cvar_value is nullptr when the player disconnected before answering
+using ClientCvarRequestCallback = std::function<void(int, const std::string&, const std::string*)>;
 
 class IConvarManager
 {
@@ -38,9 +41,12 @@ public:
     virtual void Shutdown() = 0;
 
     virtual void QueryClientConvar(int playerid, std::string cvar_name) = 0;
-    virtual int AddQueryClientCvarCallback(std::function<void(int, std::string, std::string)> callback) = 0;
+    virtual void QueryClientConvarWithCallback(int playerid, const std::string& cvar_name, ClientCvarRequestCallback callback) = 0;
+    virtual int AddQueryClientCvarCallback(ClientCvarQueryCallback callback) = 0;
     virtual void RemoveQueryClientCvarCallback(int callback_id) = 0;
-    virtual void OnClientQueryCvar(int playerid, std::string cvar_name, std::string cvar_value) = 0;
+    virtual void OnClientQueryCvar(int playerid, const std::string& cvar_name, const std::string& cvar_value) = 0;
+    virtual void ProcessClientQueries() = 0;
+    virtual void ClearClientQueries(int playerid) = 0;
 
     virtual void CreateConvar(std::string cvar_name, EConVarType type, uint64_t flags, const char* help_message, ConvarValue defaultValue, std::optional<ConvarValue> minValue = std::nullopt, std::optional<ConvarValue> maxValue = std::nullopt) = 0;
     virtual void DeleteConvar(std::string cvar_name) = 0;
@@ -26,4 +26,9 @@ typedef void* (*GetInterfaceFn)(const char*);
 void* InterfacesManager::GetPureInterface(const std::string& interface_name)
 {
     return ::GetPureInterface(interface_name.c_str());
+}
+
+void* InterfacesManager::GetPureInterface(const char* interface_name)
+{
+    return ::GetPureInterface(interface_name);
 }
\ No newline at end of file
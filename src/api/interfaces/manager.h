@@ -19,13 +19,141 @@
 #ifndef _api_interfaces_manager_h
 #define _api_interfaces_manager_h
 
+#include <atomic>
+#include <cstdint>
 #include <tuple>
 #include <string>
 #include "interfaces.h"
 
+class ICvar;
+class IFileSystem;
+class IGameEventSystem;
+class IGameResourceService;
+class INetworkMessages;
+class INetworkServerService;
+class INetworkSystem;
+class IScriptingAPI;
+class ISoundSystem;
+class ISource2GameClients;
+class ISource2Server;
+class IVEngineServer2;
+class CSchemaSystem;
+
+// Fixed slot per interface type. Typed fetches of these resolve the name once and afterwards
+// cost a single pointer load, without building a std::string or probing the interface map.
+enum class InterfaceSlot : uint32_t
+{
+    Logger,
+    MemoryAllocator,
+    CrashReporter,
+    HooksManager,
+    GameData,
+    Configuration,
+    EntitySystem,
+    SDKSchema,
+    ConvarManager,
+    GameEventManager,
+    VoiceManager,
+    Scripting,
+    PlayerManager,
+    SoundEventManager,
+    DatabaseManager,
+    Translations,
+    ServerCommands,
+    NetMessages,
+    VGUI,
+    ConsoleOutput,
+
+    EngineServer,
+    Cvar,
+    FileSystem,
+    GameEventSystem,
+    GameResourceService,
+    NetworkMessages,
+    NetworkServerService,
+    NetworkSystem,
+    SchemaSystem,
+    SoundSystem,
+    Source2GameClients,
+    Source2Server,
+
+    Count,
+    None = Count
+};
+
+template<class T>
+struct InterfaceSlotOf
+{
+    static constexpr InterfaceSlot value = InterfaceSlot::None;
+};
+
+#define DECLARE_INTERFACE_SLOT(type, slot) \
+    template<> \
+    struct InterfaceSlotOf<type> \
+    { \
+        static constexpr InterfaceSlot value = InterfaceSlot::slot; \
+    }
+
+DECLARE_INTERFACE_SLOT(ILogger, Logger);
+DECLARE_INTERFACE_SLOT(IMemoryAllocator, MemoryAllocator);
+DECLARE_INTERFACE_SLOT(ICrashReporter, CrashReporter);
+DECLARE_INTERFACE_SLOT(IHooksManager, HooksManager);
+DECLARE_INTERFACE_SLOT(IGameDataManager, GameData);
+DECLARE_INTERFACE_SLOT(IConfiguration, Configuration);
+DECLARE_INTERFACE_SLOT(IEntitySystem, EntitySystem);
+DECLARE_INTERFACE_SLOT(ISDKSchema, SDKSchema);
+DECLARE_INTERFACE_SLOT(IConvarManager, ConvarManager);
+DECLARE_INTERFACE_SLOT(IEventManager, GameEventManager);
+DECLARE_INTERFACE_SLOT(IVoiceManager, VoiceManager);
+DECLARE_INTERFACE_SLOT(IScriptingAPI, Scripting);
+DECLARE_INTERFACE_SLOT(IPlayerManager, PlayerManager);
+DECLARE_INTERFACE_SLOT(ISoundEventManager, SoundEventManager);
+DECLARE_INTERFACE_SLOT(IDatabaseManager, DatabaseManager);
+DECLARE_INTERFACE_SLOT(ITranslations, Translations);
+DECLARE_INTERFACE_SLOT(IServerCommands, ServerCommands);
+DECLARE_INTERFACE_SLOT(INetMessages, NetMessages);
+DECLARE_INTERFACE_SLOT(IVGUI, VGUI);
+DECLARE_INTERFACE_SLOT(IConsoleOutput, ConsoleOutput);
+
+DECLARE_INTERFACE_SLOT(IVEngineServer2, EngineServer);
+DECLARE_INTERFACE_SLOT(ICvar, Cvar);
+DECLARE_INTERFACE_SLOT(IFileSystem, FileSystem);
+DECLARE_INTERFACE_SLOT(IGameEventSystem, GameEventSystem);
+DECLARE_INTERFACE_SLOT(IGameResourceService, GameResourceService);
+DECLARE_INTERFACE_SLOT(INetworkMessages, NetworkMessages);
+DECLARE_INTERFACE_SLOT(INetworkServerService, NetworkServerService);
+DECLARE_INTERFACE_SLOT(INetworkSystem, NetworkSystem);
+DECLARE_INTERFACE_SLOT(CSchemaSystem, SchemaSystem);
+DECLARE_INTERFACE_SLOT(ISoundSystem, SoundSystem);
+DECLARE_INTERFACE_SLOT(ISource2GameClients, Source2GameClients);
+DECLARE_INTERFACE_SLOT(ISource2Server, Source2Server);
+
 class InterfacesManager
 {
 public:
+    // a slotted type is assumed to always be fetched under the same name, only the first call looks it up
+    template<class T>
+    T* FetchInterface(const char* interface_name)
+    {
+        if constexpr (InterfaceSlotOf<T>::value != InterfaceSlot::None)
+        {
+            auto& slot = m_aSlots[static_cast<uint32_t>(InterfaceSlotOf<T>::value)];
+
+            void* iface = slot.load(std::memory_order_acquire);
+            if (iface) return (T*)iface;
+
+            // engine interfaces can be missing early on, a miss is never cached
+            iface = GetPureInterface(interface_name);
+            if (iface) slot.store(iface, std::memory_order_release);
+            return (T*)iface;
+        }
+        else
+        {
+            return (T*)GetPureInterface(interface_name);
+        }
+    }
+
+    // by name, never cached, for interfaces that only exist at runtime (extensions)
     template<class T>
     T* FetchInterface(const std::string& interface_name)
     {
@@ -34,6 +162,10 @@ public:
     }
 
     void* GetPureInterface(const std::string& interface_name);
+    void* GetPureInterface(const char* interface_name);
+
+private:
+    std::atomic<void*> m_aSlots[static_cast<uint32_t>(InterfaceSlot::Count)] = {};
 };
 
 extern InterfacesManager g_ifaceService;
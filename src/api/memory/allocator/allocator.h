@@ -47,6 +47,22 @@ public:
     virtual void Move(void* dest, void* src, uint64_t size) = 0;
 
     virtual std::map<void*, uint64_t> GetAllocations() = 0;
+
+    // released at the end of the current game frame
+    // main thread only, the reset runs from GameFrame and must not race with an allocation
+    virtual void* FrameAlloc(uint64_t size) = 0;
+    virtual void ResetFrameArena() = 0;
+
+    // owner arenas live until FreeArena is called for that owner
+    virtual void* ArenaAlloc(std::string owner, uint64_t size) = 0;
+    virtual void FreeArena(std::string owner) = 0;
+    virtual uint64_t GetArenaAllocated(std::string owner) = 0;
+
+    // samples 1 in sample_rate allocations, owners are the tracked identifiers
+    virtual void StartProfiling(uint32_t sample_rate) = 0;
+    virtual void StopProfiling() = 0;
+    virtual bool IsProfiling() = 0;
+    virtual std::string GetProfilingReport() = 0;
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,196 @@
+/************************************************************************************************
+ *  SwiftlyS2 is a scripting framework for Source2-based games.
+ *  Copyright (C) 2023-2026 Swiftly Solution SRL via Sava Andrei-Sebastian and it's contributors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ ************************************************************************************************/
+
+// Generated by generator/gamedata_generator/generate.py from plugin_files/gamedata, do not edit.
+
+#ifndef src_api_memory_gamedata_ids_h
+#define src_api_memory_gamedata_ids_h
+
+#include <cstdint>
+
+enum class GameDataOffset : uint32_t
+{
+    CBaseEntity_CollisionRulesChanged,
+    CBaseEntity_EndTouch,
+    CBaseEntity_StartTouch,
+    CBaseEntity_Teleport,
+    CBaseEntity_Touch,
+    CBasePlayerPawn_CommitSuicide,
+    CCSPlayerController_ChangeTeam,
+    CCSPlayerController_Respawn,
+    CCSPlayer_ItemServices_DropActiveItem,
+    CCSPlayer_ItemServices_GiveNamedItem,
+    CCSPlayer_ItemServices_RemoveWeapons,
+    CCSPlayer_WeaponServices_CanUse,
+    CCSPlayer_WeaponServices_DropWeapon,
+    CCSPlayer_WeaponServices_SelectWeapon,
+    CEntityResourceManifest_AddResource,
+    CGameRules_FindPickerEntity,
+    CGameSceneNode_GetSkeletonInstance,
+    CPlayer_MovementServices_RunCommand,
+    CServerSideClient_ProcessRespondCvarValue,
+    CServerSideClient_SendNetMessage,
+    CSoundSystem_TakeGuid,
+    GameEntitySystem,
+    GetHammerUniqueID,
+    ICvar_DispatchConCommand,
+    ICvar_FindConCommand,
+    IGameEventManager2_FireEvent,
+    IGameEventSystem_PostEventAbstract,
+    IGameSystem_BuildGameSessionManifest,
+    ILoopMode_LoopInit,
+    INetworkServerService_StartupServer,
+    IServerGameClients_ClientCommand,
+    IServerGameClients_ClientConnect,
+    IServerGameClients_ClientDisconnect,
+    IServerGameClients_ClientPutInServer,
+    IServerGameClients_OnClientConnected,
+    IServerGameDLL_GameFrame,
+    IServerGameDLL_GameServerSteamAPIActivated,
+    IServerGameDLL_GameServerSteamAPIDeactivated,
+    IServerGameDLL_PreWorldUpdate,
+    ISource2GameEntities_CheckTransmit,
+    IVEngineServer2_SetClientListening,
+
+    Count
+};
+
+inline constexpr const char* g_GameDataOffsetNames[] = {
+    "CBaseEntity::CollisionRulesChanged",
+    "CBaseEntity::EndTouch",
+    "CBaseEntity::StartTouch",
+    "CBaseEntity::Teleport",
+    "CBaseEntity::Touch",
+    "CBasePlayerPawn::CommitSuicide",
+    "CCSPlayerController::ChangeTeam",
+    "CCSPlayerController::Respawn",
+    "CCSPlayer_ItemServices::DropActiveItem",
+    "CCSPlayer_ItemServices::GiveNamedItem",
+    "CCSPlayer_ItemServices::RemoveWeapons",
+    "CCSPlayer_WeaponServices::CanUse",
+    "CCSPlayer_WeaponServices::DropWeapon",
+    "CCSPlayer_WeaponServices::SelectWeapon",
+    "CEntityResourceManifest::AddResource",
+    "CGameRules::FindPickerEntity",
+    "CGameSceneNode::GetSkeletonInstance",
+    "CPlayer_MovementServices::RunCommand",
+    "CServerSideClient::ProcessRespondCvarValue",
+    "CServerSideClient::SendNetMessage",
+    "CSoundSystem::TakeGuid",
+    "GameEntitySystem",
+    "GetHammerUniqueID",
+    "ICvar::DispatchConCommand",
+    "ICvar::FindConCommand",
+    "IGameEventManager2::FireEvent",
+    "IGameEventSystem::PostEventAbstract",
+    "IGameSystem::BuildGameSessionManifest",
+    "ILoopMode::LoopInit",
+    "INetworkServerService::StartupServer",
+    "IServerGameClients::ClientCommand",
+    "IServerGameClients::ClientConnect",
+    "IServerGameClients::ClientDisconnect",
+    "IServerGameClients::ClientPutInServer",
+    "IServerGameClients::OnClientConnected",
+    "IServerGameDLL::GameFrame",
+    "IServerGameDLL::GameServerSteamAPIActivated",
+    "IServerGameDLL::GameServerSteamAPIDeactivated",
+    "IServerGameDLL::PreWorldUpdate",
+    "ISource2GameEntities::CheckTransmit",
+    "IVEngineServer2::SetClientListening",
+};
+
+enum class GameDataSignature : uint32_t
+{
+    BotNavIgnore1,
+    BotNavIgnore2,
+    BotNavIgnore3,
+    CAttributeList_SetOrAddAttributeValueByName,
+    CBaseEntity_DispatchSpawn,
+    CBaseEntity_TakeDamage,
+    CBaseModelEntity_SetModel,
+    CBasePlayerController_SetPawn,
+    CCSPlayerController_ProcessUserCmd,
+    CCSPlayerController_SwitchTeam,
+    CCSPlayerPawn_PostThink,
+    CCSPlayer_ItemServices_CanAcquire,
+    CDecoyProjectile_EmitGrenade,
+    CEntityIOOutput_FireOutputInternal,
+    CEntityIdentity_AcceptInput,
+    CEntityInstance_AcceptInput,
+    CEntitySystem_AddEntityIOEvent,
+    CFlashbangProjectile_EmitGrenade,
+    CGameRules_TerminateRound,
+    CHEGrenadeProjectile_EmitGrenade,
+    CLoggingSystem_LogDirect,
+    CMolotovProjectile_EmitGrenade,
+    CSmokeGrenadeProjectile_EmitGrenade,
+    CSource2Server_g_GameEventManager,
+    CTakeDamageInfo_Constructor,
+    Cmd_ExecuteCommand,
+    DispatchParticleEffect,
+    GetWeaponCSDataFromKey,
+    IGameSystem_InitAllSystems_pFirst,
+    INetworkMessageProcessingPreFilter_FilterMessage,
+    LegacyGameEventListener,
+    TracePlayerBBox,
+    TraceShape,
+    UTIL_CreateEntityByName,
+    UTIL_Remove,
+
+    Count
+};
+
+inline constexpr const char* g_GameDataSignatureNames[] = {
+    "BotNavIgnore1",
+    "BotNavIgnore2",
+    "BotNavIgnore3",
+    "CAttributeList::SetOrAddAttributeValueByName",
+    "CBaseEntity::DispatchSpawn",
+    "CBaseEntity::TakeDamage",
+    "CBaseModelEntity::SetModel",
+    "CBasePlayerController::SetPawn",
+    "CCSPlayerController::ProcessUserCmd",
+    "CCSPlayerController::SwitchTeam",
+    "CCSPlayerPawn::PostThink",
+    "CCSPlayer_ItemServices::CanAcquire",
+    "CDecoyProjectile::EmitGrenade",
+    "CEntityIOOutput::FireOutputInternal",
+    "CEntityIdentity::AcceptInput",
+    "CEntityInstance::AcceptInput",
+    "CEntitySystem::AddEntityIOEvent",
+    "CFlashbangProjectile::EmitGrenade",
+    "CGameRules::TerminateRound",
+    "CHEGrenadeProjectile::EmitGrenade",
+    "CLoggingSystem::LogDirect",
+    "CMolotovProjectile::EmitGrenade",
+    "CSmokeGrenadeProjectile::EmitGrenade",
+    "CSource2Server::g_GameEventManager",
+    "CTakeDamageInfo::Constructor",
+    "Cmd_ExecuteCommand",
+    "DispatchParticleEffect",
+    "GetWeaponCSDataFromKey",
+    "IGameSystem::InitAllSystems->pFirst",
+    "INetworkMessageProcessingPreFilter::FilterMessage",
+    "LegacyGameEventListener",
+    "TracePlayerBBox",
+    "TraceShape",
+    "UTIL::CreateEntityByName",
+    "UTIL::Remove",
+};
+
+#endif
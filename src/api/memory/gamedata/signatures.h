@@ -19,6 +19,8 @@
 #ifndef src_api_memory_gamedata_signatures_h
 #define src_api_memory_gamedata_signatures_h
 
+#include "ids.h"
+
 #include <string>
 
 class IGameDataSignatures
@@ -27,6 +29,7 @@ public:
     virtual void Load(const std::string& game) = 0;
     virtual bool Exists(const std::string& name) = 0;
     virtual void* Fetch(const std::string& name) = 0;
+    virtual void* Fetch(GameDataSignature id) = 0;
 };
 
 #endif
\ No newline at end of file
@@ -22,6 +22,7 @@
 #include "function.h"
 #include "vfunction.h"
 #include "mfunction.h"
+#include "predicate.h"
 
 #define PTR_SIZE sizeof(void*)
 
@@ -39,8 +40,34 @@ public:
     virtual void DestroyVFunctionHook(IVFunctionHook* hook) = 0;
     virtual void DestroyMFunctionHook(IMFunctionHook* hook) = 0;
 
+    // Listeners share a single detour per target and run by priority (higher first, then registration order).
+    // The callback has the target's signature and continues the call through GetHookListenerNext(id).
+    virtual uint64_t AddHookListener(void* target, void* callback, int priority) = 0;
+    // Same as AddHookListener, the callback is only entered for calls whose arguments pass every condition.
+    // Other calls jump straight to the next listener without leaving native code.
+    virtual uint64_t AddHookListenerFiltered(void* target, void* callback, int priority, const HookPredicateCondition* conditions, int count) = 0;
+    virtual void RemoveHookListener(uint64_t id) = 0;
+    virtual void* GetHookListenerNext(uint64_t id) = 0;
+    virtual void* GetHookChainOriginal(void* target) = 0;
+
+    // Hooks created until the matching commit are patched in together when it's called. Transactions nest.
+    virtual void BeginHookTransaction() = 0;
+    virtual void CommitHookTransaction() = 0;
+
+    // Call counts and rdtsc timings for detour listeners, entity output, net message and game event hooks.
+    // Nothing is measured (and the detours run without the timing thunks) while disabled.
+    virtual void EnableHookStats(bool enable) = 0;
+    virtual bool IsHookStatsEnabled() = 0;
+    virtual void ResetHookStats() = 0;
+    virtual std::string GetHookStatsReport() = 0;
+    // shown next to the listener's stats, plugins use their name
+    virtual void SetHookListenerOwner(uint64_t id, const std::string& owner) = 0;
+
     // ptr CEntityIOOutput, string outputName, ptr activator, ptr caller, float delay -> int (HookResult)
     virtual uint64_t CreateEntityHookOutput(const std::string& className, const std::string& outputName, void* callback) = 0;
+    // ptr CEntityIOOutput, string outputName, ptr activator, ptr caller, ptr variant, float delay -> int (HookResult)
+    // callerHandle / activatorHandle = INVALID_EHANDLE_INDEX and an empty activatorClassName mean any, a caller handle takes precedence over className
+    virtual uint64_t CreateEntityHookOutputFiltered(const std::string& className, const std::string& outputName, uint32_t callerHandle, uint32_t activatorHandle, const std::string& activatorClassName, void* callback) = 0;
     virtual void DestroyEntityHookOutput(uint64_t id) = 0;
 };
 
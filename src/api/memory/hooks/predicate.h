@@ -0,0 +1,51 @@
+/************************************************************************************************
+ *  SwiftlyS2 is a scripting framework for Source2-based games.
+ *  Copyright (C) 2023-2026 Swiftly Solution SRL via Sava Andrei-Sebastian and it's contributors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ ************************************************************************************************/
+
+#ifndef src_api_memory_hooks_predicate_h
+#define src_api_memory_hooks_predicate_h
+
+#include <cstdint>
+
+enum class HookPredicateOp : int32_t
+{
+    Equal = 0,
+    NotEqual,
+    Less,
+    LessOrEqual,
+    Greater,
+    GreaterOrEqual,
+    // (value & constant) != 0
+    AnyBits,
+    // (value & constant) == 0
+    NoBits,
+};
+
+// One check a hook listener's arguments have to pass before its callback is entered.
+// The argument and every one before it have to be integer or pointer sized (`this` is argument 0
+// on member functions). `size` bytes are compared as a signed integer, either the argument itself
+// or, with `offset` >= 0, what it points to at that offset (a null pointer fails the check).
+struct HookPredicateCondition
+{
+    int32_t argument;
+    HookPredicateOp op;
+    int32_t size;
+    int32_t offset;
+    int64_t value;
+};
+
+#endif
@@ -19,6 +19,7 @@
 #ifndef src_api_monitor_logger_logger_h
 #define src_api_monitor_logger_logger_h
 
+#include <cstdint>
 #include <string>
 
 enum class LogType
@@ -57,6 +58,10 @@ public:
 
     virtual void ShouldColorCategoryInConsole(const std::string& category, bool enabled) = 0;
     virtual void ShouldOutputToConsole(LogType type, bool enabled) = 0;
+
+    // max_size = 0 disables size based rotation
+    virtual void SetFileRotation(uint64_t max_size, bool daily) = 0;
+    virtual void Shutdown() = 0;
 };
 
 #endif
\ No newline at end of file
@@ -19,6 +19,8 @@
 #ifndef src_api_scripting_scripting_h
 #define src_api_scripting_scripting_h
 
+#include <cstdint>
+
 struct NativeFunction {
     const char* name;
     void* function;
@@ -29,6 +31,8 @@ class IScriptingAPI
 public:
     virtual NativeFunction* GetNativeFunctions() = 0;
     virtual int GetNativeFunctionsCount() = 0;
+    // NATIVE_NAMES_HASH, the managed side refuses a table generated from other natives/ definitions
+    virtual uint64_t GetNativeNamesHash() = 0;
 };
 
 #endif
\ No newline at end of file
@@ -32,6 +32,8 @@ public:
 
     virtual int32_t GetOffset(const char* sClassName, const char* sMemberName) = 0;
     virtual int32_t GetOffset(uint64_t uHash) = 0;
+    // 0 if the field is unknown
+    virtual uint32_t GetFieldSize(uint64_t uHash) = 0;
 
     virtual bool IsStruct(const char* sClassName) = 0;
     virtual bool IsClassLoaded(const char* sClassName) = 0;
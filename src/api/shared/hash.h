@@ -20,20 +20,40 @@
 #define src_api_shared_hash_h
 
 #include <cstdint>
+#include <cstddef>
 
 constexpr uint32_t val_32_const = 0x811c9dc5;
 constexpr uint32_t prime_32_const = 0x1000193;
 constexpr uint64_t val_64_const = 0xcbf29ce484222325;
 constexpr uint64_t prime_64_const = 0x100000001b3;
 
+// Every variant hashes the string's bytes as unsigned, the same values the generators hash from
+// `str.encode()`. Plain char is signed on x86, so bytes >= 0x80 are cast through uint8_t first.
+
 inline constexpr uint32_t hash_32_fnv1a_const(const char* const str, const uint32_t value = val_32_const) noexcept
 {
-    return (str[0] == '\0') ? value : hash_32_fnv1a_const(&str[1], (value ^ uint32_t(str[0])) * prime_32_const);
+    return (str[0] == '\0') ? value : hash_32_fnv1a_const(&str[1], (value ^ uint32_t(uint8_t(str[0]))) * prime_32_const);
 }
 
 inline constexpr uint64_t hash_64_fnv1a_const(const char* const str, const uint64_t value = val_64_const) noexcept
 {
-    return (str[0] == '\0') ? value : hash_64_fnv1a_const(&str[1], (value ^ uint64_t(str[0])) * prime_64_const);
+    return (str[0] == '\0') ? value : hash_64_fnv1a_const(&str[1], (value ^ uint64_t(uint8_t(str[0]))) * prime_64_const);
+}
+
+inline uint32_t hash_32_fnv1a(const char* str, size_t len, uint32_t value = val_32_const) noexcept
+{
+    for (size_t i = 0; i < len; i++)
+        value = (value ^ uint32_t(uint8_t(str[i]))) * prime_32_const;
+
+    return value;
+}
+
+inline uint64_t hash_64_fnv1a(const char* str, size_t len, uint64_t value = val_64_const) noexcept
+{
+    for (size_t i = 0; i < len; i++)
+        value = (value ^ uint64_t(uint8_t(str[i]))) * prime_64_const;
+
+    return value;
 }
 
 #endif
\ No newline at end of file
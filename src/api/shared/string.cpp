@@ -21,65 +21,79 @@
 
 #include <api/interfaces/manager.h>
 
-#include <map>
 #include <random>
 #include <chrono>
 
-#include <regex>
+#include <algorithm>
+#include <array>
+#include <cstring>
 #include <ranges>
 
 #include <fmt/format.h>
 
 const char* wws = " \t\n\r\f\v";
 
-std::map<std::string, std::string> terminalColors = {
-    {"[default]", WIN_LINUX("\033[38;2;255;255;255m", "\e[39m")},
-    {"[/]", WIN_LINUX("\033[38;2;255;255;255m", "\e[39m")},
-    {"[white]", WIN_LINUX("\033[38;2;255;255;255m", "\e[39m")},
-    {"[darkred]", WIN_LINUX("\x1B[31m", "\e[31m")},
-    {"[lightpurple]", WIN_LINUX("\x1B[95m", "\e[95m")},
-    {"[green]", WIN_LINUX("\x1B[32m", "\e[32m")},
-    {"[olive]", WIN_LINUX("\x1B[33m", "\e[33m")},
-    {"[lime]", WIN_LINUX("\x1B[92m", "\e[92m")},
-    {"[red]", WIN_LINUX("\x1B[31m", "\e[31m")},
-    {"[gray]", WIN_LINUX("\x1B[37m", "\e[37m")},
-    {"[grey]", WIN_LINUX("\x1B[37m", "\e[37m")},
-    {"[lightyellow]", WIN_LINUX("\x1B[93m", "\e[93m")},
-    {"[yellow]", WIN_LINUX("\x1B[93m", "\e[93m")},
-    {"[silver]", WIN_LINUX("\x1B[37m", "\e[37m")},
-    {"[bluegrey]", WIN_LINUX("\x1B[94m", "\e[94m")},
-    {"[lightblue]", WIN_LINUX("\x1B[94m", "\e[94m")},
-    {"[blue]", WIN_LINUX("\x1B[34m", "\e[34m")},
-    {"[darkblue]", WIN_LINUX("\x1B[34m", "\e[34m")},
-    {"[purple]", WIN_LINUX("\x1B[35m", "\e[35m")},
-    {"[magenta]", WIN_LINUX("\x1B[35m", "\e[35m")},
-    {"[lightred]", WIN_LINUX("\x1B[91m", "\e[91m")},
-    {"[gold]", WIN_LINUX("\x1B[93m", "\e[93m")},
-    {"[orange]", WIN_LINUX("\x1B[33m", "\e[33m")},
-
-    {"[bgdefault]", WIN_LINUX("\x1B[40m", "\e[40m")},
-    {"[bgdarkred]", WIN_LINUX("\x1B[41m", "\e[41m")},
-    {"[bglightpurple]", WIN_LINUX("\x1B[105m", "\e[105m")},
-    {"[bggreen]", WIN_LINUX("\x1B[42m", "\e[42m")},
-    {"[bgolive]", WIN_LINUX("\x1B[43m", "\e[43m")},
-    {"[bglime]", WIN_LINUX("\x1B[102m", "\e[102m")},
-    {"[bgred]", WIN_LINUX("\x1B[41m", "\e[41m")},
-    {"[bggray]", WIN_LINUX("\x1B[47m", "\e[47m")},
-    {"[bggrey]", WIN_LINUX("\x1B[47m", "\e[47m")},
-    {"[bglightyellow]", WIN_LINUX("\x1B[103m", "\e[103m")},
-    {"[bgyellow]", WIN_LINUX("\x1B[103m", "\e[103m")},
-    {"[bgsilver]", WIN_LINUX("\x1B[47m", "\e[47m")},
-    {"[bgbluegrey]", WIN_LINUX("\x1B[104m", "\e[104m")},
-    {"[bglightblue]", WIN_LINUX("\x1B[104m", "\e[104m")},
-    {"[bgblue]", WIN_LINUX("\x1B[44m", "\e[44m")},
-    {"[bgdarkblue]", WIN_LINUX("\x1B[44m", "\e[44m")},
-    {"[bgpurple]", WIN_LINUX("\x1B[45m", "\e[45m")},
-    {"[bgmagenta]", WIN_LINUX("\x1B[45m", "\e[45m")},
-    {"[bglightred]", WIN_LINUX("\x1B[101m", "\e[101m")},
-    {"[bggold]", WIN_LINUX("\x1B[103m", "\e[103m")},
-    {"[bgorange]", WIN_LINUX("\x1B[43m", "\e[43m")},
+struct ColorTag
+{
+    const char* name;
+    const char* chat;     // nullptr if it isn't a chat color
+    const char* terminal; // nullptr if it isn't a terminal color
+};
+
+static const ColorTag colorTags[] = {
+    {"default", "\x01", WIN_LINUX("\033[38;2;255;255;255m", "\e[39m")},
+    {"/", "\x01", WIN_LINUX("\033[38;2;255;255;255m", "\e[39m")},
+    {"white", "\x01", WIN_LINUX("\033[38;2;255;255;255m", "\e[39m")},
+    {"darkred", "\x02", WIN_LINUX("\x1B[31m", "\e[31m")},
+    {"lightpurple", "\x03", WIN_LINUX("\x1B[95m", "\e[95m")},
+    {"green", "\x04", WIN_LINUX("\x1B[32m", "\e[32m")},
+    {"olive", "\x05", WIN_LINUX("\x1B[33m", "\e[33m")},
+    {"lime", "\x06", WIN_LINUX("\x1B[92m", "\e[92m")},
+    {"red", "\x07", WIN_LINUX("\x1B[31m", "\e[31m")},
+    {"gray", "\x08", WIN_LINUX("\x1B[37m", "\e[37m")},
+    {"grey", "\x08", WIN_LINUX("\x1B[37m", "\e[37m")},
+    {"lightyellow", "\x09", WIN_LINUX("\x1B[93m", "\e[93m")},
+    {"yellow", "\x09", WIN_LINUX("\x1B[93m", "\e[93m")},
+    {"silver", "\x0A", WIN_LINUX("\x1B[37m", "\e[37m")},
+    {"bluegrey", "\x0A", WIN_LINUX("\x1B[94m", "\e[94m")},
+    {"lightblue", "\x0B", WIN_LINUX("\x1B[94m", "\e[94m")},
+    {"blue", "\x0B", WIN_LINUX("\x1B[34m", "\e[34m")},
+    {"darkblue", "\x0C", WIN_LINUX("\x1B[34m", "\e[34m")},
+    {"purple", "\x0E", WIN_LINUX("\x1B[35m", "\e[35m")},
+    {"magenta", "\x0E", WIN_LINUX("\x1B[35m", "\e[35m")},
+    {"lightred", "\x0F", WIN_LINUX("\x1B[91m", "\e[91m")},
+    {"gold", "\x10", WIN_LINUX("\x1B[93m", "\e[93m")},
+    {"orange", "\x10", WIN_LINUX("\x1B[33m", "\e[33m")},
+
+    {"bgdefault", nullptr, WIN_LINUX("\x1B[40m", "\e[40m")},
+    {"bgdarkred", nullptr, WIN_LINUX("\x1B[41m", "\e[41m")},
+    {"bglightpurple", nullptr, WIN_LINUX("\x1B[105m", "\e[105m")},
+    {"bggreen", nullptr, WIN_LINUX("\x1B[42m", "\e[42m")},
+    {"bgolive", nullptr, WIN_LINUX("\x1B[43m", "\e[43m")},
+    {"bglime", nullptr, WIN_LINUX("\x1B[102m", "\e[102m")},
+    {"bgred", nullptr, WIN_LINUX("\x1B[41m", "\e[41m")},
+    {"bggray", nullptr, WIN_LINUX("\x1B[47m", "\e[47m")},
+    {"bggrey", nullptr, WIN_LINUX("\x1B[47m", "\e[47m")},
+    {"bglightyellow", nullptr, WIN_LINUX("\x1B[103m", "\e[103m")},
+    {"bgyellow", nullptr, WIN_LINUX("\x1B[103m", "\e[103m")},
+    {"bgsilver", nullptr, WIN_LINUX("\x1B[47m", "\e[47m")},
+    {"bgbluegrey", nullptr, WIN_LINUX("\x1B[104m", "\e[104m")},
+    {"bglightblue", nullptr, WIN_LINUX("\x1B[104m", "\e[104m")},
+    {"bgblue", nullptr, WIN_LINUX("\x1B[44m", "\e[44m")},
+    {"bgdarkblue", nullptr, WIN_LINUX("\x1B[44m", "\e[44m")},
+    {"bgpurple", nullptr, WIN_LINUX("\x1B[45m", "\e[45m")},
+    {"bgmagenta", nullptr, WIN_LINUX("\x1B[45m", "\e[45m")},
+    {"bglightred", nullptr, WIN_LINUX("\x1B[101m", "\e[101m")},
+    {"bggold", nullptr, WIN_LINUX("\x1B[103m", "\e[103m")},
+    {"bgorange", nullptr, WIN_LINUX("\x1B[43m", "\e[43m")},
+
+    // resolved per team in chat mode, removed in strip mode
+    {"teamcolor", nullptr, nullptr},
 };
 
+#define COLOR_TAG_MAX_LENGTH 16
+#define COLOR_TAG_SLOTS 128
+
 std::vector<std::string> terminalPrefixColors = {
     "[default]",
     "[/]",
@@ -103,68 +117,136 @@ std::vector<std::string> terminalPrefixColors = {
     "[orange]",
 };
 
-std::map<std::string, std::string> colors = {
-    {"[default]", "\x01"},
-    {"[/]", "\x01"},
-    {"[white]", "\x01"},
-    {"[darkred]", "\x02"},
-    {"[lightpurple]", "\x03"},
-    {"[green]", "\x04"},
-    {"[olive]", "\x05"},
-    {"[lime]", "\x06"},
-    {"[red]", "\x07"},
-    {"[gray]", "\x08"},
-    {"[grey]", "\x08"},
-    {"[lightyellow]", "\x09"},
-    {"[yellow]", "\x09"},
-    {"[silver]", "\x0A"},
-    {"[bluegrey]", "\x0A"},
-    {"[lightblue]", "\x0B"},
-    {"[blue]", "\x0B"},
-    {"[darkblue]", "\x0C"},
-    {"[purple]", "\x0E"},
-    {"[magenta]", "\x0E"},
-    {"[lightred]", "\x0F"},
-    {"[gold]", "\x10"},
-    {"[orange]", "\x10"},
-};
-
-std::string ProcessColor(std::string str, int team)
+static const ColorTag* FindColorTag(const char* name, size_t len)
 {
-    str = replace(str, "[teamcolor]", team == 3 ? "[lightblue]" : (team == 2 ? "[yellow]" : "[lightpurple]"));
-    for (auto it = colors.begin(); it != colors.end(); ++it)
+    // open addressing over the fnv hash of the tag name, built once
+    static const std::array<const ColorTag*, COLOR_TAG_SLOTS> slots = []() {
+        std::array<const ColorTag*, COLOR_TAG_SLOTS> table{};
+        for (const auto& tag : colorTags)
+        {
+            uint32_t idx = hash_32_fnv1a(tag.name, strlen(tag.name)) & (COLOR_TAG_SLOTS - 1);
+            while (table[idx]) idx = (idx + 1) & (COLOR_TAG_SLOTS - 1);
+            table[idx] = &tag;
+        }
+        return table;
+        }();
+
+    uint32_t idx = hash_32_fnv1a(name, len) & (COLOR_TAG_SLOTS - 1);
+    while (slots[idx])
     {
-        str = replace(str, it->first, it->second);
+        const ColorTag* tag = slots[idx];
+        if (strncmp(tag->name, name, len) == 0 && tag->name[len] == '\0') return tag;
+        idx = (idx + 1) & (COLOR_TAG_SLOTS - 1);
     }
-    return str;
+    return nullptr;
 }
 
-std::string ClearColors(std::string str)
+// <div ...>, </div>, <font ...>, </font> -> length of the whole tag, 0 if it isn't one
+static size_t MatchHtmlTag(std::string_view str, size_t pos)
 {
-    str = replace(str, "[teamcolor]", "");
-    for (auto it = terminalColors.begin(); it != terminalColors.end(); ++it)
-    {
-        str = replace(str, it->first, "");
-    }
-    return str;
+    size_t cur = pos + 1;
+    if (cur < str.size() && str[cur] == '/') cur++;
+
+    std::string_view rest = str.substr(cur);
+    if (rest.starts_with("div")) cur += 3;
+    else if (rest.starts_with("font")) cur += 4;
+    else return 0;
+
+    size_t close = str.find('>', cur);
+    if (close == std::string_view::npos) return 0;
+    return close - pos + 1;
 }
 
-std::string TerminalProcessColor(std::string str)
+static const char* ResolveColorTag(const ColorTag* tag, ColorMode mode, int team)
 {
-    for (auto it = terminalColors.begin(); it != terminalColors.end(); ++it)
+    if (!tag->chat && !tag->terminal)
     {
-        str = replace(str, it->first, it->second);
+        if (mode == ColorMode::Strip) return "";
+        if (mode != ColorMode::Chat) return nullptr;
+
+        const char* teamTag = team == 3 ? "lightblue" : (team == 2 ? "yellow" : "lightpurple");
+        return FindColorTag(teamTag, strlen(teamTag))->chat;
+    }
+
+    switch (mode)
+    {
+    case ColorMode::Chat:
+        return tag->chat;
+    case ColorMode::Terminal:
+        return tag->terminal;
+    default:
+        return "";
     }
-    return str;
 }
 
-std::string ClearTerminalColors(std::string str)
+void ProcessColorTags(std::string_view str, std::string& out, ColorMode mode, int team, bool strip_html)
 {
-    for (auto it = terminalColors.begin(); it != terminalColors.end(); ++it)
+    const char* stops = strip_html ? "[<" : "[";
+    size_t last = 0;
+    size_t pos = 0;
+
+    out.reserve(out.size() + str.size());
+
+    while ((pos = str.find_first_of(stops, pos)) != std::string_view::npos)
     {
-        str = replace(str, it->first, "");
+        size_t len = 0;
+        const char* replacement = nullptr;
+
+        if (str[pos] == '[')
+        {
+            size_t close = str.find(']', pos + 1);
+            if (close != std::string_view::npos && close - pos - 1 <= COLOR_TAG_MAX_LENGTH)
+            {
+                const ColorTag* tag = FindColorTag(str.data() + pos + 1, close - pos - 1);
+                if (tag && (replacement = ResolveColorTag(tag, mode, team))) len = close - pos + 1;
+            }
+        }
+        else if ((len = MatchHtmlTag(str, pos)) > 0)
+        {
+            replacement = "";
+        }
+
+        if (len == 0)
+        {
+            pos++;
+            continue;
+        }
+
+        out.append(str.data() + last, pos - last);
+        out.append(replacement);
+        pos += len;
+        last = pos;
     }
-    return str;
+
+    out.append(str.data() + last, str.size() - last);
+}
+
+std::string ProcessColor(const std::string& str, int team)
+{
+    std::string out;
+    ProcessColorTags(str, out, ColorMode::Chat, team);
+    return out;
+}
+
+std::string ClearColors(const std::string& str)
+{
+    std::string out;
+    ProcessColorTags(str, out, ColorMode::Strip);
+    return out;
+}
+
+std::string TerminalProcessColor(const std::string& str)
+{
+    std::string out;
+    ProcessColorTags(str, out, ColorMode::Terminal);
+    return out;
+}
+
+std::string ClearTerminalColors(const std::string& str)
+{
+    std::string out;
+    ProcessColorTags(str, out, ColorMode::Strip);
+    return out;
 }
 
 std::string GetTerminalStringColor(std::string plugin_name)
@@ -344,8 +426,27 @@ std::string& trim(std::string& s, const char* t)
     return ltrim(rtrim(s, t), t);
 }
 
-std::string RemoveHtmlTags(std::string input) {
-    std::regex pattern("<(/?)(div|font)[^>]*>");
+std::string RemoveHtmlTags(const std::string& input)
+{
+    std::string out;
+    out.reserve(input.size());
+
+    size_t last = 0;
+    size_t pos = 0;
+    while ((pos = input.find('<', pos)) != std::string::npos)
+    {
+        size_t len = MatchHtmlTag(input, pos);
+        if (len == 0)
+        {
+            pos++;
+            continue;
+        }
 
-    return std::regex_replace(input, pattern, "");
-}
\ No newline at end of file
+        out.append(input, last, pos - last);
+        pos += len;
+        last = pos;
+    }
+
+    out.append(input, last, std::string::npos);
+    return out;
+}
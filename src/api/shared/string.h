@@ -20,45 +20,42 @@
 #define src_api_shared_string_h
 
 #include <string>
+#include <string_view>
 #include <vector>
 #include <set>
 
+#include "hash.h"
 #include "texttable.h"
 
 #include <api/interfaces/manager.h>
 
-constexpr uint32_t val_32_const = 0x811c9dc5;
-constexpr uint32_t prime_32_const = 0x1000193;
-constexpr uint64_t val_64_const = 0xcbf29ce484222325;
-constexpr uint64_t prime_64_const = 0x100000001b3;
-
-inline constexpr uint32_t hash_32_fnv1a_const(const char* const str, const uint32_t value = val_32_const) noexcept
-{
-    return (str[0] == '\0') ? value : hash_32_fnv1a_const(&str[1], (value ^ uint32_t(str[0])) * prime_32_const);
-}
-
-inline constexpr uint64_t hash_64_fnv1a_const(const char* const str, const uint64_t value = val_64_const) noexcept
-{
-    return (str[0] == '\0') ? value : hash_64_fnv1a_const(&str[1], (value ^ uint64_t(str[0])) * prime_64_const);
-}
-
 std::string replace(std::string str, const std::string from, const std::string to);
 std::vector<std::string> explode(std::string str, std::string delimiter);
 std::set<std::string> explodeToSet(std::string str, std::string delimiter);
 std::string implode(std::vector<std::string>& elements, std::string delimiter);
-std::string ProcessColor(std::string str, int team);
-std::string ClearColors(std::string str);
+std::string ProcessColor(const std::string& str, int team);
+std::string ClearColors(const std::string& str);
 bool ends_with(std::string value, std::string ending);
 bool starts_with(std::string value, std::string starting);
 uint64_t GetTime();
 std::string str_tolower(std::string s);
 std::string str_toupper(std::string s);
 std::string get_uuid();
-std::string TerminalProcessColor(std::string str);
-std::string ClearTerminalColors(std::string str);
+std::string TerminalProcessColor(const std::string& str);
+std::string ClearTerminalColors(const std::string& str);
 std::string GetTerminalStringColor(std::string plugin_name);
 std::vector<std::string> TokenizeCommand(std::string cmd);
-std::string RemoveHtmlTags(std::string input);
+std::string RemoveHtmlTags(const std::string& input);
+
+enum class ColorMode
+{
+    Chat,     // [color] -> chat color codes, [teamcolor] resolved from team
+    Terminal, // [color] -> ANSI escape sequences
+    Strip,    // every known [color] tag removed
+};
+
+// Single pass over str, appends the result to out. strip_html also drops <div>/<font> tags.
+void ProcessColorTags(std::string_view str, std::string& out, ColorMode mode, int team = 0, bool strip_html = false);
 
 std::string& trim(std::string& s, const char* t = " \t\n\r\f\v");
 
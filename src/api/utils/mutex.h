@@ -19,61 +19,105 @@
 #ifndef src_api_utils_mutex_h
 #define src_api_utils_mutex_h
 
+#include <atomic>
 #include <cstdint>
-#include <mutex>
-#include <queue>
-#include <condition_variable>
+#include <thread>
 
+#if defined(_M_X64) || defined(__x86_64__) || defined(_M_IX86) || defined(__i386__)
+#include <immintrin.h>
+#define QUEUE_MUTEX_PAUSE() _mm_pause()
+#else
+#define QUEUE_MUTEX_PAUSE() std::atomic_signal_fence(std::memory_order_seq_cst)
+#endif
+
+#define QUEUE_MUTEX_SLOTS 64
+#define QUEUE_MUTEX_SPIN_COUNT 128
+
+// Fair (FIFO) lock. Every locker takes a ticket and waits on its own slot, so an unlock
+// wakes exactly the next ticket instead of the whole queue. The next in line spins
+// briefly before parking on the slot (futex / WaitOnAddress through std::atomic::wait),
+// everyone further back parks right away.
 class QueueMutex
 {
 public:
-    QueueMutex() : locked(false) {}
+    QueueMutex()
+    {
+        // slot i starts out as already granted to the ticket one lap before i
+        for (uint32_t i = 0; i < QUEUE_MUTEX_SLOTS; i++)
+            m_Slots[i].granted.store(i == 0 ? 0 : i - QUEUE_MUTEX_SLOTS, std::memory_order_relaxed);
+    }
+
+    QueueMutex(const QueueMutex&) = delete;
+    QueueMutex& operator=(const QueueMutex&) = delete;
 
     void lock()
     {
-        std::unique_lock<std::mutex> lk(internal_m);
+        // seq_cst pairs with unlock: either it sees our ticket and notifies, or we see its grant
+        uint32_t ticket = m_uNext.fetch_add(1, std::memory_order_seq_cst);
+        auto& slot = m_Slots[ticket % QUEUE_MUTEX_SLOTS].granted;
 
-        if (!locked)
+        uint32_t granted = slot.load(std::memory_order_seq_cst);
+        if (granted != ticket)
         {
-            locked = true;
-            return;
-        }
-
-        std::condition_variable cv;
-        waiters.push(&cv);
+            // spinning only pays off if the holder can run at the same time
+            static const bool multicore = std::thread::hardware_concurrency() > 1;
+            if (multicore && ticket - m_uServing.load(std::memory_order_relaxed) <= 1)
+            {
+                for (int i = 0; i < QUEUE_MUTEX_SPIN_COUNT && granted != ticket; i++)
+                {
+                    QUEUE_MUTEX_PAUSE();
+                    granted = slot.load(std::memory_order_acquire);
+                }
+            }
 
-        cv.wait(lk, [&]
-            { return &cv == waiters.front(); });
+            while (granted != ticket)
+            {
+                slot.wait(granted, std::memory_order_acquire);
+                granted = slot.load(std::memory_order_acquire);
+            }
+        }
 
-        locked = true;
-        waiters.pop();
+        m_uOwner = ticket;
     }
 
     void unlock()
     {
-        std::lock_guard<std::mutex> lk(internal_m);
-        locked = false;
-        if (!waiters.empty())
-        {
-            waiters.front()->notify_one();
-        }
+        uint32_t next = m_uOwner + 1;
+        m_uServing.store(next, std::memory_order_relaxed);
+
+        auto& slot = m_Slots[next % QUEUE_MUTEX_SLOTS].granted;
+        slot.store(next, std::memory_order_seq_cst);
+
+        // more than QUEUE_MUTEX_SLOTS waiters can share a slot, the ones it wasn't meant for go back to sleep
+        if (m_uNext.load(std::memory_order_seq_cst) != next)
+            slot.notify_all();
     }
 
     bool try_lock()
     {
-        std::lock_guard<std::mutex> lk(internal_m);
-        if (!locked)
-        {
-            locked = true;
-            return true;
-        }
-        return false;
+        uint32_t serving = m_uServing.load(std::memory_order_relaxed);
+        if (m_Slots[serving % QUEUE_MUTEX_SLOTS].granted.load(std::memory_order_acquire) != serving)
+            return false;
+
+        uint32_t expected = serving;
+        if (!m_uNext.compare_exchange_strong(expected, serving + 1, std::memory_order_acquire, std::memory_order_relaxed))
+            return false;
+
+        m_uOwner = serving;
+        return true;
     }
 
 private:
-    std::mutex internal_m;
-    bool locked;
-    std::queue<std::condition_variable*> waiters;
+    struct Slot
+    {
+        std::atomic<uint32_t> granted;
+    };
+
+    alignas(64) std::atomic<uint32_t> m_uNext{ 0 };
+    alignas(64) std::atomic<uint32_t> m_uServing{ 0 };
+    uint32_t m_uOwner = 0;
+
+    Slot m_Slots[QUEUE_MUTEX_SLOTS];
 };
 
 class QueueLockGuard
@@ -93,4 +137,4 @@ private:
     bool owns;
 };
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,104 @@
+/************************************************************************************************
+ * SwiftlyS2 is a scripting framework for Source2-based games.
+ * Copyright (C) 2023-2026 Swiftly Solution SRL via Sava Andrei-Sebastian and it's contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ ************************************************************************************************/
+
+#ifndef src_api_utils_ringbuffer_h
+#define src_api_utils_ringbuffer_h
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+// Bounded lock-free queue for many producers and a single consumer.
+// Every cell carries a sequence number, producers claim a position with one CAS
+// and never wait on each other; a full queue makes TryPush fail instead of blocking.
+template<typename T>
+class MPSCRingBuffer
+{
+public:
+    // capacity has to be a power of two
+    explicit MPSCRingBuffer(size_t capacity) : m_uMask(capacity - 1), m_pCells(new Cell[capacity])
+    {
+        for (size_t i = 0; i < capacity; i++)
+            m_pCells[i].sequence.store(i, std::memory_order_relaxed);
+    }
+
+    MPSCRingBuffer(const MPSCRingBuffer&) = delete;
+    MPSCRingBuffer& operator=(const MPSCRingBuffer&) = delete;
+
+    bool TryPush(T&& value)
+    {
+        Cell* cell;
+        size_t pos = m_uEnqueuePos.load(std::memory_order_relaxed);
+
+        while (true)
+        {
+            cell = &m_pCells[pos & m_uMask];
+            size_t seq = cell->sequence.load(std::memory_order_acquire);
+            intptr_t diff = (intptr_t)seq - (intptr_t)pos;
+
+            if (diff == 0)
+            {
+                if (m_uEnqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    break;
+            }
+            else if (diff < 0)
+            {
+                return false;
+            }
+            else
+            {
+                pos = m_uEnqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+
+        cell->data = std::move(value);
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    // consumer thread only
+    bool TryPop(T& out)
+    {
+        Cell* cell = &m_pCells[m_uDequeuePos & m_uMask];
+        size_t seq = cell->sequence.load(std::memory_order_acquire);
+
+        if ((intptr_t)seq - (intptr_t)(m_uDequeuePos + 1) < 0)
+            return false;
+
+        out = std::move(cell->data);
+        cell->sequence.store(m_uDequeuePos + m_uMask + 1, std::memory_order_release);
+        m_uDequeuePos++;
+        return true;
+    }
+
+private:
+    struct Cell
+    {
+        std::atomic<size_t> sequence;
+        T data;
+    };
+
+    const size_t m_uMask;
+    std::unique_ptr<Cell[]> m_pCells;
+
+    alignas(64) std::atomic<size_t> m_uEnqueuePos{ 0 };
+    alignas(64) size_t m_uDequeuePos = 0;
+};
+
+#endif
@@ -32,6 +32,10 @@
 #include <engine/fixes/entrypoint.h>
 #include <engine/gamesystem/gamesystem.h>
 
+#include <monitor/timeline/timeline.h>
+
+#include "startup/graph.h"
+
 #include <public/tier0/icommandline.h>
 #include <public/tier1/utlstringtoken.h>
 
@@ -44,6 +48,10 @@
 
 #include <fmt/format.h>
 
+#include <algorithm>
+#include <mutex>
+#include <thread>
+
 #include <public/engine/igameeventsystem.h>
 #include <s2binlib/s2binlib.h>
 
@@ -106,9 +114,13 @@ bool SwiftlyCore::Load(BridgeKind_t kind)
         m_sLogPath += WIN_LINUX("\\", "/");
     }
 
+    TimelineScope startup("Startup");
+
+    g_Timeline.Begin("Crash reporter");
     auto crashreporter = g_ifaceService.FetchInterface<ICrashReporter>(CRASHREPORTER_INTERFACE_VERSION);
     crashreporter->Init();
 
+    g_Timeline.Next("s2binlib");
     s2binlib_initialize(Plat_GetGameDirectory(), "csgo");
 
 #ifdef _WIN32
@@ -129,6 +141,7 @@ bool SwiftlyCore::Load(BridgeKind_t kind)
     }
 #endif
 
+    g_Timeline.Next("ConVar registration");
     auto cvars = g_ifaceService.FetchInterface<ICvar>(CVAR_INTERFACE_VERSION);
     g_pCVar = cvars;
     ConVar_Register(FCVAR_RELEASE | FCVAR_SERVER_CAN_EXECUTE | FCVAR_CLIENT_CAN_EXECUTE | FCVAR_GAMEDLL, nullptr, nullptr);
@@ -161,126 +174,230 @@ bool SwiftlyCore::Load(BridgeKind_t kind)
         return false;
     }
 
-    auto configuration = g_ifaceService.FetchInterface<IConfiguration>(CONFIGURATION_INTERFACE_VERSION);
-    configuration->InitializeExamples();
-    if (!configuration->Load())
-    {
-        logger->Error("Entrypoint", "Couldn't load the core configuration.");
-        return false;
-    }
+    g_Timeline.End();
 
-    if (int* level = std::get_if<int>(&configuration->GetValue("core.DotnetCrashTracerLevel")))
-    {
-        if (*level > 0)
+    // Everything below is declared as phases with their dependencies. Parsing, schema and gamedata
+    // work plus the .NET runtime bootstrap run on workers, anything that touches engine state or
+    // sets up hooks stays on this thread and starts as soon as what it needs is ready.
+    StartupGraph graph;
+    std::string game = GetCurrentGame();
+    bool runtimeReady = false;
+
+    graph.Add("Configuration", {}, [logger]() {
+        auto configuration = g_ifaceService.FetchInterface<IConfiguration>(CONFIGURATION_INTERFACE_VERSION);
+        configuration->InitializeExamples();
+        if (!configuration->Load())
         {
-            auto crashreporter = g_ifaceService.FetchInterface<ICrashReporter>(CRASHREPORTER_INTERFACE_VERSION);
-            crashreporter->EnableDotnetCrashTracer(*level);
+            logger->Error("Entrypoint", "Couldn't load the core configuration.");
+            return false;
         }
-    }
-
-    auto sdkclass = g_ifaceService.FetchInterface<ISDKSchema>(SDKSCHEMA_INTERFACE_VERSION);
-    sdkclass->Load();
 
-    auto gamedata = g_ifaceService.FetchInterface<IGameDataManager>(GAMEDATA_INTERFACE_VERSION);
-    gamedata->GetOffsets()->Load(GetCurrentGame());
-    gamedata->GetSignatures()->Load(GetCurrentGame());
-    gamedata->GetPatches()->Load(GetCurrentGame());
-
-    if (std::string* s = std::get_if<std::string>(&configuration->GetValue("core.PatchesToPerform")))
-    {
-        auto patches = explodeToSet(*s, " ");
-        for (const auto& patch : patches)
+        // only environment variables, the runtime phase waits for this one before reading them
+        if (int* level = std::get_if<int>(&configuration->GetValue("core.DotnetCrashTracerLevel")))
         {
-            if (gamedata->GetPatches()->Exists(patch))
+            if (*level > 0)
             {
-                gamedata->GetPatches()->Apply(patch);
-                logger->Info("Patching", fmt::format("Applied patch: {}", patch));
+                auto crashreporter = g_ifaceService.FetchInterface<ICrashReporter>(CRASHREPORTER_INTERFACE_VERSION);
+                crashreporter->EnableDotnetCrashTracer(*level);
             }
-            else
+        }
+
+        // 0 MB keeps the files growing, rotation by date is independent of it
+        int* maxSizeMB = std::get_if<int>(&configuration->GetValue("core.Logs.MaxFileSizeMB"));
+        bool* rotateDaily = std::get_if<bool>(&configuration->GetValue("core.Logs.RotateDaily"));
+        logger->SetFileRotation(maxSizeMB && *maxSizeMB > 0 ? (uint64_t)*maxSizeMB * 1024 * 1024 : 0, rotateDaily && *rotateDaily);
+        return true;
+        }, StartupThread::Worker);
+
+    graph.Add("Schema", {}, []() {
+        auto sdkclass = g_ifaceService.FetchInterface<ISDKSchema>(SDKSCHEMA_INTERFACE_VERSION);
+        sdkclass->Load();
+        return true;
+        }, StartupThread::Worker);
+
+    graph.Add("Offsets", {}, [game]() {
+        auto gamedata = g_ifaceService.FetchInterface<IGameDataManager>(GAMEDATA_INTERFACE_VERSION);
+        gamedata->GetOffsets()->Load(game);
+        return true;
+        }, StartupThread::Worker);
+
+    graph.Add("Signatures", {}, [game]() {
+        auto gamedata = g_ifaceService.FetchInterface<IGameDataManager>(GAMEDATA_INTERFACE_VERSION);
+        gamedata->GetSignatures()->Load(game);
+        return true;
+        }, StartupThread::Worker);
+
+    graph.Add("Patches", { "Signatures" }, [game]() {
+        auto gamedata = g_ifaceService.FetchInterface<IGameDataManager>(GAMEDATA_INTERFACE_VERSION);
+        gamedata->GetPatches()->Load(game);
+        return true;
+        }, StartupThread::Worker);
+
+    graph.Add(".NET runtime", { "Configuration" }, [this, &runtimeReady]() {
+        runtimeReady = InitializeHostFXR(std::string(Plat_GetGameDirectory()) + "/csgo/" + m_sCorePath);
+        return true;
+        }, StartupThread::Worker);
+
+    graph.Add("Patching", { "Configuration", "Patches" }, [logger]() {
+        auto configuration = g_ifaceService.FetchInterface<IConfiguration>(CONFIGURATION_INTERFACE_VERSION);
+        auto gamedata = g_ifaceService.FetchInterface<IGameDataManager>(GAMEDATA_INTERFACE_VERSION);
+        if (std::string* s = std::get_if<std::string>(&configuration->GetValue("core.PatchesToPerform")))
+        {
+            auto patches = explodeToSet(*s, " ");
+            for (const auto& patch : patches)
             {
-                logger->Warning("Patching", fmt::format("Couldn't find patch: {}", patch));
+                if (gamedata->GetPatches()->Exists(patch))
+                {
+                    gamedata->GetPatches()->Apply(patch);
+                    logger->Info("Patching", fmt::format("Applied patch: {}", patch));
+                }
+                else
+                {
+                    logger->Warning("Patching", fmt::format("Couldn't find patch: {}", patch));
+                }
             }
         }
-    }
+        return true;
+        });
 
-    auto consoleoutput = g_ifaceService.FetchInterface<IConsoleOutput>(CONSOLEOUTPUT_INTERFACE_VERSION);
-    consoleoutput->Initialize();
-    if (bool* b = std::get_if<bool>(&configuration->GetValue("core.ConsoleFilter")))
-    {
-        if (*b)
+    auto hooksmanager = g_ifaceService.FetchInterface<IHooksManager>(HOOKSMANAGER_INTERFACE_VERSION);
+
+    graph.Add("Console output", { "Patching", "Schema", "Offsets" }, [hooksmanager]() {
+        // every hook the subsystems below set up gets patched in at once after StartFixes
+        hooksmanager->BeginHookTransaction();
+
+        auto configuration = g_ifaceService.FetchInterface<IConfiguration>(CONFIGURATION_INTERFACE_VERSION);
+        auto consoleoutput = g_ifaceService.FetchInterface<IConsoleOutput>(CONSOLEOUTPUT_INTERFACE_VERSION);
+        consoleoutput->Initialize();
+        if (bool* b = std::get_if<bool>(&configuration->GetValue("core.ConsoleFilter")))
         {
-            consoleoutput->ToggleFilter();
+            if (*b)
+            {
+                consoleoutput->ToggleFilter();
+            }
         }
-    }
+        return true;
+        });
 
-    auto entsystem = g_ifaceService.FetchInterface<IEntitySystem>(ENTITYSYSTEM_INTERFACE_VERSION);
-    entsystem->Initialize();
+    graph.Add("Entity system", { "Console output" }, []() {
+        auto entsystem = g_ifaceService.FetchInterface<IEntitySystem>(ENTITYSYSTEM_INTERFACE_VERSION);
+        entsystem->Initialize();
+        return true;
+        });
 
-    auto cvarmanager = g_ifaceService.FetchInterface<IConvarManager>(CONVARMANAGER_INTERFACE_VERSION);
-    cvarmanager->Initialize();
+    graph.Add("ConVar manager", { "Entity system" }, []() {
+        auto cvarmanager = g_ifaceService.FetchInterface<IConvarManager>(CONVARMANAGER_INTERFACE_VERSION);
+        cvarmanager->Initialize();
+        return true;
+        });
 
-    auto evmanager = g_ifaceService.FetchInterface<IEventManager>(GAMEEVENTMANAGER_INTERFACE_VERSION);
-    evmanager->Initialize(GetCurrentGame());
+    graph.Add("Game events", { "ConVar manager" }, [game]() {
+        auto evmanager = g_ifaceService.FetchInterface<IEventManager>(GAMEEVENTMANAGER_INTERFACE_VERSION);
+        evmanager->Initialize(game);
+        return true;
+        });
 
-    if (!InitGameSystem())
-    {
-        logger->Error("Game System", "Couldn't initialize the Game System.\n");
-        return false;
-    }
+    graph.Add("Game system", { "Game events" }, [logger, hooksmanager]() {
+        if (!InitGameSystem())
+        {
+            logger->Error("Game System", "Couldn't initialize the Game System.\n");
+            hooksmanager->CommitHookTransaction();
+            return false;
+        }
+        return true;
+        });
 
-    auto playermanager = g_ifaceService.FetchInterface<IPlayerManager>(PLAYERMANAGER_INTERFACE_VERSION);
-    playermanager->Initialize();
+    graph.Add("Players", { "Game system" }, []() {
+        auto playermanager = g_ifaceService.FetchInterface<IPlayerManager>(PLAYERMANAGER_INTERFACE_VERSION);
+        playermanager->Initialize();
+        return true;
+        });
 
-    auto databasemanager = g_ifaceService.FetchInterface<IDatabaseManager>(DATABASEMANAGER_INTERFACE_VERSION);
-    databasemanager->Initialize();
+    graph.Add("Database", { "Players" }, []() {
+        auto databasemanager = g_ifaceService.FetchInterface<IDatabaseManager>(DATABASEMANAGER_INTERFACE_VERSION);
+        databasemanager->Initialize();
+        return true;
+        });
 
-    auto translations = g_ifaceService.FetchInterface<ITranslations>(TRANSLATIONS_INTERFACE_VERSION);
-    translations->Initialize();
+    graph.Add("Translations", { "Database" }, []() {
+        auto translations = g_ifaceService.FetchInterface<ITranslations>(TRANSLATIONS_INTERFACE_VERSION);
+        translations->Initialize();
+        return true;
+        });
 
-    auto netmessages = g_ifaceService.FetchInterface<INetMessages>(NETMESSAGES_INTERFACE_VERSION);
-    netmessages->Initialize();
+    graph.Add("Net messages", { "Translations" }, []() {
+        auto netmessages = g_ifaceService.FetchInterface<INetMessages>(NETMESSAGES_INTERFACE_VERSION);
+        netmessages->Initialize();
+        return true;
+        });
 
-    auto servercommands = g_ifaceService.FetchInterface<IServerCommands>(SERVERCOMMANDS_INTERFACE_VERSION);
-    servercommands->Initialize();
+    graph.Add("Server commands", { "Net messages" }, []() {
+        auto servercommands = g_ifaceService.FetchInterface<IServerCommands>(SERVERCOMMANDS_INTERFACE_VERSION);
+        servercommands->Initialize();
+        return true;
+        });
 
-    auto hooksmanager = g_ifaceService.FetchInterface<IHooksManager>(HOOKSMANAGER_INTERFACE_VERSION);
-    hooksmanager->Initialize();
+    graph.Add("Hooks", { "Server commands" }, [hooksmanager]() {
+        auto gamedata = g_ifaceService.FetchInterface<IGameDataManager>(GAMEDATA_INTERFACE_VERSION);
+        hooksmanager->Initialize();
 
-    void* loopmodeLevelLoad = nullptr;
-    s2binlib_find_vtable("engine2", "CLoopModeLevelLoad", &loopmodeLevelLoad);
+        void* loopmodeLevelLoad = nullptr;
+        s2binlib_find_vtable("engine2", "CLoopModeLevelLoad", &loopmodeLevelLoad);
 
-    g_pLoopInitHook = hooksmanager->CreateVFunctionHook();
-    g_pLoopInitHook->SetHookFunction(loopmodeLevelLoad, gamedata->GetOffsets()->Fetch("ILoopMode::LoopInit"), (void*)LoopInitHook, true);
-    g_pLoopInitHook->Enable();
+        g_pLoopInitHook = hooksmanager->CreateVFunctionHook();
+        g_pLoopInitHook->SetHookFunction(loopmodeLevelLoad, gamedata->GetOffsets()->Fetch(GameDataOffset::ILoopMode_LoopInit), (void*)LoopInitHook, true);
+        g_pLoopInitHook->Enable();
 
-    void* servervtable = nullptr;
-    s2binlib_find_vtable("server", "CSource2Server", &servervtable);
+        void* servervtable = nullptr;
+        s2binlib_find_vtable("server", "CSource2Server", &servervtable);
 
-    g_pGameServerSteamAPIActivated = hooksmanager->CreateVFunctionHook();
-    g_pGameServerSteamAPIActivated->SetHookFunction(servervtable, gamedata->GetOffsets()->Fetch("IServerGameDLL::GameServerSteamAPIActivated"), (void*)GameServerSteamAPIActivatedHook, true);
-    g_pGameServerSteamAPIActivated->Enable();
+        g_pGameServerSteamAPIActivated = hooksmanager->CreateVFunctionHook();
+        g_pGameServerSteamAPIActivated->SetHookFunction(servervtable, gamedata->GetOffsets()->Fetch(GameDataOffset::IServerGameDLL_GameServerSteamAPIActivated), (void*)GameServerSteamAPIActivatedHook, true);
+        g_pGameServerSteamAPIActivated->Enable();
 
-    g_pGameServerSteamAPIDeactivated = hooksmanager->CreateVFunctionHook();
-    g_pGameServerSteamAPIDeactivated->SetHookFunction(servervtable, gamedata->GetOffsets()->Fetch("IServerGameDLL::GameServerSteamAPIDeactivated"), (void*)GameServerSteamAPIDeactivatedHook, true);
-    g_pGameServerSteamAPIDeactivated->Enable();
+        g_pGameServerSteamAPIDeactivated = hooksmanager->CreateVFunctionHook();
+        g_pGameServerSteamAPIDeactivated->SetHookFunction(servervtable, gamedata->GetOffsets()->Fetch(GameDataOffset::IServerGameDLL_GameServerSteamAPIDeactivated), (void*)GameServerSteamAPIDeactivatedHook, true);
+        g_pGameServerSteamAPIDeactivated->Enable();
+        return true;
+        });
 
-    StartFixes();
+    graph.Add("Fixes", { "Hooks" }, []() {
+        StartFixes();
+        return true;
+        });
 
-    auto scripting = g_ifaceService.FetchInterface<IScriptingAPI>(SCRIPTING_INTERFACE_VERSION);
+    graph.Add("Hook commit", { "Fixes" }, [hooksmanager]() {
+        hooksmanager->CommitHookTransaction();
+        return true;
+        });
 
-    if (!InitializeHostFXR(std::string(Plat_GetGameDirectory()) + "/csgo/" + m_sCorePath))
-    {
+    graph.Add("Managed host", { "Hook commit", ".NET runtime" }, [this, &runtimeReady]() {
         auto crashreporter = g_ifaceService.FetchInterface<ICrashReporter>(CRASHREPORTER_INTERFACE_VERSION);
-        crashreporter->ReportPreventionIncident("Managed", fmt::format("Couldn't initialize the .NET runtime. Make sure you installed `swiftlys2-{}-{}-with-runtimes.zip`.", WIN_LINUX("windows", "linux"), GetVersion()));
+        if (!runtimeReady)
+        {
+            crashreporter->ReportPreventionIncident("Managed", fmt::format("Couldn't initialize the .NET runtime. Make sure you installed `swiftlys2-{}-{}-with-runtimes.zip`.", WIN_LINUX("windows", "linux"), GetVersion()));
+            return true;
+        }
+
+        auto scripting = g_ifaceService.FetchInterface<IScriptingAPI>(SCRIPTING_INTERFACE_VERSION);
+        if (!InitializeDotNetAPI(scripting->GetNativeFunctions(), scripting->GetNativeFunctionsCount(), scripting->GetNativeNamesHash(), std::string(Plat_GetGameDirectory()) + "/csgo/" + m_sLogPath))
+        {
+            crashreporter->ReportPreventionIncident("Managed", "Couldn't initialize the .NET scripting API.");
+        }
         return true;
-    }
-    if (!InitializeDotNetAPI(scripting->GetNativeFunctions(), scripting->GetNativeFunctionsCount(), std::string(Plat_GetGameDirectory()) + "/csgo/" + m_sLogPath))
+        });
+
+    int workers = CommandLine()->ParmValue(CUtlStringToken("-sw_startup_threads"), (int)std::min<uint32_t>(std::thread::hardware_concurrency(), STARTUP_MAX_WORKERS));
+    if (!graph.Run((uint32_t)std::max(workers, 0)))
     {
-        auto crashreporter = g_ifaceService.FetchInterface<ICrashReporter>(CRASHREPORTER_INTERFACE_VERSION);
-        crashreporter->ReportPreventionIncident("Managed", "Couldn't initialize the .NET scripting API.");
-        return true;
+        logger->Error("Entrypoint", fmt::format("Startup stopped at phase '{}'.\n", graph.GetFailedPhase()));
+        return false;
     }
 
+    startup.End();
+    g_Timeline.Pin();
+    logger->Info("Timeline", fmt::format("Startup phases:\n{}", g_Timeline.GetSummary("Startup")));
+
     return true;
 }
 
@@ -328,6 +445,9 @@ bool SwiftlyCore::Unload()
     auto crashreporter = g_ifaceService.FetchInterface<ICrashReporter>(CRASHREPORTER_INTERFACE_VERSION);
     crashreporter->Shutdown();
 
+    auto logger = g_ifaceService.FetchInterface<ILogger>(LOGGER_INTERFACE_VERSION);
+    logger->Shutdown();
+
     return true;
 }
 
@@ -386,11 +506,21 @@ std::string current_map = "";
 
 bool LoopInitHook(void* _this, KeyValues* pKeyValues, void* pRegistry)
 {
-    if (current_map != "") g_SwiftlyCore.OnMapUnload();
+    TimelineScope mapChange(fmt::format("Map change ({})", pKeyValues->GetString("levelname")), "map");
+
+    if (current_map != "")
+    {
+        g_Timeline.Begin("Map unload callbacks", "map");
+        g_SwiftlyCore.OnMapUnload();
+        g_Timeline.End();
+    }
 
+    g_Timeline.Begin("Level load", "map");
     bool ret = reinterpret_cast<decltype(&LoopInitHook)>(g_pLoopInitHook->GetOriginal())(_this, pKeyValues, pRegistry);
 
+    g_Timeline.Next("Map load callbacks");
     g_SwiftlyCore.OnMapLoad(pKeyValues->GetString("levelname"));
+    g_Timeline.End();
 
     if (pKeyValues->FindKey("customgamemode"))
     {
@@ -428,13 +558,20 @@ void SwiftlyCore::OnMapUnload()
 }
 
 std::map<std::string, void*> g_mInterfacesCache;
+std::mutex g_InterfacesCacheMutex;
 
 void* SwiftlyCore::GetInterface(const std::string& interface_name)
 {
-    auto it = g_mInterfacesCache.find(interface_name);
-    if (it != g_mInterfacesCache.end())
+    // startup phases fetch interfaces from worker threads too. The lock only covers the cache,
+    // phases resolving different interfaces don't wait on each other's library loads.
     {
-        return it->second;
+        std::lock_guard lock(g_InterfacesCacheMutex);
+
+        auto it = g_mInterfacesCache.find(interface_name);
+        if (it != g_mInterfacesCache.end())
+        {
+            return it->second;
+        }
     }
 
     void* ifaceptr = nullptr;
@@ -489,7 +626,9 @@ void* SwiftlyCore::GetInterface(const std::string& interface_name)
 
     if (ifaceptr != nullptr)
     {
-        g_mInterfacesCache.insert({ interface_name, ifaceptr });
+        // CreateInterface hands out the same instance every time, whoever inserted first wins
+        std::lock_guard lock(g_InterfacesCacheMutex);
+        ifaceptr = g_mInterfacesCache.insert({ interface_name, ifaceptr }).first->second;
     }
 
     return ifaceptr;
@@ -167,9 +167,9 @@ bool InitializeHostFXR(std::string origin_path)
     return true;
 }
 
-bool InitializeDotNetAPI(void* scripting_table, int scripting_table_size, std::string log_path)
+bool InitializeDotNetAPI(void* scripting_table, int scripting_table_size, uint64_t scripting_names_hash, std::string log_path)
 {
-    typedef void(CORECLR_DELEGATE_CALLTYPE * custom_loader_fn)(void*, int, const char*, const char*);
+    typedef void(CORECLR_DELEGATE_CALLTYPE * custom_loader_fn)(void*, int, uint64_t, const char*, const char*);
     static custom_loader_fn custom_loader = nullptr;
 
     if (custom_loader == nullptr)
@@ -192,7 +192,7 @@ bool InitializeDotNetAPI(void* scripting_table, int scripting_table_size, std::s
         static std::string s = log_path;
 
         // Pass the callback setter function pointer to C#
-        custom_loader(scripting_table, scripting_table_size, original_path.c_str(), s.c_str());
+        custom_loader(scripting_table, scripting_table_size, scripting_names_hash, original_path.c_str(), s.c_str());
     }
 
     return true;
@@ -4,10 +4,11 @@
 #include <coreclr_delegates.h>
 #include <hostfxr.h>
 #include <nethost.h>
+#include <cstdint>
 #include <string>
 
 bool InitializeHostFXR(std::string origin_path);
-bool InitializeDotNetAPI(void* scripting_table, int scripting_table_size, std::string log_path);
+bool InitializeDotNetAPI(void* scripting_table, int scripting_table_size, uint64_t scripting_names_hash, std::string log_path);
 void CloseHostFXR();
 
 int GetManagedStackTraceJson(char* buffer, int bufferSize);
@@ -0,0 +1,214 @@
+/************************************************************************************************
+ *  SwiftlyS2 is a scripting framework for Source2-based games.
+ *  Copyright (C) 2023-2026 Swiftly Solution SRL via Sava Andrei-Sebastian and it's contributors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ ************************************************************************************************/
+
+#include "graph.h"
+
+#include <api/interfaces/manager.h>
+#include <monitor/timeline/timeline.h>
+
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <thread>
+
+#include <fmt/format.h>
+
+void StartupGraph::Add(const std::string& name, std::vector<std::string> dependencies, std::function<bool()> run, StartupThread thread)
+{
+    m_vPhases.push_back({ name, std::move(dependencies), thread, std::move(run) });
+}
+
+const std::string& StartupGraph::GetFailedPhase() const
+{
+    return m_sFailedPhase;
+}
+
+bool StartupGraph::Resolve(std::vector<std::vector<size_t>>& dependents, std::vector<uint32_t>& pending)
+{
+    auto logger = g_ifaceService.FetchInterface<ILogger>(LOGGER_INTERFACE_VERSION);
+
+    std::map<std::string, size_t> indexes;
+    for (size_t i = 0; i < m_vPhases.size(); i++)
+    {
+        if (!indexes.emplace(m_vPhases[i].name, i).second)
+        {
+            logger->Error("Startup", fmt::format("Startup phase '{}' is declared twice.\n", m_vPhases[i].name));
+            return false;
+        }
+    }
+
+    dependents.assign(m_vPhases.size(), {});
+    pending.assign(m_vPhases.size(), 0);
+
+    for (size_t i = 0; i < m_vPhases.size(); i++)
+    {
+        for (auto& dependency : m_vPhases[i].dependencies)
+        {
+            auto it = indexes.find(dependency);
+            if (it == indexes.end())
+            {
+                logger->Error("Startup", fmt::format("Startup phase '{}' depends on unknown phase '{}'.\n", m_vPhases[i].name, dependency));
+                return false;
+            }
+
+            dependents[it->second].push_back(i);
+            pending[i]++;
+        }
+    }
+
+    // Kahn's walk, anything left with pending dependencies sits on a cycle
+    std::vector<uint32_t> remaining = pending;
+    std::vector<size_t> ready;
+    for (size_t i = 0; i < m_vPhases.size(); i++)
+        if (remaining[i] == 0) ready.push_back(i);
+
+    size_t visited = 0;
+    while (!ready.empty())
+    {
+        size_t index = ready.back();
+        ready.pop_back();
+        visited++;
+
+        for (size_t dependent : dependents[index])
+            if (--remaining[dependent] == 0) ready.push_back(dependent);
+    }
+
+    if (visited != m_vPhases.size())
+    {
+        for (size_t i = 0; i < m_vPhases.size(); i++)
+        {
+            if (remaining[i] > 0)
+            {
+                logger->Error("Startup", fmt::format("Startup phase '{}' is part of a dependency cycle.\n", m_vPhases[i].name));
+                break;
+            }
+        }
+        return false;
+    }
+
+    return true;
+}
+
+bool StartupGraph::Execute(size_t index)
+{
+    TimelineScope scope(m_vPhases[index].name);
+    return m_vPhases[index].run();
+}
+
+bool StartupGraph::Run(uint32_t workers)
+{
+    std::vector<std::vector<size_t>> dependents;
+    std::vector<uint32_t> pending;
+    if (!Resolve(dependents, pending))
+    {
+        m_sFailedPhase = "dependency graph";
+        return false;
+    }
+
+    size_t workerPhases = 0;
+    for (auto& phase : m_vPhases)
+        if (phase.thread == StartupThread::Worker) workerPhases++;
+
+    workers = (uint32_t)std::min<size_t>(workers, workerPhases);
+
+    std::mutex mutex;
+    std::condition_variable signal;
+    std::deque<size_t> mainQueue;
+    std::deque<size_t> workerQueue;
+    size_t finished = 0;
+    size_t running = 0;
+    bool failed = false;
+    bool stop = false;
+
+    auto enqueue = [&](size_t index) {
+        if (m_vPhases[index].thread == StartupThread::Worker && workers > 0) workerQueue.push_back(index);
+        else mainQueue.push_back(index);
+        };
+
+    // called with the mutex held
+    auto complete = [&](size_t index, bool ok) {
+        finished++;
+        if (!ok)
+        {
+            if (!failed) m_sFailedPhase = m_vPhases[index].name;
+            failed = true;
+        }
+        else
+        {
+            for (size_t dependent : dependents[index])
+                if (--pending[dependent] == 0) enqueue(dependent);
+        }
+        signal.notify_all();
+        };
+
+    for (size_t i = 0; i < m_vPhases.size(); i++)
+        if (pending[i] == 0) enqueue(i);
+
+    std::vector<std::thread> threads;
+    for (uint32_t i = 0; i < workers; i++)
+    {
+        threads.emplace_back([&]() {
+            std::unique_lock lock(mutex);
+            while (true)
+            {
+                signal.wait(lock, [&]() { return stop || failed || !workerQueue.empty(); });
+                if (stop || failed) return;
+
+                size_t index = workerQueue.front();
+                workerQueue.pop_front();
+                running++;
+
+                lock.unlock();
+                bool ok = Execute(index);
+                lock.lock();
+
+                running--;
+                complete(index, ok);
+            }
+            });
+    }
+
+    {
+        std::unique_lock lock(mutex);
+        while (true)
+        {
+            signal.wait(lock, [&]() { return (!failed && !mainQueue.empty()) || (running == 0 && (failed || finished == m_vPhases.size() || workerQueue.empty())); });
+            if (failed || mainQueue.empty()) break;
+
+            size_t index = mainQueue.front();
+            mainQueue.pop_front();
+            running++;
+
+            lock.unlock();
+            bool ok = Execute(index);
+            lock.lock();
+
+            running--;
+            complete(index, ok);
+        }
+
+        stop = true;
+        signal.notify_all();
+    }
+
+    for (auto& thread : threads)
+        thread.join();
+
+    return !failed && finished == m_vPhases.size();
+}
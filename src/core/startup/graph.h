@@ -0,0 +1,65 @@
+/************************************************************************************************
+ *  SwiftlyS2 is a scripting framework for Source2-based games.
+ *  Copyright (C) 2023-2026 Swiftly Solution SRL via Sava Andrei-Sebastian and it's contributors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ ************************************************************************************************/
+
+#ifndef src_core_startup_graph_h
+#define src_core_startup_graph_h
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+#define STARTUP_MAX_WORKERS 4
+
+enum class StartupThread
+{
+    Main,
+    Worker
+};
+
+struct StartupPhase
+{
+    std::string name;
+    std::vector<std::string> dependencies;
+    StartupThread thread = StartupThread::Main;
+    std::function<bool()> run;
+};
+
+// Init phases with explicit dependencies. A phase starts as soon as everything it depends on
+// finished, worker phases go to a small thread pool while the calling thread keeps running the
+// main phases, so independent work overlaps instead of queueing up behind each other.
+class StartupGraph
+{
+public:
+    void Add(const std::string& name, std::vector<std::string> dependencies, std::function<bool()> run, StartupThread thread = StartupThread::Main);
+
+    // false when a phase failed or the graph is invalid, phases depending on a failed one never run
+    // workers = 0 runs every phase on the calling thread, in dependency order
+    bool Run(uint32_t workers);
+
+    const std::string& GetFailedPhase() const;
+
+private:
+    bool Resolve(std::vector<std::vector<size_t>>& dependents, std::vector<uint32_t>& pending);
+    bool Execute(size_t index);
+
+    std::vector<StartupPhase> m_vPhases;
+    std::string m_sFailedPhase;
+};
+
+#endif
@@ -17,41 +17,59 @@
  ************************************************************************************************/
 
 #include "consoleoutput.h"
+#include "filters.h"
 
 #include <core/entrypoint.h>
 
 #include <api/interfaces/manager.h>
-#include <pcre2.h>
 #include <fmt/format.h>
 
 #include <api/shared/jsonc.h>
 #include <api/shared/files.h>
 
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <shared_mutex>
+
 using json = nlohmann::json;
 
 std::map<uint64_t, std::function<void(const std::string&)>> g_ConsoleListeners;
-std::map<std::string, pcre2_code*> g_Filters;
+
+std::unique_ptr<ConsoleFilterSet> g_pFilters;
+std::shared_mutex g_FiltersMutex;
 
 bool g_bEnabled = false;
-std::map<std::string, uint64_t> g_FilteredMessages;
 
 IFunctionHook* g_CLoggingSystem_LogDirect_Hook = nullptr;
 
+bool MatchesConsoleFilter(const char* text, size_t len);
+
 int CLoggingSystem_LogDirectHook(void* loggingSystem, int channel, int severity, LeafCodeInfo_t* leafCode, char const* str, va_list* args)
 {
     char buf[MAX_LOGGING_MESSAGE_LENGTH];
+    const char* text = str;
+    size_t len = 0;
     if (args) {
         va_list cpargs;
         va_copy(cpargs, *args);
-        V_vsnprintf(buf, sizeof(buf), str, cpargs);
+        int written = V_vsnprintf(buf, sizeof(buf), str, cpargs);
         va_end(cpargs);
+
+        text = buf;
+        len = written < 0 ? 0 : std::min<size_t>(written, sizeof(buf) - 1);
+    }
+    else {
+        len = strlen(str);
     }
 
-    static auto consoleoutput = g_ifaceService.FetchInterface<IConsoleOutput>(CONSOLEOUTPUT_INTERFACE_VERSION);
-    if (consoleoutput->NeedsFiltering(args ? buf : str)) return 0;
+    if (g_bEnabled && MatchesConsoleFilter(text, len)) return 0;
 
-    for (const auto& [id, callback] : g_ConsoleListeners)
-        callback(args ? buf : str);
+    if (!g_ConsoleListeners.empty()) {
+        std::string message(text, len);
+        for (const auto& [id, callback] : g_ConsoleListeners)
+            callback(message);
+    }
 
     return reinterpret_cast<decltype(&CLoggingSystem_LogDirectHook)>(g_CLoggingSystem_LogDirect_Hook->GetOriginal())(loggingSystem, channel, severity, leafCode, str, args);
 }
@@ -61,7 +79,7 @@ void CConsoleOutput::Initialize()
     auto hooksmanager = g_ifaceService.FetchInterface<IHooksManager>(HOOKSMANAGER_INTERFACE_VERSION);
     auto gamedata = g_ifaceService.FetchInterface<IGameDataManager>(GAMEDATA_INTERFACE_VERSION);
 
-    void* LogDirectAddr = gamedata->GetSignatures()->Fetch("CLoggingSystem::LogDirect");
+    void* LogDirectAddr = gamedata->GetSignatures()->Fetch(GameDataSignature::CLoggingSystem_LogDirect);
     if (!LogDirectAddr) return;
 
     g_CLoggingSystem_LogDirect_Hook = hooksmanager->CreateFunctionHook();
@@ -80,34 +98,34 @@ void CConsoleOutput::Shutdown()
         hooksmanager->DestroyFunctionHook(g_CLoggingSystem_LogDirect_Hook);
         g_CLoggingSystem_LogDirect_Hook = nullptr;
     }
+
+    std::unique_lock lock(g_FiltersMutex);
+    g_pFilters.reset();
 }
 
 void CConsoleOutput::ReloadFilterConfiguration()
 {
-    for (auto it = g_Filters.begin(); it != g_Filters.end(); ++it)
-        pcre2_code_free(it->second);
-
-    g_Filters.clear();
-    g_FilteredMessages.clear();
+    static auto logger = g_ifaceService.FetchInterface<ILogger>(LOGGER_INTERFACE_VERSION);
 
     json filters = json::object();
     filters = parseJsonc(Files::Read(g_SwiftlyCore.GetCorePath() + "/configs/confilter.jsonc"));
 
-    for (auto& [key, value] : filters.items()) {
-        pcre2_code* re;
-        PCRE2_SIZE erroffset;
-        int errorcode;
+    // the new set is built off to the side, errors are logged through LogDirect which takes the filters lock
+    auto newFilters = std::make_unique<ConsoleFilterSet>();
 
-        re = pcre2_compile((PCRE2_SPTR8)(value.get<std::string>().c_str()), PCRE2_ZERO_TERMINATED, 0, &errorcode, &erroffset, nullptr);
-        if (!re) {
-            static auto logger = g_ifaceService.FetchInterface<ILogger>(LOGGER_INTERFACE_VERSION);
+    for (auto& [key, value] : filters.items()) {
+        size_t erroffset;
+        if (!newFilters->Add(key, value.get<std::string>(), erroffset)) {
             logger->Error("Console Filter", fmt::format("The regex for \"{}\" is not valid.\n", key));
             logger->Error("Console Filter", fmt::format("Failed to compile at offset {}.\n", erroffset));
-            continue;
         }
+    }
+
+    newFilters->Compile();
 
-        g_Filters.insert({ key, re });
-        g_FilteredMessages.insert({ key, 0 });
+    {
+        std::unique_lock lock(g_FiltersMutex);
+        g_pFilters.swap(newFilters);
     }
 }
 
@@ -121,37 +139,28 @@ bool CConsoleOutput::IsEnabled()
     return g_bEnabled;
 }
 
+bool MatchesConsoleFilter(const char* text, size_t len)
+{
+    std::shared_lock lock(g_FiltersMutex);
+    return g_pFilters && g_pFilters->Matches(text, len);
+}
+
 bool CConsoleOutput::NeedsFiltering(const std::string& text)
 {
     if (!IsEnabled()) return false;
 
-    PCRE2_SPTR str = (PCRE2_SPTR)(text.c_str());
-    int len = text.size();
-
-    for (auto it = g_Filters.begin(); it != g_Filters.end(); ++it)
-    {
-        pcre2_code* re = it->second;
-        pcre2_match_data* match_data = pcre2_match_data_create_from_pattern(re, nullptr);
-
-        if (pcre2_match(re, str, len, 0, 0, match_data, nullptr) > 0)
-        {
-            const std::string& key = it->first;
-            g_FilteredMessages[key]++;
-            pcre2_match_data_free(match_data);
-            return true;
-        }
-
-        pcre2_match_data_free(match_data);
-    }
-
-    return false;
+    return MatchesConsoleFilter(text.c_str(), text.size());
 }
 
 std::string CConsoleOutput::GetCounterText()
 {
+    std::shared_lock lock(g_FiltersMutex);
+
     std::string out;
-    for (const auto& [msg, count] : g_FilteredMessages)
-        out += "- " + msg + " -> " + std::to_string(count) + "\n";
+    if (!g_pFilters) return out;
+
+    for (const auto& filter : g_pFilters->GetFilters())
+        out += "- " + filter->key + " -> " + std::to_string(filter->matches.load(std::memory_order_relaxed)) + "\n";
 
     return out;
 }
@@ -0,0 +1,184 @@
+/************************************************************************************************
+ *  SwiftlyS2 is a scripting framework for Source2-based games.
+ *  Copyright (C) 2023-2026 Swiftly Solution SRL via Sava Andrei-Sebastian and it's contributors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ ************************************************************************************************/
+
+#include "filters.h"
+
+#include <fmt/format.h>
+
+#include <cctype>
+#include <cstdlib>
+
+// Whether the pattern still means the same once it's one branch of the alternation. Not the case for
+// an unterminated \Q (it quotes every following branch), subroutine calls, recursion and numbered
+// conditions (they refer to groups of other filters), and extended mode (a # comment swallows the
+// rest of the alternation). Backreferences are caught through PCRE2_INFO_BACKREFMAX.
+static bool IsSelfContained(const std::string& pattern)
+{
+    bool inClass = false;
+
+    for (size_t i = 0; i < pattern.size(); i++) {
+        char c = pattern[i];
+
+        if (c == '\\') {
+            if (i + 1 >= pattern.size()) return false;
+
+            char next = pattern[i + 1];
+            if (next == 'Q') {
+                size_t end = pattern.find("\\E", i + 2);
+                if (end == std::string::npos) return false;
+                i = end + 1;
+                continue;
+            }
+
+            // \g<name> and \g'name' are Oniguruma style subroutine calls
+            if (!inClass && next == 'g' && i + 2 < pattern.size() && (pattern[i + 2] == '<' || pattern[i + 2] == '\'')) return false;
+
+            i++;
+            continue;
+        }
+
+        if (inClass) {
+            if (c == '[' && i + 1 < pattern.size() && pattern[i + 1] == ':') {
+                size_t end = pattern.find(":]", i + 2);
+                if (end != std::string::npos) i = end + 1;
+            }
+            else if (c == ']') {
+                inClass = false;
+            }
+            continue;
+        }
+
+        if (c == '[') {
+            inClass = true;
+            // a ] right after [ or [^ is a literal
+            if (i + 1 < pattern.size() && pattern[i + 1] == '^') i++;
+            if (i + 1 < pattern.size() && pattern[i + 1] == ']') i++;
+            continue;
+        }
+
+        if (c != '(' || i + 2 >= pattern.size() || pattern[i + 1] != '?') continue;
+
+        char next = pattern[i + 2];
+
+        // (?1) (?+1) (?-1) (?R) (?&name) (?P>name) and conditions (?(...)
+        if (isdigit((unsigned char)next) || next == '+' || next == 'R' || next == '&' || next == '(' ||
+            (next == '-' && i + 3 < pattern.size() && isdigit((unsigned char)pattern[i + 3])) ||
+            (next == 'P' && i + 3 < pattern.size() && pattern[i + 3] == '>'))
+            return false;
+
+        // option settings like (?x) or (?i-s:...), only turning x on matters
+        for (size_t j = i + 2; j < pattern.size() && (isalpha((unsigned char)pattern[j]) || pattern[j] == '^' || pattern[j] == '-'); j++) {
+            if (pattern[j] == '-') break;
+            if (pattern[j] == 'x') return false;
+        }
+    }
+
+    return true;
+}
+
+ConsoleFilterSet::~ConsoleFilterSet()
+{
+    if (m_pCombinedFilter) pcre2_code_free(m_pCombinedFilter);
+
+    for (auto& filter : m_vFilters)
+        pcre2_code_free(filter->re);
+}
+
+bool ConsoleFilterSet::Add(const std::string& key, const std::string& pattern, size_t& erroffset)
+{
+    PCRE2_SIZE offset;
+    int errorcode;
+
+    pcre2_code* re = pcre2_compile((PCRE2_SPTR8)(pattern.c_str()), PCRE2_ZERO_TERMINATED, 0, &errorcode, &offset, nullptr);
+    if (!re) {
+        erroffset = offset;
+        return false;
+    }
+
+    auto filter = std::make_unique<ConsoleFilter>();
+    filter->key = key;
+    filter->re = re;
+
+    uint32_t backrefmax = 0;
+    pcre2_pattern_info(re, PCRE2_INFO_BACKREFMAX, &backrefmax);
+
+    if (backrefmax > 0 || !IsSelfContained(pattern)) {
+        pcre2_jit_compile(re, PCRE2_JIT_COMPLETE);
+        m_vSeparateFilters.push_back(filter.get());
+    }
+    else {
+        if (!m_sCombinedPattern.empty()) m_sCombinedPattern += "|";
+        m_sCombinedPattern += fmt::format("(*MARK:{})(?:{})", m_vFilters.size(), pattern);
+    }
+
+    m_vFilters.push_back(std::move(filter));
+    return true;
+}
+
+void ConsoleFilterSet::Compile()
+{
+    if (m_sCombinedPattern.empty()) return;
+
+    PCRE2_SIZE erroffset;
+    int errorcode;
+    m_pCombinedFilter = pcre2_compile((PCRE2_SPTR8)(m_sCombinedPattern.c_str()), m_sCombinedPattern.size(), 0, &errorcode, &erroffset, nullptr);
+
+    if (m_pCombinedFilter) {
+        m_bCombinedFilterJIT = pcre2_jit_compile(m_pCombinedFilter, PCRE2_JIT_COMPLETE) == 0;
+    }
+    else {
+        // e.g. the same group name used by two filters, fall back to matching them one by one
+        m_vSeparateFilters.clear();
+        for (auto& filter : m_vFilters) {
+            pcre2_jit_compile(filter->re, PCRE2_JIT_COMPLETE);
+            m_vSeparateFilters.push_back(filter.get());
+        }
+    }
+
+    m_sCombinedPattern.clear();
+}
+
+bool ConsoleFilterSet::Matches(const char* text, size_t len)
+{
+    // match data is only used for the result and the mark, a single ovector pair fits every pattern
+    thread_local std::unique_ptr<pcre2_match_data, decltype(&pcre2_match_data_free)> match_data(pcre2_match_data_create(1, nullptr), &pcre2_match_data_free);
+
+    PCRE2_SPTR str = (PCRE2_SPTR)text;
+
+    if (m_pCombinedFilter) {
+        int rc = m_bCombinedFilterJIT ? pcre2_jit_match(m_pCombinedFilter, str, len, 0, 0, match_data.get(), nullptr) : pcre2_match(m_pCombinedFilter, str, len, 0, 0, match_data.get(), nullptr);
+
+        if (rc >= 0) {
+            PCRE2_SPTR mark = pcre2_get_mark(match_data.get());
+            if (mark) {
+                size_t idx = strtoull((const char*)mark, nullptr, 10);
+                if (idx < m_vFilters.size()) m_vFilters[idx]->matches.fetch_add(1, std::memory_order_relaxed);
+            }
+            return true;
+        }
+    }
+
+    for (auto filter : m_vSeparateFilters) {
+        if (pcre2_match(filter->re, str, len, 0, 0, match_data.get(), nullptr) >= 0) {
+            filter->matches.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+
+    return false;
+}
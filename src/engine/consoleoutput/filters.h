@@ -0,0 +1,65 @@
+/************************************************************************************************
+ *  SwiftlyS2 is a scripting framework for Source2-based games.
+ *  Copyright (C) 2023-2026 Swiftly Solution SRL via Sava Andrei-Sebastian and it's contributors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ ************************************************************************************************/
+
+#ifndef src_engine_consoleoutput_filters_h
+#define src_engine_consoleoutput_filters_h
+
+#include <pcre2.h>
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+struct ConsoleFilter
+{
+    std::string key;
+    pcre2_code* re;
+    std::atomic<uint64_t> matches{ 0 };
+};
+
+// Every filter in one JIT compiled alternation, each branch tagged with (*MARK:<index>) so the
+// matching filter can still be counted. Filters that can't live inside the alternation (backreferences)
+// are matched one by one. Doesn't depend on the engine, benchmarks/natives links it as is.
+class ConsoleFilterSet
+{
+public:
+    ConsoleFilterSet() = default;
+    ConsoleFilterSet(const ConsoleFilterSet&) = delete;
+    ConsoleFilterSet& operator=(const ConsoleFilterSet&) = delete;
+    ~ConsoleFilterSet();
+
+    // false if the pattern doesn't compile, erroffset is where it failed
+    bool Add(const std::string& key, const std::string& pattern, size_t& erroffset);
+    // builds the alternation, called once after every filter was added
+    void Compile();
+
+    bool Matches(const char* text, size_t len);
+
+    const std::vector<std::unique_ptr<ConsoleFilter>>& GetFilters() const { return m_vFilters; }
+
+private:
+    std::vector<std::unique_ptr<ConsoleFilter>> m_vFilters;
+    std::vector<ConsoleFilter*> m_vSeparateFilters;
+    std::string m_sCombinedPattern;
+    pcre2_code* m_pCombinedFilter = nullptr;
+    bool m_bCombinedFilterJIT = false;
+};
+
+#endif
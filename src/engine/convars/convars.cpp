@@ -22,7 +22,12 @@
 #include <api/sdk/recipientfilter.h>
 #include <api/sdk/serversideclient.h>
 
+#include <api/shared/hash.h>
+
 #include <optional>
+#include <chrono>
+#include <deque>
+#include <unordered_map>
 
 #include <memory/gamedata/manager.h>
 
@@ -61,7 +66,48 @@
 
 std::map<std::string, void*> g_mCvars;
 uint64_t g_uQueryCallbacks = 0;
-std::map<uint64_t, std::function<void(int, std::string, std::string)>> g_mQueryCallbacks;
+std::map<uint64_t, ClientCvarQueryCallback> g_mQueryCallbacks;
+
+#define MAX_CLIENT_QUERY_SLOTS 64
+
+// answers younger than this are served from the cache instead of asking the client again
+constexpr auto CLIENT_CVAR_CACHE_TTL = std::chrono::seconds(1);
+// an in-flight query older than this is considered lost and gets sent again on the next request
+constexpr auto CLIENT_CVAR_QUERY_TIMEOUT = std::chrono::seconds(10);
+
+struct ClientCvarQuery
+{
+    std::string name;
+    std::vector<ClientCvarRequestCallback> requesters;
+    bool sent = false;
+    std::chrono::steady_clock::time_point sentAt;
+};
+
+struct ClientCvarCacheEntry
+{
+    std::string value;
+    std::chrono::steady_clock::time_point receivedAt;
+};
+
+// delivered on the next ProcessClientQueries: answers served from the cache and queries
+// for a slot nobody is connected on (no value). an empty callback means the global listeners
+struct ClientCvarAnswer
+{
+    std::string name;
+    std::optional<std::string> value;
+    ClientCvarRequestCallback callback;
+};
+
+struct ClientCvarQueries
+{
+    std::unordered_map<uint64_t, ClientCvarQuery> inflight;
+    std::unordered_map<uint64_t, ClientCvarCacheEntry> cache;
+    std::deque<uint64_t> pending;
+    std::vector<ClientCvarAnswer> answered;
+};
+
+ClientCvarQueries g_ClientCvarQueries[MAX_CLIENT_QUERY_SLOTS];
+INetworkMessageInternal* g_pGetCvarValueMessage = nullptr;
 
 std::map<uint64_t, std::function<void(const char*, int, const char*, const char*)>> g_mChangeCallbacks;
 uint64_t g_uChangeCallbackId = 0;
@@ -124,7 +170,7 @@ void CConvarManager::Initialize()
     static auto gamedata = g_ifaceService.FetchInterface<IGameDataManager>(GAMEDATA_INTERFACE_VERSION);
 
     g_pProcessRespondCvarValueHook = hooksmanager->CreateVFunctionHook();
-    g_pProcessRespondCvarValueHook->SetHookFunction(serverSideClientVTable, gamedata->GetOffsets()->Fetch("CServerSideClient::ProcessRespondCvarValue"), reinterpret_cast<void*>(OnConvarQuery), true);
+    g_pProcessRespondCvarValueHook->SetHookFunction(serverSideClientVTable, gamedata->GetOffsets()->Fetch(GameDataOffset::CServerSideClient_ProcessRespondCvarValue), reinterpret_cast<void*>(OnConvarQuery), true);
     g_pProcessRespondCvarValueHook->Enable();
 
     auto cvars = g_ifaceService.FetchInterface<ICvar>(CVAR_INTERFACE_VERSION);
@@ -145,21 +191,135 @@ void CConvarManager::Shutdown()
     auto cvars = g_ifaceService.FetchInterface<ICvar>(CVAR_INTERFACE_VERSION);
     cvars->RemoveGlobalChangeCallback(ChangedConvarCallback);
     cvars->RemoveCreationListeners(&g_CvarListener);
+
+    // plugins are already unloaded, outstanding requesters are dropped without being called
+    for (int i = 0; i < MAX_CLIENT_QUERY_SLOTS; i++)
+        g_ClientCvarQueries[i] = ClientCvarQueries();
+    g_pGetCvarValueMessage = nullptr;
+}
+
+void QueueClientCvarQuery(int playerid, const std::string& cvar_name, ClientCvarRequestCallback callback)
+{
+    static auto playermanager = g_ifaceService.FetchInterface<IPlayerManager>(PLAYERMANAGER_INTERFACE_VERSION);
+
+    if (playerid < 0 || playerid >= MAX_CLIENT_QUERY_SLOTS) return;
+
+    auto& queries = g_ClientCvarQueries[playerid];
+
+    // nobody would answer, and an empty slot never gets its queries cleared on disconnect
+    if (!playermanager->GetPlayer(playerid))
+    {
+        if (callback) queries.answered.push_back({ cvar_name, std::nullopt, std::move(callback) });
+        return;
+    }
+
+    auto hash = hash_64_fnv1a(cvar_name.data(), cvar_name.size());
+    auto now = std::chrono::steady_clock::now();
+
+    auto cached = queries.cache.find(hash);
+    if (cached != queries.cache.end() && now - cached->second.receivedAt < CLIENT_CVAR_CACHE_TTL)
+    {
+        // never answered inside the call, a callback that queries again would recurse
+        queries.answered.push_back({ cvar_name, cached->second.value, std::move(callback) });
+        return;
+    }
+
+    auto& query = queries.inflight[hash];
+    if (query.name.empty())
+    {
+        query.name = cvar_name;
+        queries.pending.push_back(hash);
+    }
+    else if (query.sent && now - query.sentAt > CLIENT_CVAR_QUERY_TIMEOUT)
+    {
+        query.sent = false;
+        queries.pending.push_back(hash);
+    }
+
+    if (callback) query.requesters.push_back(std::move(callback));
 }
 
 void CConvarManager::QueryClientConvar(int playerid, std::string cvar_name)
+{
+    QueueClientCvarQuery(playerid, cvar_name, nullptr);
+}
+
+void CConvarManager::QueryClientConvarWithCallback(int playerid, const std::string& cvar_name, ClientCvarRequestCallback callback)
+{
+    QueueClientCvarQuery(playerid, cvar_name, std::move(callback));
+}
+
+void CConvarManager::ProcessClientQueries()
 {
     static auto gameEventSystem = g_ifaceService.FetchInterface<IGameEventSystem>(GAMEEVENTSYSTEM_INTERFACE_VERSION);
 
-    auto netmsg = networkMessages->FindNetworkMessagePartial("GetCvarValue");
-    auto msg = netmsg->AllocateMessage()->ToPB<CSVCMsg_GetCvarValue>();
+    for (int playerid = 0; playerid < MAX_CLIENT_QUERY_SLOTS; playerid++)
+    {
+        auto& queries = g_ClientCvarQueries[playerid];
+        if (queries.answered.empty()) continue;
 
-    msg->set_cvar_name(cvar_name);
+        // detached, anything queued by the callbacks is delivered on the next tick
+        auto answered = std::move(queries.answered);
+        queries.answered.clear();
+
+        for (const auto& answer : answered)
+        {
+            if (answer.callback)
+            {
+                answer.callback(playerid, answer.name, answer.value ? &*answer.value : nullptr);
+            }
+            else if (answer.value)
+            {
+                for (const auto& [id, callback] : g_mQueryCallbacks)
+                    callback(playerid, answer.name, *answer.value);
+            }
+        }
+    }
+
+    // GetCvarValue carries a single cvar, so every player is sent at most one per tick
+    // and the players asking for the same cvar this tick share it through one filter
+    std::unordered_map<uint64_t, std::pair<const std::string*, CRecipientFilter>> batch;
+    auto now = std::chrono::steady_clock::now();
+
+    for (int playerid = 0; playerid < MAX_CLIENT_QUERY_SLOTS; playerid++)
+    {
+        auto& queries = g_ClientCvarQueries[playerid];
+
+        while (!queries.pending.empty())
+        {
+            uint64_t hash = queries.pending.front();
+            queries.pending.pop_front();
+
+            auto it = queries.inflight.find(hash);
+            if (it == queries.inflight.end() || it->second.sent) continue;
+
+            auto& entry = batch[hash];
+            if (!entry.first) entry.first = &it->second.name;
+            entry.second.AddRecipient(playerid);
+
+            it->second.sent = true;
+            it->second.sentAt = now;
+            break;
+        }
+    }
+
+    if (batch.empty()) return;
+
+    if (!g_pGetCvarValueMessage)
+    {
+        g_pGetCvarValueMessage = networkMessages->FindNetworkMessagePartial("GetCvarValue");
+        if (!g_pGetCvarValueMessage) return;
+    }
+
+    auto msg = g_pGetCvarValueMessage->AllocateMessage()->ToPB<CSVCMsg_GetCvarValue>();
 
     bypassPostEventAbstractHook = true;
 
-    CSingleRecipientFilter filter(playerid);
-    gameEventSystem->PostEventAbstract(-1, false, &filter, netmsg, msg, 0);
+    for (auto& [hash, entry] : batch)
+    {
+        msg->set_cvar_name(*entry.first);
+        gameEventSystem->PostEventAbstract(-1, false, &entry.second, g_pGetCvarValueMessage, msg, 0);
+    }
 
     bypassPostEventAbstractHook = false;
 
@@ -167,7 +327,28 @@ void CConvarManager::QueryClientConvar(int playerid, std::string cvar_name)
     delete msg;
 }
 
-int CConvarManager::AddQueryClientCvarCallback(std::function<void(int, std::string, std::string)> callback)
+void CConvarManager::ClearClientQueries(int playerid)
+{
+    if (playerid < 0 || playerid >= MAX_CLIENT_QUERY_SLOTS) return;
+
+    // detached first, the slot can be reused by whoever connects next
+    auto queries = std::move(g_ClientCvarQueries[playerid]);
+    g_ClientCvarQueries[playerid] = ClientCvarQueries();
+
+    // every requester hears back exactly once, a disconnect completes them without a value
+    for (const auto& answer : queries.answered)
+    {
+        if (answer.callback) answer.callback(playerid, answer.name, nullptr);
+    }
+
+    for (const auto& [hash, query] : queries.inflight)
+    {
+        for (const auto& callback : query.requesters)
+            callback(playerid, query.name, nullptr);
+    }
+}
+
+int CConvarManager::AddQueryClientCvarCallback(ClientCvarQueryCallback callback)
 {
     g_mQueryCallbacks[g_uQueryCallbacks++] = callback;
     return g_uQueryCallbacks - 1;
@@ -178,8 +359,29 @@ void CConvarManager::RemoveQueryClientCvarCallback(int callback_id)
     g_mQueryCallbacks.erase(callback_id);
 }
 
-void CConvarManager::OnClientQueryCvar(int playerid, std::string cvar_name, std::string cvar_value)
+void CConvarManager::OnClientQueryCvar(int playerid, const std::string& cvar_name, const std::string& cvar_value)
 {
+    if (playerid >= 0 && playerid < MAX_CLIENT_QUERY_SLOTS)
+    {
+        auto& queries = g_ClientCvarQueries[playerid];
+        auto hash = hash_64_fnv1a(cvar_name.data(), cvar_name.size());
+
+        auto& cached = queries.cache[hash];
+        cached.value = cvar_value;
+        cached.receivedAt = std::chrono::steady_clock::now();
+
+        auto it = queries.inflight.find(hash);
+        if (it != queries.inflight.end())
+        {
+            // detach first, requesters may issue a new query for the same cvar
+            auto requesters = std::move(it->second.requesters);
+            queries.inflight.erase(it);
+
+            for (const auto& callback : requesters)
+                callback(playerid, cvar_name, &cvar_value);
+        }
+    }
+
     for (const auto& [id, callback] : g_mQueryCallbacks)
     {
         callback(playerid, cvar_name, cvar_value);
@@ -30,9 +30,12 @@ public:
     virtual void Shutdown() override;
 
     virtual void QueryClientConvar(int playerid, std::string cvar_name) override;
-    virtual int AddQueryClientCvarCallback(std::function<void(int, std::string, std::string)> callback) override;
+    virtual void QueryClientConvarWithCallback(int playerid, const std::string& cvar_name, ClientCvarRequestCallback callback) override;
+    virtual int AddQueryClientCvarCallback(ClientCvarQueryCallback callback) override;
     virtual void RemoveQueryClientCvarCallback(int callback_id) override;
-    virtual void OnClientQueryCvar(int playerid, std::string cvar_name, std::string cvar_value) override;
+    virtual void OnClientQueryCvar(int playerid, const std::string& cvar_name, const std::string& cvar_value) override;
+    virtual void ProcessClientQueries() override;
+    virtual void ClearClientQueries(int playerid) override;
 
     virtual void CreateConvar(std::string cvar_name, EConVarType type, uint64_t flags, const char* help_message, ConvarValue defaultValue, std::optional<ConvarValue> minValue = std::nullopt, std::optional<ConvarValue> maxValue = std::nullopt) override;
     virtual void DeleteConvar(std::string cvar_name) override;
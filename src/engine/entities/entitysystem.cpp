@@ -68,18 +68,18 @@ void CEntSystem::Initialize()
     auto gamedata = g_ifaceService.FetchInterface<IGameDataManager>(GAMEDATA_INTERFACE_VERSION);
 
     g_pOnEntityTakeDamageHook = hooksmanager->CreateFunctionHook();
-    g_pOnEntityTakeDamageHook->SetHookFunction(gamedata->GetSignatures()->Fetch("CBaseEntity::TakeDamage"), reinterpret_cast<void*>(TakeDamageHook));
+    g_pOnEntityTakeDamageHook->SetHookFunction(gamedata->GetSignatures()->Fetch(GameDataSignature::CBaseEntity_TakeDamage), reinterpret_cast<void*>(TakeDamageHook));
     g_pOnEntityTakeDamageHook->Enable();
 
     g_pTraceShapeHook = hooksmanager->CreateFunctionHook();
-    g_pTraceShapeHook->SetHookFunction(gamedata->GetSignatures()->Fetch("TraceShape"), reinterpret_cast<void*>(TraceShapeHook));
+    g_pTraceShapeHook->SetHookFunction(gamedata->GetSignatures()->Fetch(GameDataSignature::TraceShape), reinterpret_cast<void*>(TraceShapeHook));
     g_pTraceShapeHook->Enable();
 
     void* netserverservice = nullptr;
     s2binlib_find_vtable("engine2", "CNetworkServerService", &netserverservice);
 
     g_pStartupServerHook = hooksmanager->CreateVFunctionHook();
-    g_pStartupServerHook->SetHookFunction(netserverservice, gamedata->GetOffsets()->Fetch("INetworkServerService::StartupServer"), reinterpret_cast<void*>(StartupServerHook), true);
+    g_pStartupServerHook->SetHookFunction(netserverservice, gamedata->GetOffsets()->Fetch(GameDataOffset::INetworkServerService_StartupServer), reinterpret_cast<void*>(StartupServerHook), true);
     g_pStartupServerHook->Enable();
 }
 
@@ -137,7 +137,7 @@ void StartupServerHook(void* _this, const GameSessionConfiguration_t& config, IS
 
     auto gamedata = g_ifaceService.FetchInterface<IGameDataManager>(GAMEDATA_INTERFACE_VERSION);
 
-    CGameEntitySystem* entSystem = *reinterpret_cast<CGameEntitySystem**>((uintptr_t)(pGameResService)+gamedata->GetOffsets()->Fetch("GameEntitySystem"));
+    CGameEntitySystem* entSystem = *reinterpret_cast<CGameEntitySystem**>((uintptr_t)(pGameResService)+gamedata->GetOffsets()->Fetch(GameDataOffset::GameEntitySystem));
     g_pGameEntitySystem = entSystem;
     g_pGameEntitySystem->AddListenerEntity(&g_entityListener);
 
@@ -147,7 +147,7 @@ void StartupServerHook(void* _this, const GameSessionConfiguration_t& config, IS
 void CEntSystem::Spawn(void* pEntity, void* pKeyValues)
 {
     static auto gamedata = g_ifaceService.FetchInterface<IGameDataManager>(GAMEDATA_INTERFACE_VERSION);
-    static auto sig = gamedata->GetSignatures()->Fetch("CBaseEntity::DispatchSpawn");
+    static auto sig = gamedata->GetSignatures()->Fetch(GameDataSignature::CBaseEntity_DispatchSpawn);
 
     reinterpret_cast<CBaseEntity_DispatchSpawn>(sig)(pEntity, pKeyValues);
 }
@@ -155,7 +155,7 @@ void CEntSystem::Spawn(void* pEntity, void* pKeyValues)
 void CEntSystem::Despawn(void* pEntity)
 {
     static auto gamedata = g_ifaceService.FetchInterface<IGameDataManager>(GAMEDATA_INTERFACE_VERSION);
-    static auto sig = gamedata->GetSignatures()->Fetch("UTIL::Remove");
+    static auto sig = gamedata->GetSignatures()->Fetch(GameDataSignature::UTIL_Remove);
 
     reinterpret_cast<UTIL_Remove>(sig)(pEntity);
 }
@@ -163,7 +163,7 @@ void CEntSystem::Despawn(void* pEntity)
 void* CEntSystem::CreateEntityByName(const char* name)
 {
     static auto gamedata = g_ifaceService.FetchInterface<IGameDataManager>(GAMEDATA_INTERFACE_VERSION);
-    static auto sig = gamedata->GetSignatures()->Fetch("UTIL::CreateEntityByName");
+    static auto sig = gamedata->GetSignatures()->Fetch(GameDataSignature::UTIL_CreateEntityByName);
 
     return reinterpret_cast<UTIL_CreateEntityByName>(sig)(name, -1);
 }
@@ -192,7 +192,7 @@ void CEntSystem::AcceptInput(void* pEntity, const char* input, void* activator,
     else
         var = 0;
 
-    static auto sig = gamedata->GetSignatures()->Fetch("CEntityInstance::AcceptInput");
+    static auto sig = gamedata->GetSignatures()->Fetch(GameDataSignature::CEntityInstance_AcceptInput);
     reinterpret_cast<CEntityInstance_AcceptInput>(sig)(pEntity, input, activator, caller, &var, outputID);
 }
 
@@ -220,7 +220,7 @@ void CEntSystem::AddEntityIOEvent(void* pEntity, const char* input, void* activa
     else
         var = 0;
 
-    static auto sig = gamedata->GetSignatures()->Fetch("CEntitySystem::AddEntityIOEvent");
+    static auto sig = gamedata->GetSignatures()->Fetch(GameDataSignature::CEntitySystem_AddEntityIOEvent);
     reinterpret_cast<CEntitySystem_AddEntityIOEvent>(sig)(g_pGameEntitySystem, pEntity, input, activator, caller, &var, delay, 0, nullptr, nullptr);
 }
 
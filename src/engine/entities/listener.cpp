@@ -46,7 +46,7 @@ void CEntityListener::OnEntityParentChanged(CEntityInstance* pEntity, CEntityIns
 void EntityAllowHammerID(CEntityInstance* pEntity)
 {
     auto gamedata = g_ifaceService.FetchInterface<IGameDataManager>(GAMEDATA_INTERFACE_VERSION);
-    Plat_WriteMemory((*(void***)pEntity)[gamedata->GetOffsets()->Fetch("GetHammerUniqueID")], (uint8_t*)"\xB0\x01", 2);
+    Plat_WriteMemory((*(void***)pEntity)[gamedata->GetOffsets()->Fetch(GameDataOffset::GetHammerUniqueID)], (uint8_t*)"\xB0\x01", 2);
 }
 
 bool bDone = false;
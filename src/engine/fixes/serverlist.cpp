@@ -42,7 +42,7 @@ void ServerListFix::Start()
 
     g_GameFrameHook = hooksmanager->CreateVFunctionHook();
 
-    g_GameFrameHook->SetHookFunction(servervtable, gamedata->GetOffsets()->Fetch("IServerGameDLL::GameFrame"), reinterpret_cast<void*>(GameFrame), true);
+    g_GameFrameHook->SetHookFunction(servervtable, gamedata->GetOffsets()->Fetch(GameDataOffset::IServerGameDLL_GameFrame), reinterpret_cast<void*>(GameFrame), true);
     g_GameFrameHook->Enable();
 }
 
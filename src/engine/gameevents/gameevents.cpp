@@ -27,6 +27,7 @@
 #include <api/shared/string.h>
 
 #include <memory/gamedata/manager.h>
+#include <memory/hooks/stats.h>
 #include <api/memory/virtual/call.h>
 #include <api/shared/plat.h>
 
@@ -44,8 +45,14 @@
 
 using json = nlohmann::json;
 
-std::map<uint64_t, std::function<int(std::string, IGameEvent*, bool&)>> g_mEventListeners;
-std::map<uint64_t, std::function<int(std::string, IGameEvent*, bool&)>> g_mPostEventListeners;
+struct GameEventListener
+{
+    std::function<int(std::string, IGameEvent*, bool&)> callback;
+    HookStatsRecord* stats = nullptr;
+};
+
+std::map<uint64_t, GameEventListener> g_mEventListeners;
+std::map<uint64_t, GameEventListener> g_mPostEventListeners;
 
 std::list<std::list<std::pair<int64_t, std::function<void()>>>::iterator> queueRemoveTimeouts;
 std::list<std::pair<int64_t, std::function<void()>>> timeoutsArray;
@@ -86,10 +93,10 @@ void CEventManager::Initialize(std::string game_name)
     s2binlib_find_vtable("engine2", "CNetworkServerService", &netserverservice);
 
     g_pStartupServerEventHook = hooksmanager->CreateVFunctionHook();
-    g_pStartupServerEventHook->SetHookFunction(netserverservice, gamedata->GetOffsets()->Fetch("INetworkServerService::StartupServer"), reinterpret_cast<void*>(StartupServerEventHook), true);
+    g_pStartupServerEventHook->SetHookFunction(netserverservice, gamedata->GetOffsets()->Fetch(GameDataOffset::INetworkServerService_StartupServer), reinterpret_cast<void*>(StartupServerEventHook), true);
     g_pStartupServerEventHook->Enable();
 
-    uintptr_t rawGameEventManager = (uintptr_t)(gamedata->GetSignatures()->Fetch("CSource2Server::g_GameEventManager"));
+    uintptr_t rawGameEventManager = (uintptr_t)(gamedata->GetSignatures()->Fetch(GameDataSignature::CSource2Server_g_GameEventManager));
 
     rawGameEventManager += WIN_LINUX(95, 103) + 3;
     rawGameEventManager += 4 + *(int*)(rawGameEventManager);
@@ -97,20 +104,20 @@ void CEventManager::Initialize(std::string game_name)
     g_gameEventManager = *(IGameEventManager2**)(rawGameEventManager);
 
     g_pFireEventHook = hooksmanager->CreateVFunctionHook();
-    g_pFireEventHook->SetHookFunction(g_gameEventManager, gamedata->GetOffsets()->Fetch("IGameEventManager2::FireEvent"), reinterpret_cast<void*>(FireEventHook), false);
+    g_pFireEventHook->SetHookFunction(g_gameEventManager, gamedata->GetOffsets()->Fetch(GameDataOffset::IGameEventManager2_FireEvent), reinterpret_cast<void*>(FireEventHook), false);
     g_pFireEventHook->Enable();
 
     void* servervtable = nullptr;
     s2binlib_find_vtable("server", "CSource2Server", &servervtable);
 
     void* gameFrameAddr;
-    s2binlib_find_vfunc_by_vtbname("server", "CSource2Server", gamedata->GetOffsets()->Fetch("IServerGameDLL::GameFrame"), &gameFrameAddr);
+    s2binlib_find_vfunc_by_vtbname("server", "CSource2Server", gamedata->GetOffsets()->Fetch(GameDataOffset::IServerGameDLL_GameFrame), &gameFrameAddr);
     g_GameFrameHookEventManager = hooksmanager->CreateFunctionHook();
     g_GameFrameHookEventManager->SetHookFunction(gameFrameAddr, reinterpret_cast<void*>(GameFrameEventManager));
     g_GameFrameHookEventManager->Enable();
 
     g_PreworldUpdateHook = hooksmanager->CreateVFunctionHook();
-    g_PreworldUpdateHook->SetHookFunction(servervtable, gamedata->GetOffsets()->Fetch("IServerGameDLL::PreWorldUpdate"), reinterpret_cast<void*>(PreworldUpdateHook), true);
+    g_PreworldUpdateHook->SetHookFunction(servervtable, gamedata->GetOffsets()->Fetch(GameDataOffset::IServerGameDLL_PreWorldUpdate), reinterpret_cast<void*>(PreworldUpdateHook), true);
     g_PreworldUpdateHook->Enable();
 
     RegisterGameEventListener("round_start");
@@ -209,8 +216,9 @@ bool FireEventHook(IGameEventManager2* _this, IGameEvent* event, bool bDontBroad
 
     std::string event_name = event->GetName();
     bool shouldBroadcast = bDontBroadcast;
-    for (const auto& [id, callback] : g_mEventListeners) {
-        auto res = callback(event_name, event, shouldBroadcast);
+    for (auto& [id, listener] : g_mEventListeners) {
+        HookStatsScope stats(listener.stats, "gameevent", [&]() { return fmt::format("pre #{}", id); });
+        auto res = listener.callback(event_name, event, shouldBroadcast);
         if (res == 1) {
             g_gameEventManager->FreeEvent(event);
             return false;
@@ -222,8 +230,9 @@ bool FireEventHook(IGameEventManager2* _this, IGameEvent* event, bool bDontBroad
 
     bool result = reinterpret_cast<decltype(&FireEventHook)>(g_pFireEventHook->GetOriginal())(_this, event, shouldBroadcast);
 
-    for (const auto& [id, callback] : g_mPostEventListeners) {
-        auto res = callback(event_name, dupEvent, shouldBroadcast);
+    for (auto& [id, listener] : g_mPostEventListeners) {
+        HookStatsScope stats(listener.stats, "gameevent", [&]() { return fmt::format("post #{}", id); });
+        auto res = listener.callback(event_name, dupEvent, shouldBroadcast);
         if (res == 1) {
             g_gameEventManager->FreeEvent(dupEvent);
             return false;
@@ -280,7 +289,7 @@ uint64_t CEventManager::AddGameEventFireListener(std::function<int(std::string,
 {
     QueueLockGuard lock(m_mtxLock);
     static uint64_t s_uiListenerID = 0;
-    g_mEventListeners[++s_uiListenerID] = callback;
+    g_mEventListeners[++s_uiListenerID] = { callback };
     return s_uiListenerID;
 }
 
@@ -288,7 +297,7 @@ uint64_t CEventManager::AddPostGameEventFireListener(std::function<int(std::stri
 {
     QueueLockGuard lock(m_mtxLock);
     static uint64_t s_uiListenerID = 0;
-    g_mPostEventListeners[++s_uiListenerID] = callback;
+    g_mPostEventListeners[++s_uiListenerID] = { callback };
     return s_uiListenerID;
 }
 
@@ -298,6 +307,7 @@ void CEventManager::RemoveGameEventFireListener(uint64_t listener_id)
     auto it = g_mEventListeners.find(listener_id);
     if (it != g_mEventListeners.end())
     {
+        g_HookStats.Release(it->second.stats);
         g_mEventListeners.erase(it);
     }
 }
@@ -308,6 +318,7 @@ void CEventManager::RemovePostGameEventFireListener(uint64_t listener_id)
     auto it = g_mPostEventListeners.find(listener_id);
     if (it != g_mPostEventListeners.end())
     {
+        g_HookStats.Release(it->second.stats);
         g_mPostEventListeners.erase(it);
     }
 }
@@ -44,10 +44,10 @@ bool InitGameSystem()
     s2binlib_find_vtable("server", "CGameRulesGameSystem", &gameRulesGameSystemVTable);
 
     pOnPrecacheResourceCallbackHook = hooksmanager->CreateVFunctionHook();
-    pOnPrecacheResourceCallbackHook->SetHookFunction(gameRulesGameSystemVTable, gamedata->GetOffsets()->Fetch("IGameSystem::BuildGameSessionManifest"), (void*)BuildGameSessionManifestHook, true);
+    pOnPrecacheResourceCallbackHook->SetHookFunction(gameRulesGameSystemVTable, gamedata->GetOffsets()->Fetch(GameDataOffset::IGameSystem_BuildGameSessionManifest), (void*)BuildGameSessionManifestHook, true);
     pOnPrecacheResourceCallbackHook->Enable();
 
-    void* ptr = gamedata->GetSignatures()->Fetch("IGameSystem::InitAllSystems->pFirst");
+    void* ptr = gamedata->GetSignatures()->Fetch(GameDataSignature::IGameSystem_InitAllSystems_pFirst);
     if (!ptr) {
         logger->Error("Game System", "Couldn't find signature for 'IGameSystem::InitAllSystems->pFirst'!\n");
         return false;
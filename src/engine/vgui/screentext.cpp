@@ -183,7 +183,7 @@ void CScreenText::UpdatePosition()
 
     Vector vel(velocityX.m_Value, velocityY.m_Value, velocityZ.m_Value);
 
-    static int iTeleportOffset = gamedata->GetOffsets()->Fetch("CBaseEntity::Teleport");
+    static int iTeleportOffset = gamedata->GetOffsets()->Fetch(GameDataOffset::CBaseEntity_Teleport);
     CALL_VIRTUAL(void, iTeleportOffset, pScreenEntity.Get(), &eyePos, &ang, &vel);
 }
 
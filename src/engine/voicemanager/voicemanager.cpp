@@ -37,14 +37,14 @@ void CVoiceManager::Initialize()
     auto gamedata = g_ifaceService.FetchInterface<IGameDataManager>(GAMEDATA_INTERFACE_VERSION);
 
     g_pSetClientListeningHook = hooksmanager->CreateVFunctionHook();
-    g_pSetClientListeningHook->SetHookFunction(INTERFACEVERSION_VENGINESERVER, gamedata->GetOffsets()->Fetch("IVEngineServer2::SetClientListening"), (void*)SetClientListeningHook);
+    g_pSetClientListeningHook->SetHookFunction(INTERFACEVERSION_VENGINESERVER, gamedata->GetOffsets()->Fetch(GameDataOffset::IVEngineServer2_SetClientListening), (void*)SetClientListeningHook);
     g_pSetClientListeningHook->Enable();
 
     void* gameclientsvtable = nullptr;
     s2binlib_find_vtable("server", "CSource2GameClients", &gameclientsvtable);
 
     g_pClientCommandHook = hooksmanager->CreateVFunctionHook();
-    g_pClientCommandHook->SetHookFunction(gameclientsvtable, gamedata->GetOffsets()->Fetch("IServerGameClients::ClientCommand"), (void*)ClientCommandHook, true);
+    g_pClientCommandHook->SetHookFunction(gameclientsvtable, gamedata->GetOffsets()->Fetch(GameDataOffset::IServerGameClients_ClientCommand), (void*)ClientCommandHook, true);
     g_pClientCommandHook->Enable();
 }
 
@@ -17,127 +17,282 @@
  ************************************************************************************************/
 
 #include "allocator.h"
+#include <algorithm>
+#include <bit>
 #include <cstring>
+#include <map>
+
+#include <api/shared/texttable.h>
+#include <fmt/format.h>
 
 #include "tier0/memdbgon.h"
 
-void* MemoryAllocator::Alloc(uint64_t size)
+// Small blocks are recycled through a per thread cache, so the hot alloc/free path
+// never takes a lock for the memory itself, only the pointer's index shard.
+struct AllocatorThreadCache
 {
-    QueueLockGuard lock(m_mtxLock);
-    void* ptr = malloc(size);
-    if (ptr)
+    void* blocks[ALLOCATOR_SIZE_CLASSES][ALLOCATOR_CACHE_BLOCKS];
+    uint32_t count[ALLOCATOR_SIZE_CLASSES] = {};
+    bool destroyed = false;
+
+    ~AllocatorThreadCache()
     {
-        allocations[ptr] = size;
-        totalAllocated += size;
+        for (int i = 0; i < ALLOCATOR_SIZE_CLASSES; i++)
+        {
+            for (uint32_t j = 0; j < count[i]; j++)
+                free(blocks[i][j]);
+            count[i] = 0;
+        }
+        destroyed = true;
     }
-    return ptr;
+};
+
+static thread_local AllocatorThreadCache g_AllocatorCache;
+static thread_local uint32_t g_uSampleCountdown = 0;
+static thread_local uint32_t g_uSampleSeed = 0x9E3779B9;
+
+static uint64_t GetSizeClassSize(int32_t sizeClass)
+{
+    return 16ull << sizeClass;
 }
 
-void* MemoryAllocator::TrackedAlloc(uint64_t size, std::string identifier, std::string details)
+static int32_t GetSizeClass(uint64_t size)
+{
+    if (size > GetSizeClassSize(ALLOCATOR_SIZE_CLASSES - 1)) return -1;
+
+    int32_t sizeClass = 0;
+    while (GetSizeClassSize(sizeClass) < size)
+        sizeClass++;
+    return sizeClass;
+}
+
+static void* AllocateBlock(uint64_t size, int32_t sizeClass)
+{
+    if (sizeClass < 0) return malloc(size);
+
+    auto& cache = g_AllocatorCache;
+    if (!cache.destroyed && cache.count[sizeClass] > 0)
+        return cache.blocks[sizeClass][--cache.count[sizeClass]];
+
+    return malloc(GetSizeClassSize(sizeClass));
+}
+
+static void ReleaseBlock(void* ptr, int32_t sizeClass)
+{
+    if (sizeClass >= 0)
+    {
+        auto& cache = g_AllocatorCache;
+        if (!cache.destroyed && cache.count[sizeClass] < ALLOCATOR_CACHE_BLOCKS)
+        {
+            cache.blocks[sizeClass][cache.count[sizeClass]++] = ptr;
+            return;
+        }
+    }
+
+    free(ptr);
+}
+
+AllocationShard& MemoryAllocator::GetShard(void* ptr)
+{
+    uint64_t key = reinterpret_cast<uintptr_t>(ptr) >> 4;
+    return m_Shards[((key * 0x9E3779B97F4A7C15ull) >> 32) % ALLOCATOR_SHARDS];
+}
+
+TrackedIdentifier* MemoryAllocator::GetTrackedIdentifier(const std::string& identifier, bool create)
 {
-    QueueLockGuard lock(m_mtxLock);
-    void* ptr = Alloc(size);
-    if (ptr)
     {
-        trackedAllocations[identifier].push_back({ details, ptr });
+        std::shared_lock lock(m_IdentifiersMutex);
+        auto it = m_Identifiers.find(identifier);
+        if (it != m_Identifiers.end()) return it->second.get();
+    }
+
+    if (!create) return nullptr;
+
+    std::unique_lock lock(m_IdentifiersMutex);
+    auto& tracked = m_Identifiers[identifier];
+    if (!tracked) tracked = std::make_unique<TrackedIdentifier>();
+    return tracked.get();
+}
+
+void* MemoryAllocator::Allocate(uint64_t size, TrackedIdentifier* tracked, std::string details)
+{
+    int32_t sizeClass = GetSizeClass(size);
+    void* ptr = AllocateBlock(size, sizeClass);
+    if (!ptr) return nullptr;
+
+    AllocationInfo info;
+    info.size = size;
+    info.serial = m_uSerial.fetch_add(1, std::memory_order_relaxed);
+    info.sizeClass = sizeClass;
+    info.tracked = tracked;
+    info.details = std::move(details);
+
+    if (m_bProfiling.load(std::memory_order_relaxed)) SampleAllocation(info);
+
+    AllocationShard& shard = GetShard(ptr);
+    {
+        std::lock_guard lock(shard.mutex);
+        shard.allocations.insert_or_assign(ptr, std::move(info));
     }
+
+    m_uTotalAllocated.fetch_add(size, std::memory_order_relaxed);
+    if (tracked) tracked->allocated.fetch_add(size, std::memory_order_relaxed);
+
     return ptr;
 }
 
+void* MemoryAllocator::Alloc(uint64_t size)
+{
+    return Allocate(size, nullptr, {});
+}
+
+void* MemoryAllocator::TrackedAlloc(uint64_t size, std::string identifier, std::string details)
+{
+    return Allocate(size, GetTrackedIdentifier(identifier, true), std::move(details));
+}
+
 void MemoryAllocator::Free(void* ptr)
 {
-    QueueLockGuard lock(m_mtxLock);
-    auto it = allocations.find(ptr);
-    if (it != allocations.end())
+    AllocationShard& shard = GetShard(ptr);
+    AllocationInfo info;
     {
-        totalAllocated -= it->second;
-        allocations.erase(it);
+        std::lock_guard lock(shard.mutex);
+        auto it = shard.allocations.find(ptr);
+        if (it == shard.allocations.end()) return;
 
-        for (auto& [id, vec] : trackedAllocations)
-        {
-            vec.erase(std::remove_if(vec.begin(), vec.end(),
-                [ptr](const std::pair<std::string, void*>& p) { return p.second == ptr; }),
-                vec.end());
-        }
-
-        free(ptr);
+        info = std::move(it->second);
+        shard.allocations.erase(it);
     }
+
+    m_uTotalAllocated.fetch_sub(info.size, std::memory_order_relaxed);
+    if (info.tracked) info.tracked->allocated.fetch_sub(info.size, std::memory_order_relaxed);
+    if (info.sampleWeight) (info.tracked ? info.tracked : &m_UntrackedIdentifier)->sampledLiveBytes.fetch_sub(info.size * info.sampleWeight, std::memory_order_relaxed);
+
+    ReleaseBlock(ptr, info.sizeClass);
 }
 
 void* MemoryAllocator::Resize(void* ptr, uint64_t newSize)
 {
-    QueueLockGuard lock(m_mtxLock);
-    auto it = allocations.find(ptr);
-    if (it != allocations.end())
+    AllocationShard& shard = GetShard(ptr);
+    AllocationInfo info;
+    {
+        std::lock_guard lock(shard.mutex);
+        auto it = shard.allocations.find(ptr);
+        if (it == shard.allocations.end()) return nullptr;
+
+        // still fits in its block, nothing moves
+        if (it->second.sizeClass >= 0 && newSize <= GetSizeClassSize(it->second.sizeClass))
+        {
+            uint64_t oldSize = it->second.size;
+            it->second.size = newSize;
+
+            m_uTotalAllocated.fetch_add(newSize - oldSize, std::memory_order_relaxed);
+            if (it->second.tracked) it->second.tracked->allocated.fetch_add(newSize - oldSize, std::memory_order_relaxed);
+            if (it->second.sampleWeight) (it->second.tracked ? it->second.tracked : &m_UntrackedIdentifier)->sampledLiveBytes.fetch_add((newSize - oldSize) * it->second.sampleWeight, std::memory_order_relaxed);
+            return ptr;
+        }
+
+        info = std::move(it->second);
+        shard.allocations.erase(it);
+    }
+
+    uint64_t oldSize = info.size;
+    int32_t newSizeClass = GetSizeClass(newSize);
+    void* newPtr = nullptr;
+
+    if (info.sizeClass < 0 && newSizeClass < 0)
+    {
+        newPtr = realloc(ptr, newSize);
+    }
+    else
     {
-        uint64_t oldSize = it->second;
-        void* newPtr = realloc(ptr, newSize);
+        newPtr = AllocateBlock(newSize, newSizeClass);
         if (newPtr)
         {
-            allocations.erase(it);
-            allocations[newPtr] = newSize;
-            totalAllocated = totalAllocated - oldSize + newSize;
-
-            for (auto& [id, vec] : trackedAllocations)
-            {
-                for (auto& [details, p] : vec)
-                {
-                    if (p == ptr)
-                    {
-                        p = newPtr;
-                        break;
-                    }
-                }
-            }
-
-            return newPtr;
+            memcpy(newPtr, ptr, std::min(oldSize, newSize));
+            ReleaseBlock(ptr, info.sizeClass);
         }
     }
-    return nullptr;
+
+    if (!newPtr)
+    {
+        std::lock_guard lock(shard.mutex);
+        shard.allocations.insert_or_assign(ptr, std::move(info));
+        return nullptr;
+    }
+
+    m_uTotalAllocated.fetch_add(newSize - oldSize, std::memory_order_relaxed);
+    if (info.tracked) info.tracked->allocated.fetch_add(newSize - oldSize, std::memory_order_relaxed);
+    if (info.sampleWeight) (info.tracked ? info.tracked : &m_UntrackedIdentifier)->sampledLiveBytes.fetch_add((newSize - oldSize) * info.sampleWeight, std::memory_order_relaxed);
+
+    info.size = newSize;
+    info.sizeClass = newSizeClass;
+
+    AllocationShard& newShard = GetShard(newPtr);
+    {
+        std::lock_guard lock(newShard.mutex);
+        newShard.allocations.insert_or_assign(newPtr, std::move(info));
+    }
+
+    return newPtr;
 }
 
 uint64_t MemoryAllocator::GetSize(void* ptr)
 {
-    auto it = allocations.find(ptr);
-    if (it != allocations.end())
+    AllocationShard& shard = GetShard(ptr);
+    std::lock_guard lock(shard.mutex);
+
+    auto it = shard.allocations.find(ptr);
+    if (it != shard.allocations.end())
     {
-        return it->second;
+        return it->second.size;
     }
     return 0;
 }
 
 uint64_t MemoryAllocator::GetTotalAllocated()
 {
-    return totalAllocated;
+    return m_uTotalAllocated.load(std::memory_order_relaxed);
 }
 
 uint64_t MemoryAllocator::GetAllocatedByTrackedIdentifier(std::string identifier)
 {
-    uint64_t total = 0;
-    auto it = trackedAllocations.find(identifier);
-    if (it != trackedAllocations.end())
-    {
-        for (const auto& [details, ptr] : it->second)
-        {
-            total += GetSize(ptr);
-        }
-    }
-    return total;
+    TrackedIdentifier* tracked = GetTrackedIdentifier(identifier, false);
+    return tracked ? tracked->allocated.load(std::memory_order_relaxed) : 0;
 }
 
 std::vector<std::pair<std::string, void*>> MemoryAllocator::GetTrackedAllocations(std::string identifier)
 {
-    auto it = trackedAllocations.find(identifier);
-    if (it != trackedAllocations.end())
+    TrackedIdentifier* tracked = GetTrackedIdentifier(identifier, false);
+    if (!tracked) return {};
+
+    std::vector<std::pair<uint64_t, std::pair<std::string, void*>>> found;
+    for (auto& shard : m_Shards)
     {
-        return it->second;
+        std::lock_guard lock(shard.mutex);
+        for (const auto& [ptr, info] : shard.allocations)
+        {
+            if (info.tracked == tracked)
+                found.push_back({ info.serial, { info.details, ptr } });
+        }
     }
-    return {};
+
+    // in allocation order, like before the index was sharded
+    std::sort(found.begin(), found.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+
+    std::vector<std::pair<std::string, void*>> result;
+    result.reserve(found.size());
+    for (auto& [serial, entry] : found)
+        result.push_back(std::move(entry));
+
+    return result;
 }
 
 bool MemoryAllocator::IsPointerValid(void* ptr)
 {
-    return allocations.contains(ptr);
+    AllocationShard& shard = GetShard(ptr);
+    std::lock_guard lock(shard.mutex);
+    return shard.allocations.contains(ptr);
 }
 
 void MemoryAllocator::Copy(void* dest, void* src, uint64_t size)
@@ -152,17 +307,198 @@ void MemoryAllocator::Move(void* dest, void* src, uint64_t size)
 
 std::map<void*, uint64_t> MemoryAllocator::GetAllocations()
 {
-    return allocations;
+    std::map<void*, uint64_t> result;
+    for (auto& shard : m_Shards)
+    {
+        std::lock_guard lock(shard.mutex);
+        for (const auto& [ptr, info] : shard.allocations)
+            result[ptr] = info.size;
+    }
+    return result;
+}
+
+void* MemoryAllocator::FrameAlloc(uint64_t size)
+{
+    return m_FrameArena.Alloc(size);
+}
+
+void MemoryAllocator::ResetFrameArena()
+{
+    m_FrameArena.Reset(true);
+}
+
+void* MemoryAllocator::ArenaAlloc(std::string owner, uint64_t size)
+{
+    {
+        std::shared_lock lock(m_ArenasMutex);
+        auto it = m_Arenas.find(owner);
+        if (it != m_Arenas.end()) return it->second->Alloc(size);
+    }
+
+    std::unique_lock lock(m_ArenasMutex);
+    auto& arena = m_Arenas[owner];
+    if (!arena) arena = std::make_unique<MemoryArena>();
+    return arena->Alloc(size);
+}
+
+void MemoryAllocator::FreeArena(std::string owner)
+{
+    std::unique_ptr<MemoryArena> arena;
+    {
+        std::unique_lock lock(m_ArenasMutex);
+        auto it = m_Arenas.find(owner);
+        if (it == m_Arenas.end()) return;
+
+        arena = std::move(it->second);
+        m_Arenas.erase(it);
+    }
+}
+
+uint64_t MemoryAllocator::GetArenaAllocated(std::string owner)
+{
+    std::shared_lock lock(m_ArenasMutex);
+    auto it = m_Arenas.find(owner);
+    return it != m_Arenas.end() ? it->second->GetAllocated() : 0;
+}
+
+static uint32_t GetHistogramBucket(uint64_t size)
+{
+    if (size <= 16) return 0;
+
+    uint32_t bucket = std::bit_width(size - 1) - 4;
+    return bucket < ALLOCATOR_HISTOGRAM_BUCKETS ? bucket : ALLOCATOR_HISTOGRAM_BUCKETS - 1;
+}
+
+static std::string FormatBytes(uint64_t bytes)
+{
+    if (bytes >= 1024ull * 1024 * 1024) return fmt::format("{:.2f} GiB", bytes / (1024.0 * 1024 * 1024));
+    if (bytes >= 1024ull * 1024) return fmt::format("{:.2f} MiB", bytes / (1024.0 * 1024));
+    if (bytes >= 1024) return fmt::format("{:.2f} KiB", bytes / 1024.0);
+    return fmt::format("{} B", bytes);
+}
+
+void MemoryAllocator::SampleAllocation(AllocationInfo& info)
+{
+    if (g_uSampleCountdown > 1)
+    {
+        g_uSampleCountdown--;
+        return;
+    }
+
+    uint32_t rate = m_uSampleRate.load(std::memory_order_relaxed);
+
+    // random gaps averaging the rate, a fixed stride would alias with periodic allocation patterns
+    g_uSampleSeed ^= g_uSampleSeed << 13;
+    g_uSampleSeed ^= g_uSampleSeed >> 17;
+    g_uSampleSeed ^= g_uSampleSeed << 5;
+    g_uSampleCountdown = rate > 1 ? 1 + g_uSampleSeed % (2 * rate - 1) : 1;
+
+    // the weight stays with the allocation, so changing the rate later doesn't skew what's still live
+    info.sampleWeight = rate;
+
+    TrackedIdentifier* owner = info.tracked ? info.tracked : &m_UntrackedIdentifier;
+    owner->sampledAllocations.fetch_add(1, std::memory_order_relaxed);
+    owner->sampledLiveBytes.fetch_add(info.size * rate, std::memory_order_relaxed);
+
+    m_uSizeHistogram[GetHistogramBucket(info.size)].fetch_add(1, std::memory_order_relaxed);
+}
+
+void MemoryAllocator::StartProfiling(uint32_t sample_rate)
+{
+    for (auto& bucket : m_uSizeHistogram)
+        bucket.store(0, std::memory_order_relaxed);
+
+    {
+        std::shared_lock lock(m_IdentifiersMutex);
+        for (auto& [name, tracked] : m_Identifiers)
+            tracked->sampledAllocations.store(0, std::memory_order_relaxed);
+    }
+    m_UntrackedIdentifier.sampledAllocations.store(0, std::memory_order_relaxed);
+
+    m_uSampleRate.store(sample_rate == 0 ? 1 : sample_rate);
+    m_bProfiling.store(true);
+}
+
+void MemoryAllocator::StopProfiling()
+{
+    m_bProfiling.store(false);
+}
+
+bool MemoryAllocator::IsProfiling()
+{
+    return m_bProfiling.load();
+}
+
+std::string MemoryAllocator::GetProfilingReport()
+{
+    uint32_t rate = m_uSampleRate.load();
+    std::string report = fmt::format("Allocation profiler is {}, sampling 1 in {} allocations.\n", m_bProfiling.load() ? "enabled" : "disabled", rate);
+    report += fmt::format("Total allocated: {}\n", FormatBytes(GetTotalAllocated()));
+
+    TextTable histogramTable('-', '|', '+');
+    histogramTable.add(" Size ");
+    histogramTable.add(" Sampled Allocations ");
+    histogramTable.endOfRow();
+
+    for (uint32_t i = 0; i < ALLOCATOR_HISTOGRAM_BUCKETS; i++)
+    {
+        uint64_t count = m_uSizeHistogram[i].load(std::memory_order_relaxed);
+        if (count == 0) continue;
+
+        histogramTable.add(fmt::format(" <= {} ", FormatBytes(16ull << i)));
+        histogramTable.add(fmt::format(" {} ", count));
+        histogramTable.endOfRow();
+    }
+
+    TextTable ownersTable('-', '|', '+');
+    ownersTable.add(" Owner ");
+    ownersTable.add(" Sampled Allocations ");
+    ownersTable.add(" Estimated Live ");
+    ownersTable.add(" Tracked Live ");
+    ownersTable.add(" Arena ");
+    ownersTable.endOfRow();
+
+    // plugins own both a tracked identifier (Memory.Alloc) and an arena under their name
+    std::map<std::string, std::pair<TrackedIdentifier*, uint64_t>> owners;
+    {
+        std::shared_lock lock(m_IdentifiersMutex);
+        for (auto& [name, tracked] : m_Identifiers)
+            owners[name].first = tracked.get();
+    }
+    {
+        std::shared_lock lock(m_ArenasMutex);
+        for (auto& [name, arena] : m_Arenas)
+            owners[name].second = arena->GetAllocated();
+    }
+
+    auto addOwner = [&](const std::string& name, TrackedIdentifier* tracked, bool exact, uint64_t arena) {
+        ownersTable.add(fmt::format(" {} ", name));
+        ownersTable.add(tracked ? fmt::format(" {} ", tracked->sampledAllocations.load(std::memory_order_relaxed)) : " - ");
+        ownersTable.add(tracked ? fmt::format(" {} ", FormatBytes(tracked->sampledLiveBytes.load(std::memory_order_relaxed))) : " - ");
+        ownersTable.add(tracked && exact ? fmt::format(" {} ", FormatBytes(tracked->allocated.load(std::memory_order_relaxed))) : " - ");
+        ownersTable.add(arena ? fmt::format(" {} ", FormatBytes(arena)) : " - ");
+        ownersTable.endOfRow();
+        };
+
+    for (auto& [name, owner] : owners)
+        addOwner(name, owner.first, true, owner.second);
+    addOwner("(untracked)", &m_UntrackedIdentifier, false, 0);
+
+    report += "Size histogram:\n" + TableToString(histogramTable);
+    report += "Owners:\n" + TableToString(ownersTable);
+    return report;
 }
 
 MemoryAllocator::~MemoryAllocator()
 {
-    QueueLockGuard lock(m_mtxLock);
-    for (const auto& [ptr, size] : allocations)
+    for (auto& shard : m_Shards)
     {
-        free(ptr);
+        std::lock_guard lock(shard.mutex);
+        for (const auto& [ptr, info] : shard.allocations)
+        {
+            free(ptr);
+        }
+        shard.allocations.clear();
     }
-    allocations.clear();
-    trackedAllocations.clear();
-    totalAllocated = 0;
-}
\ No newline at end of file
+    m_uTotalAllocated = 0;
+}
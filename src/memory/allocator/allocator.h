@@ -21,7 +21,43 @@
 
 #include <api/memory/allocator/allocator.h>
 
-#include <api/utils/mutex.h>
+#include "arena.h"
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
+#define ALLOCATOR_SHARDS 64
+#define ALLOCATOR_SIZE_CLASSES 9 // 16, 32, ..., 4096 bytes
+#define ALLOCATOR_CACHE_BLOCKS 64 // per thread and size class
+#define ALLOCATOR_HISTOGRAM_BUCKETS 32 // <= 16 bytes, <= 32 bytes, ...
+
+struct TrackedIdentifier
+{
+    std::atomic<uint64_t> allocated{ 0 };
+
+    // profiler estimates, every sample counts for sample rate allocations
+    std::atomic<uint64_t> sampledAllocations{ 0 };
+    std::atomic<uint64_t> sampledLiveBytes{ 0 };
+};
+
+struct AllocationInfo
+{
+    uint64_t size = 0;
+    uint64_t serial = 0;
+    int32_t sizeClass = -1; // -1 = straight from malloc
+    uint32_t sampleWeight = 0; // 0 = not sampled by the profiler
+    TrackedIdentifier* tracked = nullptr;
+    std::string details;
+};
+
+struct alignas(64) AllocationShard
+{
+    std::mutex mutex;
+    std::unordered_map<void*, AllocationInfo> allocations;
+};
 
 class MemoryAllocator : public IMemoryAllocator
 {
@@ -46,15 +82,43 @@ public:
 
     virtual std::map<void*, uint64_t> GetAllocations() override;
 
+    virtual void* FrameAlloc(uint64_t size) override;
+    virtual void ResetFrameArena() override;
+
+    virtual void* ArenaAlloc(std::string owner, uint64_t size) override;
+    virtual void FreeArena(std::string owner) override;
+    virtual uint64_t GetArenaAllocated(std::string owner) override;
+
+    virtual void StartProfiling(uint32_t sample_rate) override;
+    virtual void StopProfiling() override;
+    virtual bool IsProfiling() override;
+    virtual std::string GetProfilingReport() override;
+
     ~MemoryAllocator();
 private:
-    std::map<void*, uint64_t> allocations;
-    std::map<std::string, std::vector<std::pair<std::string, void*>>> trackedAllocations;
-    uint64_t totalAllocated = 0;
+    void* Allocate(uint64_t size, TrackedIdentifier* tracked, std::string details);
+    AllocationShard& GetShard(void* ptr);
+
+    TrackedIdentifier* GetTrackedIdentifier(const std::string& identifier, bool create);
+    void SampleAllocation(AllocationInfo& info);
+
+    AllocationShard m_Shards[ALLOCATOR_SHARDS];
+    std::atomic<uint64_t> m_uTotalAllocated{ 0 };
+    std::atomic<uint64_t> m_uSerial{ 0 };
+
+    // entries are never removed, allocations keep a pointer to their identifier
+    std::shared_mutex m_IdentifiersMutex;
+    std::unordered_map<std::string, std::unique_ptr<TrackedIdentifier>> m_Identifiers;
+
+    std::atomic<bool> m_bProfiling{ false };
+    std::atomic<uint32_t> m_uSampleRate{ 1 };
+    std::atomic<uint64_t> m_uSizeHistogram[ALLOCATOR_HISTOGRAM_BUCKETS] = {};
+    TrackedIdentifier m_UntrackedIdentifier;
 
-    QueueMutex m_mtxLock;
+    MemoryArena m_FrameArena;
 
-    bool m_bCompact = false;
+    std::shared_mutex m_ArenasMutex;
+    std::unordered_map<std::string, std::unique_ptr<MemoryArena>> m_Arenas;
 };
 
-#endif
\ No newline at end of file
+#endif
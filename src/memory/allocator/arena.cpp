@@ -0,0 +1,153 @@
+/************************************************************************************************
+ *  SwiftlyS2 is a scripting framework for Source2-based games.
+ *  Copyright (C) 2023-2026 Swiftly Solution SRL via Sava Andrei-Sebastian and it's contributors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ ************************************************************************************************/
+
+#include "arena.h"
+
+#include <cstdlib>
+#include <new>
+
+#include "tier0/memdbgon.h"
+
+static uint64_t AlignArenaSize(uint64_t size)
+{
+    return (size + ARENA_ALIGNMENT - 1) & ~(uint64_t)(ARENA_ALIGNMENT - 1);
+}
+
+MemoryArena::~MemoryArena()
+{
+    FreeChunks();
+}
+
+MemoryArena::Chunk* MemoryArena::CreateChunk(uint64_t capacity)
+{
+    void* memory = malloc(sizeof(Chunk) + capacity);
+    if (!memory) return nullptr;
+
+    Chunk* chunk = new (memory) Chunk();
+    chunk->next = nullptr;
+    chunk->capacity = capacity;
+    chunk->used.store(0, std::memory_order_relaxed);
+
+    m_uReserved.fetch_add(capacity, std::memory_order_relaxed);
+    return chunk;
+}
+
+void MemoryArena::FreeChunks()
+{
+    m_pCurrent.store(nullptr, std::memory_order_release);
+
+    Chunk* chunk = m_pChunks;
+    while (chunk)
+    {
+        Chunk* next = chunk->next;
+        chunk->~Chunk();
+        free(chunk);
+        chunk = next;
+    }
+
+    m_pChunks = nullptr;
+    m_uReserved.store(0, std::memory_order_relaxed);
+}
+
+void* MemoryArena::Alloc(uint64_t size)
+{
+    size = AlignArenaSize(size == 0 ? 1 : size);
+
+    Chunk* chunk = m_pCurrent.load(std::memory_order_acquire);
+    if (chunk)
+    {
+        uint64_t offset = chunk->used.fetch_add(size, std::memory_order_relaxed);
+        if (offset + size <= chunk->capacity)
+        {
+            m_uAllocated.fetch_add(size, std::memory_order_relaxed);
+            return chunk->Data() + offset;
+        }
+    }
+
+    return AllocSlow(size);
+}
+
+void* MemoryArena::AllocSlow(uint64_t size)
+{
+    std::lock_guard lock(m_mtxChunks);
+
+    // another thread might have added a chunk while we were waiting
+    Chunk* current = m_pCurrent.load(std::memory_order_acquire);
+    if (current)
+    {
+        uint64_t offset = current->used.fetch_add(size, std::memory_order_relaxed);
+        if (offset + size <= current->capacity)
+        {
+            m_uAllocated.fetch_add(size, std::memory_order_relaxed);
+            return current->Data() + offset;
+        }
+    }
+
+    Chunk* chunk = CreateChunk(size > ARENA_CHUNK_SIZE ? size : ARENA_CHUNK_SIZE);
+    if (!chunk) return nullptr;
+
+    chunk->used.store(size, std::memory_order_relaxed);
+    chunk->next = m_pChunks;
+    m_pChunks = chunk;
+
+    // oversized blocks get their own chunk and leave the current one in place
+    if (size <= ARENA_CHUNK_SIZE || !current)
+        m_pCurrent.store(chunk, std::memory_order_release);
+
+    m_uAllocated.fetch_add(size, std::memory_order_relaxed);
+    return chunk->Data();
+}
+
+void MemoryArena::Reset(bool keep_memory)
+{
+    std::lock_guard lock(m_mtxChunks);
+
+    uint64_t allocated = m_uAllocated.exchange(0, std::memory_order_relaxed);
+    if (!keep_memory || !m_pChunks)
+    {
+        FreeChunks();
+        return;
+    }
+
+    // a single chunk that was big enough is simply rewound
+    if (!m_pChunks->next && m_pChunks->capacity >= allocated)
+    {
+        m_pChunks->used.store(0, std::memory_order_relaxed);
+        m_pCurrent.store(m_pChunks, std::memory_order_release);
+        return;
+    }
+
+    FreeChunks();
+
+    uint64_t capacity = AlignArenaSize(allocated);
+    Chunk* chunk = CreateChunk(capacity > ARENA_CHUNK_SIZE ? capacity : ARENA_CHUNK_SIZE);
+    if (!chunk) return;
+
+    m_pChunks = chunk;
+    m_pCurrent.store(chunk, std::memory_order_release);
+}
+
+uint64_t MemoryArena::GetAllocated()
+{
+    return m_uAllocated.load(std::memory_order_relaxed);
+}
+
+uint64_t MemoryArena::GetReserved()
+{
+    return m_uReserved.load(std::memory_order_relaxed);
+}
@@ -0,0 +1,70 @@
+/************************************************************************************************
+ *  SwiftlyS2 is a scripting framework for Source2-based games.
+ *  Copyright (C) 2023-2026 Swiftly Solution SRL via Sava Andrei-Sebastian and it's contributors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ ************************************************************************************************/
+
+#ifndef src_memory_allocator_arena_h
+#define src_memory_allocator_arena_h
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+
+#define ARENA_CHUNK_SIZE (64 * 1024)
+#define ARENA_ALIGNMENT 16
+
+// Bump allocator, individual blocks can't be freed, everything goes away on Reset.
+// Alloc is lock-free while the current chunk has room; Reset must not race with Alloc.
+class MemoryArena
+{
+public:
+    MemoryArena() = default;
+    ~MemoryArena();
+
+    MemoryArena(const MemoryArena&) = delete;
+    MemoryArena& operator=(const MemoryArena&) = delete;
+
+    void* Alloc(uint64_t size);
+
+    // keep_memory holds on to a single chunk big enough for everything allocated since the last reset
+    void Reset(bool keep_memory);
+
+    uint64_t GetAllocated();
+    uint64_t GetReserved();
+
+private:
+    struct alignas(ARENA_ALIGNMENT) Chunk
+    {
+        Chunk* next;
+        uint64_t capacity;
+        std::atomic<uint64_t> used;
+
+        uint8_t* Data() { return reinterpret_cast<uint8_t*>(this + 1); }
+    };
+
+    void* AllocSlow(uint64_t size);
+    Chunk* CreateChunk(uint64_t capacity);
+    void FreeChunks();
+
+    std::atomic<Chunk*> m_pCurrent{ nullptr };
+    Chunk* m_pChunks = nullptr;
+    std::mutex m_mtxChunks;
+
+    std::atomic<uint64_t> m_uAllocated{ 0 };
+    std::atomic<uint64_t> m_uReserved{ 0 };
+};
+
+#endif
@@ -0,0 +1,212 @@
+/************************************************************************************************
+ *  SwiftlyS2 is a scripting framework for Source2-based games.
+ *  Copyright (C) 2023-2026 Swiftly Solution SRL via Sava Andrei-Sebastian and it's contributors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ ************************************************************************************************/
+
+#include "bundle.h"
+
+#include <api/interfaces/manager.h>
+
+#include <api/shared/files.h>
+#include <api/shared/hash.h>
+#include <api/shared/string.h>
+
+#include <core/entrypoint.h>
+
+#include <algorithm>
+#include <vector>
+
+#include <fmt/format.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+GameDataBundle g_GameDataBundle;
+
+GameDataBundle::~GameDataBundle()
+{
+    Close();
+}
+
+bool GameDataBundle::Open(const std::string& game)
+{
+    std::lock_guard lock(m_OpenMutex);
+    if (m_sGame == game) return m_bLoaded;
+
+    Close();
+    m_sGame = game;
+
+    auto logger = g_ifaceService.FetchInterface<ILogger>(LOGGER_INTERFACE_VERSION);
+    std::string path = g_SwiftlyCore.GetCorePath() + "gamedata/" + game + "/gamedata.bin";
+
+    if (!Files::ExistsPath(path)) return false;
+
+    if (!Map(Files::GeneratePath(path)))
+    {
+        logger->Warning("GameData", fmt::format("Couldn't read the gamedata bundle '{}', falling back to jsonc.\n", path));
+        Close();
+        m_sGame = game;
+        return false;
+    }
+
+    if (!Validate(game))
+    {
+        logger->Warning("GameData", fmt::format("The gamedata bundle '{}' doesn't match the jsonc files anymore, falling back to jsonc.\n", path));
+        Close();
+        m_sGame = game;
+        return false;
+    }
+
+    m_bLoaded = true;
+    return true;
+}
+
+bool GameDataBundle::Map(const std::string& path)
+{
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) return false;
+    m_hFile = file;
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size) || size.QuadPart < (LONGLONG)sizeof(GameDataBundleHeader)) return false;
+
+    m_hMapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!m_hMapping) return false;
+
+    m_pData = (const uint8_t*)MapViewOfFile(m_hMapping, FILE_MAP_READ, 0, 0, 0);
+    m_uSize = (size_t)size.QuadPart;
+#else
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd == -1) return false;
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size < (off_t)sizeof(GameDataBundleHeader))
+    {
+        close(fd);
+        return false;
+    }
+
+    void* data = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) return false;
+
+    m_pData = (const uint8_t*)data;
+    m_uSize = (size_t)st.st_size;
+#endif
+
+    return m_pData != nullptr;
+}
+
+void GameDataBundle::Close()
+{
+#ifdef _WIN32
+    if (m_pData) UnmapViewOfFile(m_pData);
+    if (m_hMapping) CloseHandle(m_hMapping);
+    if (m_hFile) CloseHandle(m_hFile);
+    m_hMapping = nullptr;
+    m_hFile = nullptr;
+#else
+    if (m_pData) munmap((void*)m_pData, m_uSize);
+#endif
+
+    m_pData = nullptr;
+    m_uSize = 0;
+    m_bLoaded = false;
+    m_sGame.clear();
+}
+
+bool GameDataBundle::Validate(const std::string& game)
+{
+    auto header = (const GameDataBundleHeader*)m_pData;
+    if (header->magic != GAMEDATA_BUNDLE_MAGIC || header->version != GAMEDATA_BUNDLE_VERSION) return false;
+
+    uint64_t entries = sizeof(GameDataBundleHeader) + (uint64_t)header->offsetCount * sizeof(GameDataBundleOffset) + (uint64_t)header->signatureCount * sizeof(GameDataBundleSignature) + (uint64_t)header->patchCount * sizeof(GameDataBundlePatch);
+    if (entries > header->stringsOffset || (uint64_t)header->stringsOffset + header->stringsSize > m_uSize) return false;
+    if (header->stringsSize == 0 || m_pData[header->stringsOffset + header->stringsSize - 1] != '\0') return false;
+
+    auto refsValid = [&](const uint32_t* refs, size_t count) {
+        return std::all_of(refs, refs + count, [&](uint32_t ref) { return ref < header->stringsSize; });
+        };
+
+    uint32_t count;
+    auto offsets = GetOffsets(count);
+    for (uint32_t i = 0; i < count; i++)
+        if (!refsValid(&offsets[i].name, 1)) return false;
+
+    auto signatures = GetSignatures(count);
+    if (!refsValid((const uint32_t*)signatures, count * 4)) return false;
+
+    auto patches = GetPatches(count);
+    if (!refsValid((const uint32_t*)patches, count * 4)) return false;
+
+    // same walk as the generator: every gamedata jsonc sorted by its path relative to the game folder
+    std::string root = replace(g_SwiftlyCore.GetCorePath() + "gamedata/" + game + "/", "\\", "/");
+    std::vector<std::string> sources;
+    for (auto& file : Files::FetchFileNames(g_SwiftlyCore.GetCorePath() + "gamedata/" + game))
+    {
+        std::string relative = replace(file, "\\", "/");
+        if (!starts_with(relative, root)) continue;
+        relative = relative.substr(root.size());
+
+        if (ends_with(relative, "offsets.jsonc") || ends_with(relative, "signatures.jsonc") || ends_with(relative, "patches.jsonc"))
+            sources.push_back(relative);
+    }
+    std::sort(sources.begin(), sources.end());
+
+    uint64_t hash = val_64_const;
+    for (auto& source : sources)
+    {
+        std::string content = Files::Read(root + source);
+        hash = hash_64_fnv1a(source.c_str(), source.size() + 1, hash);
+        hash = hash_64_fnv1a(content.c_str(), content.size() + 1, hash);
+    }
+
+    return hash == header->sourceHash;
+}
+
+const GameDataBundleOffset* GameDataBundle::GetOffsets(uint32_t& count) const
+{
+    auto header = (const GameDataBundleHeader*)m_pData;
+    count = header->offsetCount;
+    return (const GameDataBundleOffset*)(m_pData + sizeof(GameDataBundleHeader));
+}
+
+const GameDataBundleSignature* GameDataBundle::GetSignatures(uint32_t& count) const
+{
+    auto header = (const GameDataBundleHeader*)m_pData;
+    count = header->signatureCount;
+    return (const GameDataBundleSignature*)(m_pData + sizeof(GameDataBundleHeader) + header->offsetCount * sizeof(GameDataBundleOffset));
+}
+
+const GameDataBundlePatch* GameDataBundle::GetPatches(uint32_t& count) const
+{
+    auto header = (const GameDataBundleHeader*)m_pData;
+    count = header->patchCount;
+    return (const GameDataBundlePatch*)(m_pData + sizeof(GameDataBundleHeader) + header->offsetCount * sizeof(GameDataBundleOffset) + header->signatureCount * sizeof(GameDataBundleSignature));
+}
+
+const char* GameDataBundle::GetString(uint32_t ref) const
+{
+    auto header = (const GameDataBundleHeader*)m_pData;
+    return (const char*)(m_pData + header->stringsOffset + ref);
+}
@@ -0,0 +1,106 @@
+/************************************************************************************************
+ *  SwiftlyS2 is a scripting framework for Source2-based games.
+ *  Copyright (C) 2023-2026 Swiftly Solution SRL via Sava Andrei-Sebastian and it's contributors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ ************************************************************************************************/
+
+#ifndef src_memory_gamedata_bundle_h
+#define src_memory_gamedata_bundle_h
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+
+#define GAMEDATA_BUNDLE_MAGIC 0x44475753 // "SWGD"
+#define GAMEDATA_BUNDLE_VERSION 1
+
+#pragma pack(push, 1)
+struct GameDataBundleHeader
+{
+    uint32_t magic;
+    uint32_t version;
+    uint64_t sourceHash;
+    uint32_t offsetCount;
+    uint32_t signatureCount;
+    uint32_t patchCount;
+    uint32_t stringsOffset;
+    uint32_t stringsSize;
+    uint32_t reserved;
+};
+
+// every uint32_t except the values is an offset into the string table
+struct GameDataBundleOffset
+{
+    uint32_t name;
+    int32_t windowsValue;
+    int32_t linuxValue;
+};
+
+struct GameDataBundleSignature
+{
+    uint32_t name;
+    uint32_t lib;
+    uint32_t windowsPattern;
+    uint32_t linuxPattern;
+};
+
+struct GameDataBundlePatch
+{
+    uint32_t name;
+    uint32_t signature;
+    uint32_t windowsPatch;
+    uint32_t linuxPatch;
+};
+#pragma pack(pop)
+
+// gamedata/<game>/gamedata.bin, compiled from the jsonc files by generator/gamedata_generator at build time.
+// The bundle is mapped read-only and only used while it matches the jsonc next to it,
+// so hand edits to the jsonc always win over a stale bundle.
+class GameDataBundle
+{
+public:
+    ~GameDataBundle();
+
+    // opens the bundle once per game, false means the jsonc has to be parsed
+    // offsets, signatures and patches load in parallel at startup, whoever comes first maps it
+    bool Open(const std::string& game);
+    void Close();
+
+    const GameDataBundleOffset* GetOffsets(uint32_t& count) const;
+    const GameDataBundleSignature* GetSignatures(uint32_t& count) const;
+    const GameDataBundlePatch* GetPatches(uint32_t& count) const;
+
+    const char* GetString(uint32_t ref) const;
+
+private:
+    bool Map(const std::string& path);
+    bool Validate(const std::string& game);
+
+    std::mutex m_OpenMutex;
+    std::string m_sGame;
+    bool m_bLoaded = false;
+
+    const uint8_t* m_pData = nullptr;
+    size_t m_uSize = 0;
+#ifdef _WIN32
+    void* m_hFile = nullptr;
+    void* m_hMapping = nullptr;
+#endif
+};
+
+extern GameDataBundle g_GameDataBundle;
+
+#endif
@@ -17,6 +17,7 @@
  ************************************************************************************************/
 
 #include "offsets.h"
+#include "bundle.h"
 
 #include <api/shared/files.h>
 #include <api/shared/string.h>
@@ -25,6 +26,8 @@
 
 #include <api/interfaces/manager.h>
 
+#include <algorithm>
+
 #include <fmt/format.h>
 
 #include <core/entrypoint.h>
@@ -37,6 +40,16 @@ void GameDataOffsets::Load(const std::string& game)
 {
     auto logger = g_ifaceService.FetchInterface<ILogger>(LOGGER_INTERFACE_VERSION);
 
+    if (g_GameDataBundle.Open(game))
+    {
+        uint32_t count;
+        auto offsets = g_GameDataBundle.GetOffsets(count);
+        for (uint32_t i = 0; i < count; i++)
+            Insert(g_GameDataBundle.GetString(offsets[i].name), WIN_LINUX(offsets[i].windowsValue, offsets[i].linuxValue));
+
+        return;
+    }
+
     auto files = Files::FetchFileNames(g_SwiftlyCore.GetCorePath() + "gamedata/" + game);
     for (auto file : files) {
         if (!ends_with(file, "offsets.jsonc")) continue;
@@ -46,11 +59,6 @@ void GameDataOffsets::Load(const std::string& game)
             offsetsJson = parseJsonc(Files::Read(file));
 
             for (auto& [key, value] : offsetsJson.items()) {
-                if (m_mOffsets.contains(key)) {
-                    logger->Warning("GameData", fmt::format("Offset '{}' is already defined. Skipping...\n", key));
-                    continue;
-                }
-
                 if (!value.contains("windows")) {
                     logger->Error("GameData", fmt::format("Failed to parse offset '{}'.\nError: Couldn't find the offset field for Windows. ('{}.windows')\n", key, key));
                     continue;
@@ -71,8 +79,7 @@ void GameDataOffsets::Load(const std::string& game)
                     continue;
                 }
 
-                m_mOffsets.insert({ key, value[WIN_LINUX("windows", "linux")].get<int>() });
-                logger->Info("GameData", fmt::format("Loaded offset '{}' => '{}'.\n", key, value[WIN_LINUX("windows", "linux")].get<int>()));
+                Insert(key, value[WIN_LINUX("windows", "linux")].get<int>());
             }
         }
         catch (json::parse_error& e) {
@@ -82,6 +89,22 @@ void GameDataOffsets::Load(const std::string& game)
     }
 }
 
+void GameDataOffsets::Insert(const std::string& name, int value)
+{
+    auto logger = g_ifaceService.FetchInterface<ILogger>(LOGGER_INTERFACE_VERSION);
+
+    if (m_mOffsets.contains(name)) {
+        logger->Warning("GameData", fmt::format("Offset '{}' is already defined. Skipping...\n", name));
+        return;
+    }
+
+    m_mOffsets.insert({ name, value });
+    logger->Info("GameData", fmt::format("Loaded offset '{}' => '{}'.\n", name, value));
+
+    auto id = std::find_if(std::begin(g_GameDataOffsetNames), std::end(g_GameDataOffsetNames), [&](const char* entry) { return name == entry; });
+    if (id != std::end(g_GameDataOffsetNames)) m_aOffsets[id - std::begin(g_GameDataOffsetNames)] = value;
+}
+
 bool GameDataOffsets::Exists(const std::string& name)
 {
     return m_mOffsets.contains(name);
@@ -90,4 +113,9 @@ bool GameDataOffsets::Exists(const std::string& name)
 int GameDataOffsets::Fetch(const std::string& name)
 {
     return m_mOffsets.contains(name) ? m_mOffsets.at(name) : 0;
+}
+
+int GameDataOffsets::Fetch(GameDataOffset id)
+{
+    return (size_t)id < (size_t)GameDataOffset::Count ? m_aOffsets[(size_t)id] : 0;
 }
\ No newline at end of file
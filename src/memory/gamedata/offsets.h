@@ -30,8 +30,12 @@ public:
     virtual void Load(const std::string& game) override;
     virtual bool Exists(const std::string& name) override;
     virtual int Fetch(const std::string& name) override;
+    virtual int Fetch(GameDataOffset id) override;
 private:
+    void Insert(const std::string& name, int value);
+
     std::map<std::string, int> m_mOffsets;
+    int m_aOffsets[(size_t)GameDataOffset::Count] = {};
 };
 
 #endif
\ No newline at end of file
@@ -17,6 +17,7 @@
  ************************************************************************************************/
 
 #include "patches.h"
+#include "bundle.h"
 
 #include <api/interfaces/manager.h>
 
@@ -38,6 +39,28 @@ void GameDataPatches::Load(const std::string& game)
     auto logger = g_ifaceService.FetchInterface<ILogger>(LOGGER_INTERFACE_VERSION);
     auto gamedata = g_ifaceService.FetchInterface<IGameDataManager>(GAMEDATA_INTERFACE_VERSION);
 
+    if (g_GameDataBundle.Open(game))
+    {
+        uint32_t count;
+        auto patches = g_GameDataBundle.GetPatches(count);
+        for (uint32_t i = 0; i < count; i++)
+        {
+            std::string key = g_GameDataBundle.GetString(patches[i].name);
+            std::string signature = g_GameDataBundle.GetString(patches[i].signature);
+            if (!gamedata->GetSignatures()->Exists(signature))
+            {
+                logger->Error("GameData", fmt::format("Failed to parse patch '{}'.\nError: Couldn't find the signature '{}'.\n", key, signature));
+                continue;
+            }
+
+            std::string patch = g_GameDataBundle.GetString(WIN_LINUX(patches[i].windowsPatch, patches[i].linuxPatch));
+            m_mPatches.insert({ key, {patch, signature} });
+            logger->Info("GameData", fmt::format("Loaded patch '{}' => '{}' (signature='{}').\n", key, patch, signature));
+        }
+
+        return;
+    }
+
     auto files = Files::FetchFileNames(g_SwiftlyCore.GetCorePath() + "gamedata/" + game);
     for (auto file : files) {
         if (!ends_with(file, "patches.jsonc")) continue;
@@ -0,0 +1,525 @@
+/************************************************************************************************
+ *  SwiftlyS2 is a scripting framework for Source2-based games.
+ *  Copyright (C) 2023-2026 Swiftly Solution SRL via Sava Andrei-Sebastian and it's contributors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ ************************************************************************************************/
+
+#include "scanner.h"
+
+#include <api/shared/files.h>
+#include <api/shared/jsonc.h>
+#include <api/shared/string.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <thread>
+
+#include <emmintrin.h>
+#include <fmt/format.h>
+#include <nlohmann/json.hpp>
+#include <s2binlib/s2binlib.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <elf.h>
+#endif
+
+using json = nlohmann::json;
+
+// rough frequency of a byte in x86-64 code, the anchor avoids the common ones
+static uint8_t ByteWeight(uint8_t byte)
+{
+    switch (byte)
+    {
+    case 0x00: return 10;
+    case 0x48: return 9;
+    case 0xFF: case 0x8B: return 8;
+    case 0x89: return 7;
+    case 0xCC: case 0x24: return 6;
+    case 0x4C: case 0xE8: case 0x0F: case 0x83: return 5;
+    case 0x44: case 0x8D: return 4;
+    case 0xC3: case 0x74: case 0x85: case 0xC0: case 0x01: return 3;
+    case 0x08: case 0x10: case 0x20: case 0x40: case 0x49: case 0x4D: return 2;
+    default: return 0;
+    }
+}
+
+int SignatureScanner::Add(const std::string& library, const std::string& pattern)
+{
+    std::string key = library + '\n' + pattern;
+
+    auto it = m_Handles.find(key);
+    if (it != m_Handles.end()) return it->second;
+
+    auto entry = std::make_unique<ScanPattern>();
+    entry->library = library;
+    entry->pattern = pattern;
+
+    int handle = (int)m_Patterns.size();
+    m_Patterns.push_back(std::move(entry));
+    m_Handles.insert({ key, handle });
+    return handle;
+}
+
+void* SignatureScanner::Result(int handle) const
+{
+    if (handle < 0 || handle >= (int)m_Patterns.size()) return nullptr;
+    return m_Patterns[handle]->result;
+}
+
+bool SignatureScanner::Parse(ScanPattern& pattern)
+{
+    for (auto& token : explode(pattern.pattern, " "))
+    {
+        if (token.empty()) continue;
+
+        if (token == "?" || token == "??")
+        {
+            pattern.bytes.push_back(0);
+            pattern.mask.push_back(0);
+            continue;
+        }
+
+        if (token.size() > 2 || !std::isxdigit((unsigned char)token[0]) || (token.size() == 2 && !std::isxdigit((unsigned char)token[1])))
+            return false;
+
+        pattern.bytes.push_back((uint8_t)std::stoul(token, nullptr, 16));
+        pattern.mask.push_back(0xFF);
+    }
+
+    pattern.length = pattern.bytes.size();
+
+    int best = -1;
+    for (size_t i = 0; i + 1 < pattern.length; i++)
+    {
+        if (!pattern.mask[i] || !pattern.mask[i + 1]) continue;
+
+        int weight = ByteWeight(pattern.bytes[i]) + ByteWeight(pattern.bytes[i + 1]);
+        if (best == -1 || weight < best)
+        {
+            best = weight;
+            pattern.anchor = i;
+        }
+    }
+
+    // patterns without two fixed bytes in a row are left to s2binlib
+    if (best == -1) return false;
+
+    size_t padded = (pattern.length + 15) & ~(size_t)15;
+    pattern.bytes.resize(padded, 0);
+    pattern.mask.resize(padded, 0);
+    return true;
+}
+
+bool SignatureScanner::ResolveModule(ScanModule& module)
+{
+    char path[1024] = {};
+    if (s2binlib_get_binary_path(module.library.c_str(), path, sizeof(path)) != 0) return false;
+    if (s2binlib_get_module_base_address(module.library.c_str(), &module.base) != 0 || !module.base) return false;
+
+    module.path = path;
+
+    std::error_code ec;
+    uint64_t size = std::filesystem::file_size(module.path, ec);
+    if (ec) return false;
+
+    std::ifstream file(module.path, std::ios::binary);
+    if (!file.is_open()) return false;
+
+    // only the headers are read here, a cache hit never touches the rest of the file
+    auto readAt = [&](uint64_t offset, void* out, size_t length) {
+        return offset + length <= size && file.seekg(offset) && file.read(reinterpret_cast<char*>(out), length);
+        };
+
+    std::string id;
+
+    // the executable sections bound the cached offsets, LoadImage replaces them once the whole file is read
+    module.sections.clear();
+
+#ifdef _WIN32
+    IMAGE_DOS_HEADER dosHeader;
+    IMAGE_NT_HEADERS ntHeaders;
+    if (readAt(0, &dosHeader, sizeof(dosHeader)) && dosHeader.e_magic == IMAGE_DOS_SIGNATURE &&
+        readAt(dosHeader.e_lfanew, &ntHeaders, sizeof(ntHeaders)) && ntHeaders.Signature == IMAGE_NT_SIGNATURE)
+    {
+        id = fmt::format("{:08X}{:X}{:08X}", ntHeaders.FileHeader.TimeDateStamp, ntHeaders.OptionalHeader.SizeOfImage, ntHeaders.OptionalHeader.CheckSum);
+
+        std::vector<IMAGE_SECTION_HEADER> sections(ntHeaders.FileHeader.NumberOfSections);
+        uint64_t sectionsOffset = (uint64_t)dosHeader.e_lfanew + FIELD_OFFSET(IMAGE_NT_HEADERS, OptionalHeader) + ntHeaders.FileHeader.SizeOfOptionalHeader;
+        if (readAt(sectionsOffset, sections.data(), sections.size() * sizeof(IMAGE_SECTION_HEADER)))
+        {
+            for (auto& section : sections)
+            {
+                if (!(section.Characteristics & IMAGE_SCN_MEM_EXECUTE)) continue;
+                module.sections.push_back({ section.PointerToRawData, std::min<uint64_t>(section.SizeOfRawData, section.Misc.VirtualSize), section.VirtualAddress });
+            }
+        }
+    }
+#else
+    Elf64_Ehdr elfHeader;
+    if (readAt(0, &elfHeader, sizeof(elfHeader)) && memcmp(elfHeader.e_ident, ELFMAG, SELFMAG) == 0)
+    {
+        std::vector<Elf64_Shdr> sections(elfHeader.e_shnum);
+        if (readAt(elfHeader.e_shoff, sections.data(), sections.size() * sizeof(Elf64_Shdr)))
+        {
+            for (auto& section : sections)
+            {
+                if ((section.sh_flags & SHF_EXECINSTR) && section.sh_type != SHT_NOBITS)
+                    module.sections.push_back({ section.sh_offset, section.sh_size, section.sh_addr });
+
+                if (section.sh_type != SHT_NOTE || section.sh_size > 4096 || !id.empty()) continue;
+
+                std::vector<uint8_t> notes(section.sh_size);
+                if (!readAt(section.sh_offset, notes.data(), notes.size())) continue;
+
+                for (size_t pos = 0; pos + sizeof(Elf64_Nhdr) <= notes.size();)
+                {
+                    auto note = reinterpret_cast<Elf64_Nhdr*>(notes.data() + pos);
+                    size_t name = pos + sizeof(Elf64_Nhdr);
+                    size_t desc = name + ((note->n_namesz + 3) & ~3u);
+                    if (desc + note->n_descsz > notes.size()) break;
+
+                    if (note->n_type == NT_GNU_BUILD_ID && note->n_namesz == 4 && memcmp(notes.data() + name, "GNU", 4) == 0)
+                    {
+                        for (uint32_t i = 0; i < note->n_descsz; i++)
+                            id += fmt::format("{:02x}", notes[desc + i]);
+                        break;
+                    }
+
+                    pos = desc + ((note->n_descsz + 3) & ~3u);
+                }
+            }
+        }
+    }
+#endif
+
+    if (id.empty())
+    {
+        auto time = std::filesystem::last_write_time(module.path, ec);
+        if (ec) return false;
+        id = fmt::format("t{}", time.time_since_epoch().count());
+    }
+
+    module.fingerprint = fmt::format("{}:{}", size, id);
+    return true;
+}
+
+bool SignatureScanner::LoadImage(ScanModule& module)
+{
+    std::ifstream file(module.path, std::ios::binary | std::ios::ate);
+    if (!file.is_open()) return false;
+
+    size_t size = file.tellg();
+    file.seekg(0, std::ios::beg);
+
+    // the tail lets the comparison read whole 16 byte blocks past the last section
+    module.image.resize(size + 16, 0);
+    if (!file.read(reinterpret_cast<char*>(module.image.data()), size)) return false;
+
+    auto& image = module.image;
+    module.sections.clear();
+
+#ifdef _WIN32
+    if (size < sizeof(IMAGE_DOS_HEADER)) return false;
+
+    auto dosHeader = reinterpret_cast<IMAGE_DOS_HEADER*>(image.data());
+    if (dosHeader->e_magic != IMAGE_DOS_SIGNATURE || (size_t)dosHeader->e_lfanew + sizeof(IMAGE_NT_HEADERS) > size) return false;
+
+    auto ntHeaders = reinterpret_cast<IMAGE_NT_HEADERS*>(image.data() + dosHeader->e_lfanew);
+    if (ntHeaders->Signature != IMAGE_NT_SIGNATURE) return false;
+
+    auto sections = IMAGE_FIRST_SECTION(ntHeaders);
+    for (uint16_t i = 0; i < ntHeaders->FileHeader.NumberOfSections; i++)
+    {
+        auto& section = sections[i];
+        if (!(section.Characteristics & IMAGE_SCN_MEM_EXECUTE)) continue;
+
+        uint64_t length = std::min<uint64_t>(section.SizeOfRawData, section.Misc.VirtualSize);
+        if ((uint64_t)section.PointerToRawData + length > size) continue;
+
+        module.sections.push_back({ section.PointerToRawData, length, section.VirtualAddress });
+    }
+#else
+    if (size < sizeof(Elf64_Ehdr)) return false;
+
+    auto elfHeader = reinterpret_cast<Elf64_Ehdr*>(image.data());
+    if (memcmp(elfHeader->e_ident, ELFMAG, SELFMAG) != 0 || elfHeader->e_ident[EI_CLASS] != ELFCLASS64) return false;
+    if (elfHeader->e_shoff + (uint64_t)elfHeader->e_shnum * sizeof(Elf64_Shdr) > size) return false;
+
+    auto sections = reinterpret_cast<Elf64_Shdr*>(image.data() + elfHeader->e_shoff);
+    for (uint16_t i = 0; i < elfHeader->e_shnum; i++)
+    {
+        auto& section = sections[i];
+        if (!(section.sh_flags & SHF_EXECINSTR) || section.sh_type == SHT_NOBITS) continue;
+        if (section.sh_offset + section.sh_size > size) continue;
+
+        module.sections.push_back({ section.sh_offset, section.sh_size, section.sh_addr });
+    }
+#endif
+
+    std::sort(module.sections.begin(), module.sections.end(), [](const ScanSection& a, const ScanSection& b) { return a.fileOffset < b.fileOffset; });
+    return !module.sections.empty();
+}
+
+void SignatureScanner::BuildIndex(ScanModule& module)
+{
+    module.bitmap.assign(65536 / 64, 0);
+    module.heads.assign(65536 + 1, 0);
+    module.buckets.resize(module.patterns.size());
+
+    auto pairOf = [](ScanPattern* pattern) {
+        return (uint32_t)pattern->bytes[pattern->anchor] | ((uint32_t)pattern->bytes[pattern->anchor + 1] << 8);
+        };
+
+    for (auto pattern : module.patterns)
+    {
+        uint32_t pair = pairOf(pattern);
+        module.bitmap[pair >> 6] |= 1ull << (pair & 63);
+        module.heads[pair + 1]++;
+    }
+
+    for (size_t i = 1; i < module.heads.size(); i++)
+        module.heads[i] += module.heads[i - 1];
+
+    std::vector<uint32_t> fill(module.heads.begin(), module.heads.end() - 1);
+    for (auto pattern : module.patterns)
+        module.buckets[fill[pairOf(pattern)]++] = pattern;
+}
+
+static bool MatchesAt(const uint8_t* data, const ScanPattern& pattern)
+{
+    for (size_t i = 0; i < pattern.bytes.size(); i += 16)
+    {
+        __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        __m128i mask = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pattern.mask.data() + i));
+        __m128i expected = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pattern.bytes.data() + i));
+
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(bytes, mask), expected)) != 0xFFFF)
+            return false;
+    }
+    return true;
+}
+
+void SignatureScanner::ScanChunk(ScanModule& module, const ScanSection& section, uint64_t begin, uint64_t end)
+{
+    const uint8_t* image = module.image.data();
+    const uint64_t* bitmap = module.bitmap.data();
+    uint64_t sectionEnd = section.fileOffset + section.size;
+
+    // begin..end are anchor positions, every position belongs to exactly one chunk
+    end = std::min(end, sectionEnd - 1);
+    for (uint64_t i = begin; i < end; i++)
+    {
+        uint32_t pair = (uint32_t)image[i] | ((uint32_t)image[i + 1] << 8);
+        if (!(bitmap[pair >> 6] & (1ull << (pair & 63)))) continue;
+
+        for (uint32_t b = module.heads[pair]; b < module.heads[pair + 1]; b++)
+        {
+            ScanPattern* pattern = module.buckets[b];
+            if (i < section.fileOffset + pattern->anchor) continue;
+
+            uint64_t position = i - pattern->anchor;
+            if (position + pattern->length > sectionEnd) continue;
+
+            uint64_t found = pattern->offset.load(std::memory_order_relaxed);
+            if (found <= position) continue;
+            if (!MatchesAt(image + position, *pattern)) continue;
+
+            // the first match in file order wins, same as a linear scan
+            while (position < found && !pattern->offset.compare_exchange_weak(found, position, std::memory_order_relaxed));
+        }
+    }
+}
+
+// a cached offset from disk can be anything, only ones that keep the whole pattern inside an
+// executable section of the module are read at all
+static bool InExecutableSection(const ScanModule& module, uint64_t offset, size_t length)
+{
+    for (auto& section : module.sections)
+        if (offset >= section.rva && offset <= section.rva + section.size && length <= section.rva + section.size - offset) return true;
+
+    return false;
+}
+
+// the cached address is only trusted if the pattern still matches the loaded module there
+static bool MatchesInMemory(const uint8_t* address, const ScanPattern& pattern)
+{
+    for (size_t i = 0; i < pattern.length; i++)
+        if ((address[i] & pattern.mask[i]) != pattern.bytes[i]) return false;
+
+    return true;
+}
+
+void SignatureScanner::Run()
+{
+    std::map<std::string, ScanModule> modules;
+    std::vector<ScanPattern*> fallback;
+
+    for (auto& pattern : m_Patterns)
+    {
+        if (pattern->result || pattern->offset.load() != UINT64_MAX) continue;
+
+        if (Parse(*pattern)) modules[pattern->library].patterns.push_back(pattern.get());
+        else fallback.push_back(pattern.get());
+    }
+
+    json cache = json::object();
+    if (!m_sCachePath.empty() && Files::ExistsPath(m_sCachePath))
+    {
+        cache = parseJsonc(Files::Read(m_sCachePath));
+        if (!cache.is_object()) cache = json::object();
+    }
+
+    bool cacheChanged = false;
+
+    std::vector<ScanModule*> scanning;
+    for (auto& [library, module] : modules)
+    {
+        module.library = library;
+        if (!ResolveModule(module))
+        {
+            fallback.insert(fallback.end(), module.patterns.begin(), module.patterns.end());
+            continue;
+        }
+
+        json& entry = cache[library];
+        if (!entry.is_object() || entry.value("fingerprint", "") != module.fingerprint)
+        {
+            entry = { { "fingerprint", module.fingerprint }, { "signatures", json::object() } };
+            cacheChanged = true;
+        }
+
+        json& cached = entry["signatures"];
+        std::vector<ScanPattern*> missing;
+        for (auto pattern : module.patterns)
+        {
+            // a null entry is a pattern that isn't in this build of the module at all
+            auto it = cached.find(pattern->pattern);
+            if (it != cached.end() && it->is_null()) continue;
+
+            if (it != cached.end() && it->is_number_unsigned() && InExecutableSection(module, it->get<uint64_t>(), pattern->length))
+            {
+                uint8_t* address = (uint8_t*)module.base + it->get<uint64_t>();
+                if (MatchesInMemory(address, *pattern))
+                {
+                    pattern->result = address;
+                    continue;
+                }
+            }
+            missing.push_back(pattern);
+        }
+
+        module.patterns = std::move(missing);
+        if (!module.patterns.empty()) scanning.push_back(&module);
+    }
+
+    std::vector<std::thread> loaders;
+    for (auto module : scanning)
+    {
+        loaders.emplace_back([module]() {
+            module->loaded = LoadImage(*module);
+            if (module->loaded) BuildIndex(*module);
+            });
+    }
+
+    for (auto& thread : loaders) thread.join();
+
+    struct Chunk
+    {
+        ScanModule* module;
+        const ScanSection* section;
+        uint64_t begin;
+        uint64_t end;
+    };
+
+    std::vector<Chunk> chunks;
+    for (auto module : scanning)
+    {
+        if (!module->loaded)
+        {
+            fallback.insert(fallback.end(), module->patterns.begin(), module->patterns.end());
+            continue;
+        }
+
+        for (auto& section : module->sections)
+            for (uint64_t begin = section.fileOffset; begin < section.fileOffset + section.size; begin += SCANNER_CHUNK_SIZE)
+                chunks.push_back({ module, &section, begin, std::min(begin + SCANNER_CHUNK_SIZE, section.fileOffset + section.size) });
+    }
+
+    std::atomic<size_t> next{ 0 };
+    auto worker = [&]() {
+        for (size_t i = next.fetch_add(1); i < chunks.size(); i = next.fetch_add(1))
+            ScanChunk(*chunks[i].module, *chunks[i].section, chunks[i].begin, chunks[i].end);
+        };
+
+    size_t threadCount = std::clamp<size_t>(std::thread::hardware_concurrency(), 1, std::max<size_t>(chunks.size(), 1));
+    std::vector<std::thread> workers;
+    for (size_t i = 1; i < threadCount; i++)
+        workers.emplace_back(worker);
+
+    worker();
+    for (auto& thread : workers) thread.join();
+
+    for (auto module : scanning)
+    {
+        if (!module->loaded) continue;
+
+        for (auto pattern : module->patterns)
+        {
+            // not in an executable section, let s2binlib look through the rest of the file
+            uint64_t offset = pattern->offset.load();
+            if (offset == UINT64_MAX)
+            {
+                fallback.push_back(pattern);
+                continue;
+            }
+
+            for (auto& section : module->sections)
+            {
+                if (offset >= section.fileOffset && offset < section.fileOffset + section.size)
+                {
+                    pattern->result = (uint8_t*)module->base + section.rva + (offset - section.fileOffset);
+                    break;
+                }
+            }
+        }
+    }
+
+    for (auto pattern : fallback)
+        s2binlib_pattern_scan(pattern->library.c_str(), pattern->pattern.c_str(), &pattern->result);
+
+    if (m_sCachePath.empty()) return;
+
+    for (auto module : scanning)
+    {
+        if (!cache.contains(module->library)) continue;
+
+        json& cached = cache[module->library]["signatures"];
+        for (auto pattern : module->patterns)
+        {
+            if (pattern->result && pattern->result < module->base) continue;
+
+            if (pattern->result) cached[pattern->pattern] = (uint64_t)((uint8_t*)pattern->result - (uint8_t*)module->base);
+            else cached[pattern->pattern] = nullptr;
+            cacheChanged = true;
+        }
+    }
+
+    if (cacheChanged) WriteJSON(m_sCachePath, cache);
+}
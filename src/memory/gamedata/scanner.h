@@ -0,0 +1,100 @@
+/************************************************************************************************
+ *  SwiftlyS2 is a scripting framework for Source2-based games.
+ *  Copyright (C) 2023-2026 Swiftly Solution SRL via Sava Andrei-Sebastian and it's contributors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ ************************************************************************************************/
+
+#ifndef src_memory_gamedata_scanner_h
+#define src_memory_gamedata_scanner_h
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#define SCANNER_CHUNK_SIZE (1 << 20)
+
+struct ScanPattern
+{
+    std::string library;
+    std::string pattern;
+
+    // padded to a multiple of 16, masked bytes are zero in both
+    std::vector<uint8_t> bytes;
+    std::vector<uint8_t> mask;
+    size_t length = 0;
+    size_t anchor = 0;
+
+    std::atomic<uint64_t> offset{ UINT64_MAX };
+    void* result = nullptr;
+};
+
+struct ScanSection
+{
+    uint64_t fileOffset;
+    uint64_t size;
+    uint64_t rva;
+};
+
+struct ScanModule
+{
+    std::string library;
+    std::string path;
+    std::string fingerprint;
+    std::vector<uint8_t> image;
+    std::vector<ScanSection> sections;
+    std::vector<ScanPattern*> patterns;
+    void* base = nullptr;
+    bool loaded = false;
+
+    // anchor pair -> patterns, heads holds the start of every pair in buckets
+    std::vector<uint64_t> bitmap;
+    std::vector<uint32_t> heads;
+    std::vector<ScanPattern*> buckets;
+};
+
+// Resolves a batch of byte signatures with one pass per module instead of one per signature.
+// Every pattern is keyed by its rarest pair of fixed bytes, the executable sections of the
+// module file are walked once and only positions whose pair is in the set get compared.
+// Modules are split in chunks that are scanned in parallel. With a cache path set, addresses
+// from a previous run of the same module files are checked in place and only misses are scanned.
+class SignatureScanner
+{
+public:
+    // returns the handle used to fetch the result after Run
+    int Add(const std::string& library, const std::string& pattern);
+    void Run();
+
+    // resolved addresses are kept there as module relative offsets, keyed by a fingerprint of the module file
+    void SetCachePath(const std::string& path) { m_sCachePath = path; }
+
+    void* Result(int handle) const;
+    size_t Count() const { return m_Patterns.size(); }
+
+private:
+    static bool Parse(ScanPattern& pattern);
+    static bool ResolveModule(ScanModule& module);
+    static bool LoadImage(ScanModule& module);
+    static void BuildIndex(ScanModule& module);
+    static void ScanChunk(ScanModule& module, const ScanSection& section, uint64_t begin, uint64_t end);
+
+    std::vector<std::unique_ptr<ScanPattern>> m_Patterns;
+    std::map<std::string, int> m_Handles;
+    std::string m_sCachePath;
+};
+
+#endif
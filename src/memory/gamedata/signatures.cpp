@@ -18,6 +18,8 @@
 
 #include "signatures.h"
 #include "manager.h"
+#include "scanner.h"
+#include "bundle.h"
 
 #include <api/interfaces/manager.h>
 
@@ -30,6 +32,8 @@
 
 #include <nlohmann/json.hpp>
 
+#include <algorithm>
+
 #include <fmt/format.h>
 #include <s2binlib/s2binlib.h>
 
@@ -39,7 +43,27 @@ void GameDataSignatures::Load(const std::string& game)
 {
     auto logger = g_ifaceService.FetchInterface<ILogger>(LOGGER_INTERFACE_VERSION);
 
-    auto files = Files::FetchFileNames(g_SwiftlyCore.GetCorePath() + "gamedata/" + game);
+    struct PendingSignature
+    {
+        std::string name;
+        std::string lib;
+        std::string signature;
+        int handle;
+    };
+
+    std::vector<PendingSignature> pending;
+    SignatureScanner scanner;
+
+    bool bundled = g_GameDataBundle.Open(game);
+    if (bundled)
+    {
+        uint32_t count;
+        auto signatures = g_GameDataBundle.GetSignatures(count);
+        for (uint32_t i = 0; i < count; i++)
+            pending.push_back({ g_GameDataBundle.GetString(signatures[i].name), g_GameDataBundle.GetString(signatures[i].lib), g_GameDataBundle.GetString(WIN_LINUX(signatures[i].windowsPattern, signatures[i].linuxPattern)), -1 });
+    }
+
+    auto files = bundled ? std::vector<std::string>{} : Files::FetchFileNames(g_SwiftlyCore.GetCorePath() + "gamedata/" + game);
     for (auto file : files) {
         if (!ends_with(file, "signatures.jsonc")) continue;
 
@@ -81,21 +105,7 @@ void GameDataSignatures::Load(const std::string& game)
                 auto lib = value["lib"].get<std::string>();
                 auto signature = value[WIN_LINUX("windows", "linux")].get<std::string>();
 
-                logger->Info("GameData", fmt::format("Searching for signature '{}'...\n", key));
-
-                void* sig = nullptr;
-                if (signature.at(0) == '@' && signature.find(" ") == std::string::npos) s2binlib_find_symbol(lib.c_str(), signature.substr(1).c_str(), &sig);
-                else sig = FindSignature(lib, signature);
-
-                if (!sig)
-                {
-                    logger->Error("GameData", fmt::format("Couldn't find signature '{}'. (lib='{}')\n", key, lib));
-                }
-                else
-                {
-                    m_mSignatures.insert({ key, sig });
-                    logger->Info("GameData", fmt::format("Loaded signature '{}' => '{}' (lib='{}').\n", key, sig, lib));
-                }
+                pending.push_back({ key, lib, signature, -1 });
             }
         }
         catch (json::parse_error& e) {
@@ -103,6 +113,37 @@ void GameDataSignatures::Load(const std::string& game)
             continue;
         }
     }
+
+    for (auto& entry : pending)
+    {
+        if (entry.signature.empty() || (entry.signature.at(0) == '@' && entry.signature.find(" ") == std::string::npos)) continue;
+        entry.handle = scanner.Add(entry.lib, entry.signature);
+    }
+
+    logger->Info("GameData", fmt::format("Searching for {} signatures...\n", pending.size()));
+    scanner.SetCachePath(g_SwiftlyCore.GetCorePath() + "gamedata/" + game + "/cache/signatures.json");
+    scanner.Run();
+
+    for (auto& entry : pending)
+    {
+        void* sig = nullptr;
+        if (entry.handle != -1) sig = scanner.Result(entry.handle);
+        else if (!entry.signature.empty()) s2binlib_find_symbol(entry.lib.c_str(), entry.signature.substr(1).c_str(), &sig);
+
+        if (!sig)
+        {
+            logger->Error("GameData", fmt::format("Couldn't find signature '{}'. (lib='{}')\n", entry.name, entry.lib));
+        }
+        else
+        {
+            if (!m_mSignatures.insert({ entry.name, sig }).second) continue;
+
+            auto id = std::find_if(std::begin(g_GameDataSignatureNames), std::end(g_GameDataSignatureNames), [&](const char* name) { return entry.name == name; });
+            if (id != std::end(g_GameDataSignatureNames)) m_aSignatures[id - std::begin(g_GameDataSignatureNames)] = sig;
+
+            logger->Info("GameData", fmt::format("Loaded signature '{}' => '{}' (lib='{}').\n", entry.name, sig, entry.lib));
+        }
+    }
 }
 
 bool GameDataSignatures::Exists(const std::string& name)
@@ -116,3 +157,8 @@ void* GameDataSignatures::Fetch(const std::string& name)
     if (it != m_mSignatures.end()) return it->second;
     return nullptr;
 }
+
+void* GameDataSignatures::Fetch(GameDataSignature id)
+{
+    return (size_t)id < (size_t)GameDataSignature::Count ? m_aSignatures[(size_t)id] : nullptr;
+}
@@ -28,8 +28,10 @@ public:
     virtual void Load(const std::string& game) override;
     virtual bool Exists(const std::string& name) override;
     virtual void* Fetch(const std::string& name) override;
+    virtual void* Fetch(GameDataSignature id) override;
 private:
     std::map<std::string, void*> m_mSignatures;
+    void* m_aSignatures[(size_t)GameDataSignature::Count] = {};
 };
 
 #endif
\ No newline at end of file
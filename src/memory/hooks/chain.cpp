@@ -0,0 +1,322 @@
+/************************************************************************************************
+ *  SwiftlyS2 is a scripting framework for Source2-based games.
+ *  Copyright (C) 2023-2026 Swiftly Solution SRL via Sava Andrei-Sebastian and it's contributors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ ************************************************************************************************/
+
+#include "chain.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+
+#include <fmt/format.h>
+
+// the most bytes safetyhook overwrites at a target: an e9 hook takes up to 19, an ff hook up to 22
+// plus one more instruction of up to 15
+#define HOOKCHAIN_MAX_PATCH_SIZE 37
+
+HookChainRegistry g_HookChains;
+
+bool JumpStub::Create(void* destination)
+{
+    // jmp qword ptr [rip + 2]; int3; int3; dq destination
+    auto allocation = safetyhook::Allocator::global()->allocate(24);
+    if (!allocation) return false;
+
+    m_Allocation = std::move(*allocation);
+
+    // the slot has to be 8 byte aligned for the store in Set to be atomic
+    uint8_t* code = m_Allocation.data();
+    while (((uintptr_t)(code + 8) & 7) != 0)
+        code++;
+
+    const uint8_t jmp[8] = { 0xFF, 0x25, 0x02, 0x00, 0x00, 0x00, 0xCC, 0xCC };
+    memcpy(code, jmp, sizeof(jmp));
+
+    m_pCode = code;
+    m_pSlot = (void**)(code + 8);
+    Set(destination);
+    return true;
+}
+
+void JumpStub::Set(void* destination)
+{
+    std::atomic_ref<void*>(*m_pSlot).store(destination, std::memory_order_release);
+}
+
+HookChain::~HookChain()
+{
+    // unpatch before the entry stub is freed
+    m_oHook.reset();
+
+    g_HookStats.Release(m_pOriginalStats);
+    for (auto& listener : m_vListeners)
+        g_HookStats.Release(listener->stats);
+}
+
+bool HookChain::Install(void* target, bool deferred)
+{
+    if (!m_Entry.Create(nullptr)) return false;
+
+    m_oHook = safetyhook::create_inline(target, m_Entry.Address(), safetyhook::InlineHook::Flags::StartDisabled);
+    if (!m_oHook) return false;
+
+    m_pTarget = target;
+    m_sName = fmt::format("{}", target);
+    m_Entry.Set(GetOriginal());
+
+    return deferred || Enable();
+}
+
+bool HookChain::Enable()
+{
+    return m_oHook.enable().has_value();
+}
+
+void* HookChain::GetOriginal()
+{
+    return (void*)(m_oHook.trampoline().address());
+}
+
+HookListener* HookChain::Add(uint64_t id, void* callback, int priority, const HookPredicateCondition* conditions, int count)
+{
+    auto listener = std::make_unique<HookListener>();
+    listener->id = id;
+    listener->priority = priority;
+    listener->callback = callback;
+    if (!listener->next.Create(GetOriginal())) return nullptr;
+
+    if (count > 0)
+    {
+        listener->predicate = std::make_unique<HookPredicate>();
+        if (!listener->predicate->Create(conditions, count, callback, listener->next.Address())) return nullptr;
+
+        listener->callback = listener->predicate->Address();
+    }
+
+    // higher priority first, same priority keeps the registration order
+    auto it = std::upper_bound(m_vListeners.begin(), m_vListeners.end(), priority, [](int p, const std::unique_ptr<HookListener>& l) { return p > l->priority; });
+    HookListener* ptr = m_vListeners.insert(it, std::move(listener))->get();
+
+    Relink();
+    return ptr;
+}
+
+bool HookChain::Remove(uint64_t id)
+{
+    auto it = std::find_if(m_vListeners.begin(), m_vListeners.end(), [id](const std::unique_ptr<HookListener>& l) { return l->id == id; });
+    if (it == m_vListeners.end()) return false;
+
+    g_HookStats.Release((*it)->stats);
+    (*it)->stats = nullptr;
+
+    m_vRetired.push_back(std::move(*it));
+    m_vListeners.erase(it);
+
+    Relink();
+    return true;
+}
+
+void HookChain::Relink()
+{
+    bool stats = g_HookStats.IsEnabled();
+
+    // wire back to front so every stub already points somewhere valid once it becomes reachable
+    void* next = stats ? StatsEntry(m_pOriginalStats, m_pOriginalStatsThunk, "original", "", GetOriginal()) : GetOriginal();
+    for (auto it = m_vListeners.rbegin(); it != m_vListeners.rend(); ++it)
+    {
+        HookListener* listener = it->get();
+        listener->next.Set(next);
+        next = stats ? StatsEntry(listener->stats, listener->statsThunk, "detour", listener->owner, listener->callback) : listener->callback;
+    }
+
+    m_Entry.Set(next);
+}
+
+void* HookChain::StatsEntry(HookStatsRecord*& record, std::unique_ptr<HookStatsThunk>& thunk, const char* kind, const std::string& owner, void* destination)
+{
+    if (!thunk)
+    {
+        if (!record)
+        {
+            record = g_HookStats.Register(kind, m_sName);
+            if (!owner.empty()) g_HookStats.SetOwner(record, owner);
+        }
+
+        auto created = std::make_unique<HookStatsThunk>();
+        if (!created->Create(record, destination)) return destination;
+
+        thunk = std::move(created);
+    }
+
+    return thunk->Address();
+}
+
+HookChain* HookChainRegistry::Acquire(void* target)
+{
+    if (!target) return nullptr;
+
+    std::lock_guard lock(m_Mutex);
+
+    auto it = m_Chains.find(target);
+    if (it == m_Chains.end())
+    {
+        bool deferred = m_iTransactionDepth > 0;
+
+        auto chain = std::make_unique<HookChain>();
+        if (!chain->Install(target, deferred)) return nullptr;
+
+        if (deferred) m_vPending.push_back(chain.get());
+        it = m_Chains.emplace(target, std::move(chain)).first;
+    }
+
+    it->second->refs++;
+    return it->second.get();
+}
+
+void HookChainRegistry::Release(HookChain* chain)
+{
+    if (!chain) return;
+
+    std::lock_guard lock(m_Mutex);
+
+    if (--chain->refs > 0) return;
+
+    m_vPending.erase(std::remove(m_vPending.begin(), m_vPending.end(), chain), m_vPending.end());
+    m_Chains.erase(chain->GetTarget());
+}
+
+HookListener* HookChainRegistry::AddListener(HookChain* chain, void* callback, int priority, const HookPredicateCondition* conditions, int count)
+{
+    if (!chain || !callback) return nullptr;
+
+    std::lock_guard lock(m_Mutex);
+
+    uint64_t id = ++m_uNextListenerID;
+    HookListener* listener = chain->Add(id, callback, priority, conditions, count);
+    if (!listener) return nullptr;
+
+    // every listener keeps its chain alive until it's removed
+    chain->refs++;
+    m_Listeners[id] = { chain, listener };
+    return listener;
+}
+
+uint64_t HookChainRegistry::AddListener(void* target, void* callback, int priority, const HookPredicateCondition* conditions, int count)
+{
+    if (!callback) return 0;
+
+    std::lock_guard lock(m_Mutex);
+
+    HookChain* chain = Acquire(target);
+    if (!chain) return 0;
+
+    HookListener* listener = AddListener(chain, callback, priority, conditions, count);
+    Release(chain);
+
+    return listener ? listener->id : 0;
+}
+
+void HookChainRegistry::RemoveListener(uint64_t id)
+{
+    std::lock_guard lock(m_Mutex);
+
+    auto it = m_Listeners.find(id);
+    if (it == m_Listeners.end()) return;
+
+    HookChain* chain = it->second.first;
+    m_Listeners.erase(it);
+
+    chain->Remove(id);
+    Release(chain);
+}
+
+void* HookChainRegistry::GetListenerNext(uint64_t id)
+{
+    std::lock_guard lock(m_Mutex);
+
+    auto it = m_Listeners.find(id);
+    if (it == m_Listeners.end()) return nullptr;
+
+    return it->second.second->next.Address();
+}
+
+void* HookChainRegistry::GetOriginal(void* target)
+{
+    std::lock_guard lock(m_Mutex);
+
+    auto it = m_Chains.find(target);
+    if (it == m_Chains.end()) return nullptr;
+
+    return it->second->GetOriginal();
+}
+
+void HookChainRegistry::SetName(void* target, const std::string& name)
+{
+    std::lock_guard lock(m_Mutex);
+
+    auto it = m_Chains.find(target);
+    if (it != m_Chains.end()) it->second->SetName(name);
+}
+
+void HookChainRegistry::SetListenerOwner(uint64_t id, const std::string& owner)
+{
+    std::lock_guard lock(m_Mutex);
+
+    auto it = m_Listeners.find(id);
+    if (it == m_Listeners.end()) return;
+
+    HookListener* listener = it->second.second;
+    listener->owner = owner;
+    g_HookStats.SetOwner(listener->stats, owner);
+}
+
+void HookChainRegistry::RelinkAll()
+{
+    std::lock_guard lock(m_Mutex);
+
+    for (auto& [target, chain] : m_Chains)
+        chain->Relink();
+}
+
+void HookChainRegistry::BeginTransaction()
+{
+    std::lock_guard lock(m_Mutex);
+    m_iTransactionDepth++;
+}
+
+void HookChainRegistry::CommitTransaction()
+{
+    std::lock_guard lock(m_Mutex);
+
+    if (m_iTransactionDepth == 0 || --m_iTransactionDepth > 0) return;
+    if (m_vPending.empty()) return;
+
+    // safetyhook makes the pages of all targets writable once and skips its per-hook protect / restore
+    // for patches that lie fully inside them while the chains get enabled.
+    std::vector<uint8_t*> targets;
+    targets.reserve(m_vPending.size());
+    for (HookChain* chain : m_vPending)
+        targets.push_back((uint8_t*)chain->GetTarget());
+
+    safetyhook::trap_threads_batch(targets, HOOKCHAIN_MAX_PATCH_SIZE, [this]()
+    {
+        for (HookChain* chain : m_vPending)
+            chain->Enable();
+    });
+
+    m_vPending.clear();
+}
@@ -0,0 +1,147 @@
+/************************************************************************************************
+ *  SwiftlyS2 is a scripting framework for Source2-based games.
+ *  Copyright (C) 2023-2026 Swiftly Solution SRL via Sava Andrei-Sebastian and it's contributors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ ************************************************************************************************/
+
+#ifndef src_memory_hooks_chain_h
+#define src_memory_hooks_chain_h
+
+#include <safetyhook/safetyhook.hpp>
+
+#include "predicate.h"
+#include "stats.h"
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// `jmp [slot]` thunk living in executable memory. Retargeting it is a single aligned
+// pointer store, so it can be rewired while other threads are jumping through it.
+class JumpStub
+{
+public:
+    bool Create(void* destination);
+
+    void Set(void* destination);
+    void* Address() const { return m_pCode; }
+
+private:
+    safetyhook::Allocation m_Allocation;
+    uint8_t* m_pCode = nullptr;
+    void** m_pSlot = nullptr;
+};
+
+struct HookListener
+{
+    uint64_t id;
+    int priority;
+    // the listener's entry, the predicate thunk in front of the callback when it has one
+    void* callback;
+    // where the callback forwards to: the next listener or the original function
+    JumpStub next;
+    std::unique_ptr<HookPredicate> predicate;
+
+    // created the first time hook stats are enabled
+    std::string owner;
+    HookStatsRecord* stats = nullptr;
+    std::unique_ptr<HookStatsThunk> statsThunk;
+};
+
+// One detour per target address. The detour lands on an entry stub that jumps into the
+// highest priority listener, every listener forwards through its own "next" stub and the
+// last one ends up in the original. Listeners have the target's signature, running code
+// before / after calling next, skipping it or returning something else is how they act
+// as pre / post hooks and override the call.
+// Adding or removing a listener only rewires the stubs, the target is patched once.
+class HookChain
+{
+public:
+    ~HookChain();
+
+    // a deferred chain is patched later through Enable, see HookChainRegistry::BeginTransaction
+    bool Install(void* target, bool deferred = false);
+    bool Enable();
+    void* GetTarget() { return m_pTarget; }
+
+    // what the target shows up as in the hook stats, its address unless a name is set
+    void SetName(const std::string& name) { m_sName = name; }
+
+    // with conditions the callback is only entered for calls passing all of them, others go straight to next
+    HookListener* Add(uint64_t id, void* callback, int priority, const HookPredicateCondition* conditions = nullptr, int count = 0);
+    bool Remove(uint64_t id);
+
+    void* GetOriginal();
+    size_t GetListenerCount() { return m_vListeners.size(); }
+
+    // while hook stats are enabled every listener and the original are entered through a timing thunk
+    void Relink();
+
+    uint32_t refs = 0;
+
+private:
+    void* StatsEntry(HookStatsRecord*& record, std::unique_ptr<HookStatsThunk>& thunk, const char* kind, const std::string& owner, void* destination);
+
+    void* m_pTarget = nullptr;
+    std::string m_sName;
+    HookStatsRecord* m_pOriginalStats = nullptr;
+    std::unique_ptr<HookStatsThunk> m_pOriginalStatsThunk;
+    SafetyHookInline m_oHook;
+    JumpStub m_Entry;
+
+    std::vector<std::unique_ptr<HookListener>> m_vListeners;
+    // a removed listener can still be on another thread's stack, its stub stays alive
+    // (and keeps forwarding) until the whole chain goes away
+    std::vector<std::unique_ptr<HookListener>> m_vRetired;
+};
+
+class HookChainRegistry
+{
+public:
+    HookChain* Acquire(void* target);
+    void Release(HookChain* chain);
+
+    uint64_t AddListener(void* target, void* callback, int priority, const HookPredicateCondition* conditions = nullptr, int count = 0);
+    HookListener* AddListener(HookChain* chain, void* callback, int priority, const HookPredicateCondition* conditions = nullptr, int count = 0);
+    void RemoveListener(uint64_t id);
+
+    void* GetListenerNext(uint64_t id);
+    void* GetOriginal(void* target);
+
+    void SetName(void* target, const std::string& name);
+    void SetListenerOwner(uint64_t id, const std::string& owner);
+    // links the stats thunks in or out of every chain after hook stats got switched on or off
+    void RelinkAll();
+
+    // Chains created inside a transaction are built but not patched in, the commit patches
+    // all of them in one go with their code pages made writable once. Transactions nest.
+    void BeginTransaction();
+    void CommitTransaction();
+
+private:
+    std::recursive_mutex m_Mutex;
+    int m_iTransactionDepth = 0;
+    std::vector<HookChain*> m_vPending;
+    std::unordered_map<void*, std::unique_ptr<HookChain>> m_Chains;
+    std::unordered_map<uint64_t, std::pair<HookChain*, HookListener*>> m_Listeners;
+    uint64_t m_uNextListenerID = 0;
+};
+
+extern HookChainRegistry g_HookChains;
+
+#endif
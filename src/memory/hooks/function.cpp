@@ -20,28 +20,43 @@
 
 #include <api/interfaces/manager.h>
 
+FunctionHook::~FunctionHook()
+{
+    Disable();
+    g_HookChains.Release(m_pChain);
+}
+
 void FunctionHook::Enable()
 {
-    if (IsEnabled()) return;
+    if (IsEnabled() || !m_pChain) return;
 
-    m_oHook.enable();
+    HookListener* listener = g_HookChains.AddListener(m_pChain, m_pCallback, 0);
+    if (!listener) return;
+
+    m_uListener = listener->id;
+    m_pNext = listener->next.Address();
 }
 
 void FunctionHook::Disable()
 {
     if (!IsEnabled()) return;
 
-    m_oHook.disable();
+    // m_pNext stays valid, a call that's still inside the callback forwards through it
+    g_HookChains.RemoveListener(m_uListener);
+    m_uListener = 0;
 }
 
 void* FunctionHook::GetOriginal()
 {
-    return (void*)(m_oHook.trampoline().address());
+    if (m_pNext) return m_pNext;
+    if (m_pChain) return m_pChain->GetOriginal();
+
+    return nullptr;
 }
 
 bool FunctionHook::IsEnabled()
 {
-    return m_oHook.enabled();
+    return m_uListener != 0;
 }
 
 void FunctionHook::SetHookFunction(const std::string& functionSignature, void* callback)
@@ -50,12 +65,18 @@ void FunctionHook::SetHookFunction(const std::string& functionSignature, void* c
     void* functionAddress = gamedata->GetSignatures()->Fetch(functionSignature);
     if (!functionAddress) return;
 
-    m_oHook = safetyhook::create_inline(functionAddress, callback, safetyhook::InlineHook::Flags::StartDisabled);
+    SetHookFunction(functionAddress, callback);
+    g_HookChains.SetName(functionAddress, functionSignature);
 }
 
 void FunctionHook::SetHookFunction(void* functionAddress, void* callback)
 {
     if (!functionAddress) return;
 
-    m_oHook = safetyhook::create_inline(functionAddress, callback, safetyhook::InlineHook::Flags::StartDisabled);
+    Disable();
+    g_HookChains.Release(m_pChain);
+
+    m_pChain = g_HookChains.Acquire(functionAddress);
+    m_pCallback = callback;
+    m_pNext = nullptr;
 }
\ No newline at end of file
@@ -20,11 +20,15 @@
 #define src_memory_hooks_function_h
 
 #include <api/memory/hooks/function.h>
-#include <safetyhook/safetyhook.hpp>
 
+#include "chain.h"
+
+// A listener on the shared detour of its target, see HookChain.
 class FunctionHook : public IFunctionHook
 {
 public:
+    virtual ~FunctionHook();
+
     virtual void SetHookFunction(const std::string& functionSignature, void* callback) override;
     virtual void SetHookFunction(void* functionAddress, void* callback) override;
 
@@ -35,7 +39,10 @@ public:
     virtual bool IsEnabled() override;
 
 private:
-    SafetyHookInline m_oHook;
+    HookChain* m_pChain = nullptr;
+    uint64_t m_uListener = 0;
+    void* m_pCallback = nullptr;
+    void* m_pNext = nullptr;
 };
 
 #endif
\ No newline at end of file
@@ -18,11 +18,16 @@
 
 #include "manager.h"
 
-#include <map>
+#include <algorithm>
+#include <cstring>
+#include <unordered_map>
 #include <vector>
 
+#include <api/interfaces/manager.h>
 #include <api/shared/string.h>
 
+#include <fmt/format.h>
+
 IFunctionHook* HooksManager::CreateFunctionHook()
 {
     return new FunctionHook();
@@ -53,8 +58,100 @@ void HooksManager::DestroyMFunctionHook(IMFunctionHook* hook)
     delete (MFunctionHook*)hook;
 }
 
+uint64_t HooksManager::AddHookListener(void* target, void* callback, int priority)
+{
+    return g_HookChains.AddListener(target, callback, priority);
+}
+
+uint64_t HooksManager::AddHookListenerFiltered(void* target, void* callback, int priority, const HookPredicateCondition* conditions, int count)
+{
+    if (!HookPredicate::Validate(conditions, count))
+    {
+        auto logger = g_ifaceService.FetchInterface<ILogger>(LOGGER_INTERFACE_VERSION);
+        logger->Error("Hooks", fmt::format("Couldn't hook {}, the predicate is invalid. Every condition needs an argument below 16, a known compare op and a size of 1, 2, 4 or 8 bytes.\n", target));
+        return 0;
+    }
+
+    return g_HookChains.AddListener(target, callback, priority, conditions, count);
+}
+
+void HooksManager::RemoveHookListener(uint64_t id)
+{
+    g_HookChains.RemoveListener(id);
+}
+
+void* HooksManager::GetHookListenerNext(uint64_t id)
+{
+    return g_HookChains.GetListenerNext(id);
+}
+
+void* HooksManager::GetHookChainOriginal(void* target)
+{
+    return g_HookChains.GetOriginal(target);
+}
+
+void HooksManager::BeginHookTransaction()
+{
+    g_HookChains.BeginTransaction();
+}
+
+void HooksManager::CommitHookTransaction()
+{
+    g_HookChains.CommitTransaction();
+}
+
+void HooksManager::EnableHookStats(bool enable)
+{
+    g_HookStats.SetEnabled(enable);
+    g_HookChains.RelinkAll();
+}
+
+bool HooksManager::IsHookStatsEnabled()
+{
+    return g_HookStats.IsEnabled();
+}
+
+void HooksManager::ResetHookStats()
+{
+    g_HookStats.Reset();
+}
+
+std::string HooksManager::GetHookStatsReport()
+{
+    return g_HookStats.GetReport();
+}
+
+void HooksManager::SetHookListenerOwner(uint64_t id, const std::string& owner)
+{
+    g_HookChains.SetListenerOwner(id, owner);
+}
+
 IFunctionHook* g_pFireOutputHook = nullptr;
-std::map<uint64_t, std::map<uint64_t, void*>> outputHooksList;
+
+constexpr uint32_t OUTPUT_WILDCARD_HASH = hash_32_fnv1a_const("*");
+
+struct OutputHookEntry
+{
+    uint64_t id;
+    void* callback;
+
+    // filtered hooks, INVALID_EHANDLE_INDEX / wildcard hash means any
+    bool filtered = false;
+    uint32_t activatorHandle = INVALID_EHANDLE_INDEX;
+    uint32_t activatorClassHash = OUTPUT_WILDCARD_HASH;
+
+    HookStatsRecord* stats = nullptr;
+};
+
+// (classname hash << 32 | output hash) -> callbacks in registration order
+// dispatch only ever uses find(), the fire path doesn't allocate
+std::unordered_map<uint64_t, std::vector<OutputHookEntry>> g_OutputHooks;
+// (caller handle << 32 | output hash) -> callbacks scoped to a single entity
+std::unordered_map<uint64_t, std::vector<OutputHookEntry>> g_OutputEntityHooks;
+uint64_t g_uOutputHookCount = 0;
+uint64_t g_uOutputListenerID = 0;
+int g_iOutputDispatchDepth = 0;
+bool g_bOutputHooksDirty = false;
 
 void CEntityIOOutput_FireOutputInternal_Hook(CEntityIOOutput* pThis, CEntityInstance* pActivator, CEntityInstance* pCaller, void* variantValue, float delay, void* unk01, void* unk02);
 
@@ -72,62 +169,200 @@ void HooksManager::Shutdown()
     g_pFireOutputHook = nullptr;
 }
 
-void CEntityIOOutput_FireOutputInternal_Hook(CEntityIOOutput* pThis, CEntityInstance* pActivator, CEntityInstance* pCaller, void* variantValue, float delay, void* unk01, void* unk02)
+static inline uint64_t OutputHookKey(uint32_t classHash, uint32_t outputHash)
 {
-    const char* outputName = pThis->m_pDesc->m_pName;
-    const char* callerClassName = pCaller ? pCaller->GetClassname() : "(null)";
-    std::vector searchOutputs{ ((uint64_t)hash_32_fnv1a_const("*") << 32 | hash_32_fnv1a_const(outputName)), ((uint64_t)hash_32_fnv1a_const("*") << 32 | hash_32_fnv1a_const("*")) };
+    return ((uint64_t)classHash << 32) | outputHash;
+}
 
-    if (pCaller)
+static void CompactOutputHooks(std::unordered_map<uint64_t, std::vector<OutputHookEntry>>& hooks)
+{
+    for (auto it = hooks.begin(); it != hooks.end();)
+    {
+        auto& entries = it->second;
+        entries.erase(std::remove_if(entries.begin(), entries.end(), [](const OutputHookEntry& entry) { return entry.callback == nullptr; }), entries.end());
+
+        if (entries.empty()) it = hooks.erase(it);
+        else ++it;
+    }
+}
+
+static void CompactOutputHooks()
+{
+    CompactOutputHooks(g_OutputHooks);
+    CompactOutputHooks(g_OutputEntityHooks);
+    g_bOutputHooksDirty = false;
+}
+
+struct OutputFireContext
+{
+    CEntityIOOutput* pThis;
+    const char* outputName;
+    CEntityInstance* pActivator;
+    CEntityInstance* pCaller;
+    void* variantValue;
+    float delay;
+
+    // resolved on first use, most fires never reach a filtered hook
+    bool activatorResolved = false;
+    uint32_t activatorHandle = INVALID_EHANDLE_INDEX;
+    uint32_t activatorClassHash = 0;
+
+    void ResolveActivator()
     {
-        uint64_t classHash = hash_32_fnv1a_const(callerClassName);
-        uint64_t outputHash = hash_32_fnv1a_const(outputName);
-        uint64_t combinedHash = (classHash << 32) | outputHash;
-        searchOutputs.push_back(combinedHash);
-        searchOutputs.push_back(((uint64_t)hash_32_fnv1a_const(callerClassName) << 32 | hash_32_fnv1a_const("*")));
+        if (activatorResolved) return;
+        activatorResolved = true;
+
+        if (!pActivator) return;
+
+        activatorHandle = pActivator->GetRefEHandle().ToInt();
+        const char* className = pActivator->GetClassname();
+        activatorClassHash = hash_32_fnv1a(className, strlen(className));
     }
+};
 
-    for (auto& output : searchOutputs)
+static bool MatchesOutputFilter(const OutputHookEntry& entry, OutputFireContext& ctx)
+{
+    if (entry.activatorHandle == INVALID_EHANDLE_INDEX && entry.activatorClassHash == OUTPUT_WILDCARD_HASH) return true;
+
+    ctx.ResolveActivator();
+    if (entry.activatorHandle != INVALID_EHANDLE_INDEX && entry.activatorHandle != ctx.activatorHandle) return false;
+    if (entry.activatorClassHash != OUTPUT_WILDCARD_HASH && (!ctx.pActivator || entry.activatorClassHash != ctx.activatorClassHash)) return false;
+
+    return true;
+}
+
+// 0 = continue, 1 = stop everything (original included), 2 = skip the remaining hooks
+static int DispatchOutputHooks(std::unordered_map<uint64_t, std::vector<OutputHookEntry>>& hooks, uint64_t key, OutputFireContext& ctx)
+{
+    auto it = hooks.find(key);
+    if (it == hooks.end()) return 0;
+
+    // indexed on purpose, callbacks are allowed to hook or unhook outputs while we're iterating
+    auto& entries = it->second;
+    for (size_t i = 0; i < entries.size(); i++)
     {
-        bool shouldStop = false;
-        for (auto& hook : outputHooksList[output])
+        OutputHookEntry& entry = entries[i];
+        if (!entry.callback) continue;
+
+        // filters are checked here so the managed side never sees outputs it would ignore
+        if (entry.filtered && !MatchesOutputFilter(entry, ctx)) continue;
+
+        HookStatsScope stats(entry.stats, "output", [&]() { return fmt::format("{} #{}", ctx.outputName, entry.id); });
+
+        int result;
+        if (entry.filtered)
         {
-            int result = reinterpret_cast<int (*)(CEntityIOOutput*, const char*, CEntityInstance*, CEntityInstance*, float)>(hook.second)(pThis, outputName, pActivator, pCaller, delay);
-            if (result == 1)
-            {
-                return;
-            }
-            else if (result == 2)
-            {
-                shouldStop = true;
-                break;
-            }
+            result = reinterpret_cast<int (*)(CEntityIOOutput*, const char*, CEntityInstance*, CEntityInstance*, void*, float)>(entry.callback)(ctx.pThis, ctx.outputName, ctx.pActivator, ctx.pCaller, ctx.variantValue, ctx.delay);
         }
-        if (shouldStop)
+        else
+        {
+            result = reinterpret_cast<int (*)(CEntityIOOutput*, const char*, CEntityInstance*, CEntityInstance*, float)>(entry.callback)(ctx.pThis, ctx.outputName, ctx.pActivator, ctx.pCaller, ctx.delay);
+        }
+
+        if (result == 1 || result == 2) return result;
+    }
+
+    return 0;
+}
+
+void CEntityIOOutput_FireOutputInternal_Hook(CEntityIOOutput* pThis, CEntityInstance* pActivator, CEntityInstance* pCaller, void* variantValue, float delay, void* unk01, void* unk02)
+{
+    if (g_uOutputHookCount == 0)
+        return reinterpret_cast<decltype(&CEntityIOOutput_FireOutputInternal_Hook)>(g_pFireOutputHook->GetOriginal())(pThis, pActivator, pCaller, variantValue, delay, unk01, unk02);
+
+    const char* outputName = pThis->m_pDesc->m_pName;
+    uint32_t outputHash = hash_32_fnv1a(outputName, strlen(outputName));
+
+    // same lookup order as always: *.output, *.*, class.output, class.*, then the entity scoped ones
+    uint64_t keys[4];
+    int keyCount = 0;
+    keys[keyCount++] = OutputHookKey(OUTPUT_WILDCARD_HASH, outputHash);
+    keys[keyCount++] = OutputHookKey(OUTPUT_WILDCARD_HASH, OUTPUT_WILDCARD_HASH);
+
+    uint64_t entityKeys[2];
+    int entityKeyCount = 0;
+
+    if (pCaller)
+    {
+        const char* callerClassName = pCaller->GetClassname();
+        uint32_t classHash = hash_32_fnv1a(callerClassName, strlen(callerClassName));
+        keys[keyCount++] = OutputHookKey(classHash, outputHash);
+        keys[keyCount++] = OutputHookKey(classHash, OUTPUT_WILDCARD_HASH);
+
+        if (!g_OutputEntityHooks.empty())
         {
-            break;
+            uint32_t callerHandle = pCaller->GetRefEHandle().ToInt();
+            entityKeys[entityKeyCount++] = OutputHookKey(callerHandle, outputHash);
+            entityKeys[entityKeyCount++] = OutputHookKey(callerHandle, OUTPUT_WILDCARD_HASH);
         }
     }
 
+    OutputFireContext ctx{ pThis, outputName, pActivator, pCaller, variantValue, delay };
+
+    int result = 0;
+    g_iOutputDispatchDepth++;
+    for (int i = 0; i < keyCount && result == 0; i++)
+        result = DispatchOutputHooks(g_OutputHooks, keys[i], ctx);
+    for (int i = 0; i < entityKeyCount && result == 0; i++)
+        result = DispatchOutputHooks(g_OutputEntityHooks, entityKeys[i], ctx);
+    g_iOutputDispatchDepth--;
+
+    if (g_iOutputDispatchDepth == 0 && g_bOutputHooksDirty)
+        CompactOutputHooks();
+
+    if (result == 1) return;
+
     reinterpret_cast<decltype(&CEntityIOOutput_FireOutputInternal_Hook)>(g_pFireOutputHook->GetOriginal())(pThis, pActivator, pCaller, variantValue, delay, unk01, unk02);
 }
 
 uint64_t HooksManager::CreateEntityHookOutput(const std::string& className, const std::string& outputName, void* callback)
 {
-    static uint64_t listenerID = 0;
-    uint64_t outputHash = ((uint64_t)hash_32_fnv1a_const(className.c_str()) << 32 | hash_32_fnv1a_const(outputName.c_str()));
-    outputHooksList[outputHash][++listenerID] = callback;
-    return listenerID;
+    uint64_t key = OutputHookKey(hash_32_fnv1a(className.c_str(), className.size()), hash_32_fnv1a(outputName.c_str(), outputName.size()));
+    g_OutputHooks[key].push_back({ ++g_uOutputListenerID, callback });
+    g_uOutputHookCount++;
+    return g_uOutputListenerID;
 }
 
-void HooksManager::DestroyEntityHookOutput(uint64_t id)
+uint64_t HooksManager::CreateEntityHookOutputFiltered(const std::string& className, const std::string& outputName, uint32_t callerHandle, uint32_t activatorHandle, const std::string& activatorClassName, void* callback)
+{
+    uint32_t outputHash = hash_32_fnv1a(outputName.c_str(), outputName.size());
+
+    OutputHookEntry entry{ ++g_uOutputListenerID, callback };
+    entry.filtered = true;
+    entry.activatorHandle = activatorHandle;
+    entry.activatorClassHash = activatorClassName.empty() ? OUTPUT_WILDCARD_HASH : hash_32_fnv1a(activatorClassName.c_str(), activatorClassName.size());
+
+    // a caller handle already pins the class, those go in their own index so a hook on
+    // one trigger doesn't get looked at when any of the other hundreds fire
+    if (callerHandle != INVALID_EHANDLE_INDEX) g_OutputEntityHooks[OutputHookKey(callerHandle, outputHash)].push_back(entry);
+    else g_OutputHooks[OutputHookKey(hash_32_fnv1a(className.c_str(), className.size()), outputHash)].push_back(entry);
+
+    g_uOutputHookCount++;
+    return g_uOutputListenerID;
+}
+
+static bool RemoveOutputHook(std::unordered_map<uint64_t, std::vector<OutputHookEntry>>& hooks, uint64_t id)
 {
-    for (auto& output : outputHooksList)
+    for (auto& [key, entries] : hooks)
     {
-        auto it = output.second.find(id);
-        if (it != output.second.end())
+        for (auto& entry : entries)
         {
-            output.second.erase(it);
+            if (entry.id != id || !entry.callback) continue;
+
+            // removal is deferred while an output is being dispatched so indices stay valid
+            entry.callback = nullptr;
+            g_HookStats.Release(entry.stats);
+            g_uOutputHookCount--;
+            g_bOutputHooksDirty = true;
+            return true;
         }
     }
+    return false;
+}
+
+void HooksManager::DestroyEntityHookOutput(uint64_t id)
+{
+    if (!RemoveOutputHook(g_OutputHooks, id) && !RemoveOutputHook(g_OutputEntityHooks, id)) return;
+
+    if (g_iOutputDispatchDepth == 0) CompactOutputHooks();
 }
@@ -22,6 +22,7 @@
 #include <api/memory/hooks/manager.h>
 #include <vector>
 
+#include "chain.h"
 #include "function.h"
 #include "mfunction.h"
 #include "vfunction.h"
@@ -44,8 +45,34 @@ public:
     virtual void DestroyVFunctionHook(IVFunctionHook* hook) override;
     virtual void DestroyMFunctionHook(IMFunctionHook* hook) override;
 
+    // Listeners share a single detour per target and run by priority (higher first, then registration order).
+    // The callback has the target's signature and continues the call through GetHookListenerNext(id).
+    virtual uint64_t AddHookListener(void* target, void* callback, int priority) override;
+    // Same as AddHookListener, the callback is only entered for calls whose arguments pass every condition.
+    // Other calls jump straight to the next listener without leaving native code.
+    virtual uint64_t AddHookListenerFiltered(void* target, void* callback, int priority, const HookPredicateCondition* conditions, int count) override;
+    virtual void RemoveHookListener(uint64_t id) override;
+    virtual void* GetHookListenerNext(uint64_t id) override;
+    virtual void* GetHookChainOriginal(void* target) override;
+
+    // Hooks created until the matching commit are patched in together when it's called. Transactions nest.
+    virtual void BeginHookTransaction() override;
+    virtual void CommitHookTransaction() override;
+
+    // Call counts and rdtsc timings for detour listeners, entity output, net message and game event hooks.
+    // Nothing is measured (and the detours run without the timing thunks) while disabled.
+    virtual void EnableHookStats(bool enable) override;
+    virtual bool IsHookStatsEnabled() override;
+    virtual void ResetHookStats() override;
+    virtual std::string GetHookStatsReport() override;
+    // shown next to the listener's stats, plugins use their name
+    virtual void SetHookListenerOwner(uint64_t id, const std::string& owner) override;
+
     // ptr CEntityIOOutput, string outputName, ptr activator, ptr caller, float delay -> int (HookResult)
     virtual uint64_t CreateEntityHookOutput(const std::string& className, const std::string& outputName, void* callback) override;
+    // ptr CEntityIOOutput, string outputName, ptr activator, ptr caller, ptr variant, float delay -> int (HookResult)
+    // callerHandle / activatorHandle = INVALID_EHANDLE_INDEX and an empty activatorClassName mean any, a caller handle takes precedence over className
+    virtual uint64_t CreateEntityHookOutputFiltered(const std::string& className, const std::string& outputName, uint32_t callerHandle, uint32_t activatorHandle, const std::string& activatorClassName, void* callback) override;
     virtual void DestroyEntityHookOutput(uint64_t id) override;
 };
 
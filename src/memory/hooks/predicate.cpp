@@ -0,0 +1,117 @@
+/************************************************************************************************
+ *  SwiftlyS2 is a scripting framework for Source2-based games.
+ *  Copyright (C) 2023-2026 Swiftly Solution SRL via Sava Andrei-Sebastian and it's contributors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ ************************************************************************************************/
+
+#include "predicate.h"
+#include "thunk.h"
+
+#include <cstring>
+
+#define PREDICATE_MAX_ARGS 16
+
+static int64_t LoadValue(const uint8_t* address, int32_t size)
+{
+    switch (size)
+    {
+    case 1: return *(const int8_t*)address;
+    case 2: { int16_t v; memcpy(&v, address, sizeof(v)); return v; }
+    case 4: { int32_t v; memcpy(&v, address, sizeof(v)); return v; }
+    default: { int64_t v; memcpy(&v, address, sizeof(v)); return v; }
+    }
+}
+
+bool HookPredicate::Validate(const HookPredicateCondition* conditions, int count)
+{
+    if (!conditions || count <= 0) return false;
+
+    for (int i = 0; i < count; i++)
+    {
+        auto& condition = conditions[i];
+        if (condition.argument < 0 || condition.argument >= PREDICATE_MAX_ARGS) return false;
+        if (condition.op < HookPredicateOp::Equal || condition.op > HookPredicateOp::NoBits) return false;
+        if (condition.size != 1 && condition.size != 2 && condition.size != 4 && condition.size != 8) return false;
+    }
+
+    return true;
+}
+
+bool HookPredicate::Create(const HookPredicateCondition* conditions, int count, void* pass, void* skip)
+{
+    if (!Validate(conditions, count)) return false;
+
+    m_vConditions.assign(conditions, conditions + count);
+
+    ThunkWriter writer;
+
+    writer.EmitSaveArguments();
+    writer.EmitLoadArgument(0, this);
+    writer.EmitLoadSavedRegisters();
+    writer.EmitLoadFrame(2, THUNK_STACK_ARGUMENTS);
+    writer.EmitCall((void*)&HookPredicate::Evaluate);
+    // movzx r11d, al
+    writer.Emit({ 0x44, 0x0F, 0xB6, 0xD8 });
+    writer.EmitRestoreArguments();
+
+    // test r11d, r11d; jz skip; jmp [pass]; skip: jmp [skip]
+    writer.Emit({ 0x45, 0x85, 0xDB, 0x74, 0x06 });
+    writer.EmitJump(0);
+    writer.EmitJump(1);
+
+    void* slots[2] = { pass, skip };
+    if (!writer.Finish(m_Allocation, slots, 2)) return false;
+
+    m_pCode = m_Allocation.data();
+    return true;
+}
+
+bool HookPredicate::Evaluate(const HookPredicate* predicate, const uint64_t* registers, const uint64_t* stack)
+{
+    for (auto& condition : predicate->m_vConditions)
+    {
+        uint64_t argument = condition.argument < THUNK_REGISTER_ARGUMENTS ? registers[condition.argument] : stack[condition.argument - THUNK_REGISTER_ARGUMENTS];
+
+        int64_t value;
+        if (condition.offset >= 0)
+        {
+            if (!argument) return false;
+            value = LoadValue((const uint8_t*)argument + condition.offset, condition.size);
+        }
+        else
+        {
+            value = LoadValue((const uint8_t*)&argument, condition.size);
+        }
+
+        uint64_t bits = (uint64_t)value & (condition.size == 8 ? ~0ull : (1ull << (condition.size * 8)) - 1);
+
+        bool result = false;
+        switch (condition.op)
+        {
+        case HookPredicateOp::Equal: result = value == condition.value; break;
+        case HookPredicateOp::NotEqual: result = value != condition.value; break;
+        case HookPredicateOp::Less: result = value < condition.value; break;
+        case HookPredicateOp::LessOrEqual: result = value <= condition.value; break;
+        case HookPredicateOp::Greater: result = value > condition.value; break;
+        case HookPredicateOp::GreaterOrEqual: result = value >= condition.value; break;
+        case HookPredicateOp::AnyBits: result = (bits & (uint64_t)condition.value) != 0; break;
+        case HookPredicateOp::NoBits: result = (bits & (uint64_t)condition.value) == 0; break;
+        }
+
+        if (!result) return false;
+    }
+
+    return true;
+}
@@ -0,0 +1,49 @@
+/************************************************************************************************
+ *  SwiftlyS2 is a scripting framework for Source2-based games.
+ *  Copyright (C) 2023-2026 Swiftly Solution SRL via Sava Andrei-Sebastian and it's contributors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ ************************************************************************************************/
+
+#ifndef src_memory_hooks_predicate_h
+#define src_memory_hooks_predicate_h
+
+#include <api/memory/hooks/predicate.h>
+
+#include <safetyhook/safetyhook.hpp>
+
+#include <cstdint>
+#include <vector>
+
+// Native prefilter in front of a hook listener. The thunk saves the argument registers, runs the
+// conditions over them and then jumps, with every register and the stack as they were on entry,
+// either into the listener's callback or straight into its "next" stub. Calls that don't match
+// never leave native code.
+class HookPredicate
+{
+public:
+    bool Create(const HookPredicateCondition* conditions, int count, void* pass, void* skip);
+    void* Address() const { return m_pCode; }
+
+    static bool Validate(const HookPredicateCondition* conditions, int count);
+
+private:
+    static bool Evaluate(const HookPredicate* predicate, const uint64_t* registers, const uint64_t* stack);
+
+    std::vector<HookPredicateCondition> m_vConditions;
+    safetyhook::Allocation m_Allocation;
+    uint8_t* m_pCode = nullptr;
+};
+
+#endif
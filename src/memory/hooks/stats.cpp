@@ -0,0 +1,350 @@
+/************************************************************************************************
+ *  SwiftlyS2 is a scripting framework for Source2-based games.
+ *  Copyright (C) 2023-2026 Swiftly Solution SRL via Sava Andrei-Sebastian and it's contributors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ ************************************************************************************************/
+
+#include "stats.h"
+#include "thunk.h"
+
+#include <api/shared/texttable.h>
+
+#include <algorithm>
+#include <chrono>
+
+#include <fmt/format.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+
+#define HOOK_STATS_MAX_DEPTH 128
+// stack argument slots a timed detour passes on, past the ones in registers
+#define HOOK_STATS_STACK_ARGUMENTS 32
+
+HookStats g_HookStats;
+
+struct HookStatsFrame
+{
+    HookStatsRecord* record;
+    const void* frame;
+    uint64_t start;
+    uint64_t children;
+};
+
+static thread_local HookStatsFrame t_Frames[HOOK_STATS_MAX_DEPTH];
+static thread_local int t_iDepth = 0;
+
+static int64_t SteadyMicroseconds()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// The stack grows down, a frame still on it sits above every call it made. Anything at or below
+// `frame` was left without an Exit, skipped by an exception or a longjmp.
+static void DropSkippedFrames(const void* frame)
+{
+    while (t_iDepth > 0 && t_Frames[t_iDepth - 1].frame < frame)
+        t_iDepth--;
+}
+
+void HookStats::Enter(HookStatsRecord* record, const void* frame)
+{
+    record->calls.fetch_add(1, std::memory_order_relaxed);
+
+    DropSkippedFrames((const uint8_t*)frame + 1);
+    // too deep to track, the call is counted but not timed
+    if (t_iDepth >= HOOK_STATS_MAX_DEPTH) return;
+
+    t_Frames[t_iDepth++] = { record, frame, __rdtsc(), 0 };
+}
+
+void HookStats::Exit(const void* frame)
+{
+    uint64_t now = __rdtsc();
+
+    DropSkippedFrames(frame);
+    if (t_iDepth == 0 || t_Frames[t_iDepth - 1].frame != frame) return;
+
+    HookStatsFrame& current = t_Frames[--t_iDepth];
+
+    uint64_t elapsed = now - current.start;
+    uint64_t self = elapsed > current.children ? elapsed - current.children : 0;
+    if (t_iDepth > 0) t_Frames[t_iDepth - 1].children += elapsed;
+
+    HookStatsRecord* record = current.record;
+    record->cycles.fetch_add(self, std::memory_order_relaxed);
+
+    uint64_t max = record->maxCycles.load(std::memory_order_relaxed);
+    while (self > max && !record->maxCycles.compare_exchange_weak(max, self, std::memory_order_relaxed));
+}
+
+HookStatsRecord* HookStats::Register(const std::string& kind, const std::string& name)
+{
+    std::lock_guard lock(m_Mutex);
+
+    std::string key = kind + '\n' + name;
+    auto [begin, end] = m_Index.equal_range(key);
+    for (auto it = begin; it != end; ++it)
+    {
+        if (it->second->refs == 0)
+        {
+            it->second->refs++;
+            return it->second;
+        }
+    }
+
+    auto record = std::make_unique<HookStatsRecord>();
+    record->kind = kind;
+    record->name = name;
+    record->refs = 1;
+
+    m_Index.emplace(std::move(key), record.get());
+    return m_vRecords.emplace_back(std::move(record)).get();
+}
+
+void HookStats::Release(HookStatsRecord* record)
+{
+    if (!record) return;
+
+    std::lock_guard lock(m_Mutex);
+    if (record->refs > 0) record->refs--;
+}
+
+void HookStats::SetOwner(HookStatsRecord* record, const std::string& owner)
+{
+    if (!record) return;
+
+    std::lock_guard lock(m_Mutex);
+    record->owner = owner;
+}
+
+void HookStats::SetEnabled(bool enabled)
+{
+    std::lock_guard lock(m_Mutex);
+
+    if (enabled && !m_bEnabled.load() && m_iCalibrationTime == 0)
+    {
+        m_uCalibrationCycles = __rdtsc();
+        m_iCalibrationTime = SteadyMicroseconds();
+    }
+
+    m_bEnabled.store(enabled);
+}
+
+void HookStats::Reset()
+{
+    std::lock_guard lock(m_Mutex);
+
+    for (auto& record : m_vRecords)
+    {
+        record->calls.store(0, std::memory_order_relaxed);
+        record->cycles.store(0, std::memory_order_relaxed);
+        record->maxCycles.store(0, std::memory_order_relaxed);
+    }
+}
+
+std::string HookStats::GetReport()
+{
+    std::lock_guard lock(m_Mutex);
+
+    // the tsc rate is measured against the steady clock over the time since stats were first enabled
+    double cyclesPerUs = 0.0;
+    if (m_iCalibrationTime != 0)
+    {
+        int64_t elapsed = SteadyMicroseconds() - m_iCalibrationTime;
+        if (elapsed >= 1000) cyclesPerUs = (double)(__rdtsc() - m_uCalibrationCycles) / (double)elapsed;
+    }
+
+    auto formatCycles = [cyclesPerUs](uint64_t cycles, double scale) {
+        if (cyclesPerUs <= 0.0) return fmt::format(" {} cycles ", cycles);
+        return fmt::format(" {:.3f} ", (double)cycles / cyclesPerUs / scale);
+        };
+
+    std::vector<HookStatsRecord*> records;
+    for (auto& record : m_vRecords)
+        if (record->calls.load(std::memory_order_relaxed) > 0) records.push_back(record.get());
+
+    std::sort(records.begin(), records.end(), [](HookStatsRecord* a, HookStatsRecord* b) { return a->cycles.load(std::memory_order_relaxed) > b->cycles.load(std::memory_order_relaxed); });
+
+    std::string report = fmt::format("Hook stats are {}, {} hooks recorded calls.\n", m_bEnabled.load() ? "enabled" : "disabled", records.size());
+    if (records.empty()) return report;
+
+    TextTable table('-', '|', '+');
+    table.add(" Kind ");
+    table.add(" Hook ");
+    table.add(" Owner ");
+    table.add(" Calls ");
+    table.add(" Total (ms) ");
+    table.add(" Avg (us) ");
+    table.add(" Max (us) ");
+    table.endOfRow();
+
+    for (auto record : records)
+    {
+        uint64_t calls = record->calls.load(std::memory_order_relaxed);
+        uint64_t cycles = record->cycles.load(std::memory_order_relaxed);
+
+        table.add(fmt::format(" {} ", record->kind));
+        table.add(fmt::format(" {} ", record->name));
+        table.add(fmt::format(" {} ", record->owner.empty() ? "-" : record->owner));
+        table.add(fmt::format(" {} ", calls));
+        table.add(formatCycles(cycles, 1000.0));
+        table.add(formatCycles(cycles / calls, 1.0));
+        table.add(formatCycles(record->maxCycles.load(std::memory_order_relaxed), 1.0));
+        table.endOfRow();
+    }
+
+    report += TableToString(table);
+    return report;
+}
+
+#ifdef _WIN32
+struct HookStatsUnwind
+{
+    RUNTIME_FUNCTION function;
+};
+#else
+extern "C" void __register_frame(void* begin);
+extern "C" void __deregister_frame(void* begin);
+
+struct HookStatsUnwind
+{
+    std::vector<uint8_t> ehFrame;
+};
+
+// .eh_frame for code starting with push rbp; mov rbp, rsp and keeping that frame until it returns:
+// one CIE, one FDE and the terminator
+static std::vector<uint8_t> BuildEhFrame(const uint8_t* code, size_t size)
+{
+    std::vector<uint8_t> out;
+    auto put = [&out](uint64_t value, int bytes) {
+        for (int i = 0; i < bytes; i++)
+            out.push_back((uint8_t)(value >> (i * 8)));
+        };
+
+    // CIE: version 1, "zR", code align 1, data align -8, return address in r16, absolute pointers,
+    // cfa = rsp + 8 with the return address at cfa - 8
+    put(20, 4);
+    put(0, 4);
+    out.insert(out.end(), { 0x01, 'z', 'R', 0x00, 0x01, 0x78, 0x10, 0x01, 0x00, 0x0C, 0x07, 0x08, 0x90, 0x01, 0x00, 0x00 });
+
+    // FDE: after push rbp cfa = rsp + 16 with rbp at cfa - 16, after mov rbp, rsp cfa = rbp + 16
+    put(36, 4);
+    put(out.size(), 4);
+    put((uint64_t)code, 8);
+    put(size, 8);
+    out.insert(out.end(), { 0x00, 0x41, 0x0E, 0x10, 0x86, 0x02, 0x43, 0x0D, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 });
+
+    put(0, 4);
+    return out;
+}
+#endif
+
+HookStatsThunk::HookStatsThunk() = default;
+
+HookStatsThunk::~HookStatsThunk()
+{
+    if (!m_pUnwind) return;
+
+#ifdef _WIN32
+    RtlDeleteFunctionTable(&m_pUnwind->function);
+#else
+    __deregister_frame(m_pUnwind->ehFrame.data());
+#endif
+}
+
+bool HookStatsThunk::Create(HookStatsRecord* record, void* destination)
+{
+#ifdef _WIN32
+    // shadow space for the destination followed by the stack argument copies
+    const int32_t reserve = 0x20 + HOOK_STATS_STACK_ARGUMENTS * 8;
+    const int32_t copyAt = -reserve + 0x20;
+#else
+    const int32_t reserve = HOOK_STATS_STACK_ARGUMENTS * 8;
+    const int32_t copyAt = -reserve;
+#endif
+
+    ThunkWriter writer;
+    auto emitDisp32 = [&writer](int32_t disp) {
+        writer.Emit({ (uint8_t)disp, (uint8_t)(disp >> 8), (uint8_t)(disp >> 16), (uint8_t)(disp >> 24) });
+        };
+
+    writer.EmitSaveArguments();
+    writer.EmitLoadArgument(0, record);
+    writer.EmitLoadFrame(1, 0);
+    writer.EmitCall((void*)&HookStats::Enter);
+    writer.EmitRestoreArguments(true);
+
+    // sub rsp, imm32; then mov r11, [rbp + stack argument i]; mov [rbp + copyAt + i * 8], r11
+    // the destination reads its stack arguments from the copies, whatever it takes
+    writer.Emit({ 0x48, 0x81, 0xEC });
+    emitDisp32(reserve);
+    for (int32_t i = 0; i < HOOK_STATS_STACK_ARGUMENTS; i++)
+    {
+        writer.Emit({ 0x4C, 0x8B, 0x9D });
+        emitDisp32(THUNK_STACK_ARGUMENTS + i * 8);
+        writer.Emit({ 0x4C, 0x89, 0x9D });
+        emitDisp32(copyAt + i * 8);
+    }
+    writer.EmitCallSlot(0);
+
+#ifdef _WIN32
+    // push rax; push rdx; sub rsp, 0x30; movdqu [rsp + 0x20], xmm0; mov rcx, rbp
+    writer.Emit({ 0x50, 0x52, 0x48, 0x83, 0xEC, 0x30 });
+    writer.Emit({ 0xF3, 0x0F, 0x7F, 0x44, 0x24, 0x20 });
+    writer.Emit({ 0x48, 0x89, 0xE9 });
+    writer.EmitCall((void*)&HookStats::Exit);
+    // movdqu xmm0, [rsp + 0x20]; add rsp, 0x30; pop rdx; pop rax; leave; ret
+    writer.Emit({ 0xF3, 0x0F, 0x6F, 0x44, 0x24, 0x20 });
+    writer.Emit({ 0x48, 0x83, 0xC4, 0x30, 0x5A, 0x58, 0xC9, 0xC3 });
+#else
+    // push rax; push rdx; sub rsp, 0x20; movdqu [rsp], xmm0; movdqu [rsp + 0x10], xmm1; mov rdi, rbp
+    writer.Emit({ 0x50, 0x52, 0x48, 0x83, 0xEC, 0x20 });
+    writer.Emit({ 0xF3, 0x0F, 0x7F, 0x44, 0x24, 0x00, 0xF3, 0x0F, 0x7F, 0x4C, 0x24, 0x10 });
+    writer.Emit({ 0x48, 0x89, 0xEF });
+    writer.EmitCall((void*)&HookStats::Exit);
+    // movdqu xmm0, [rsp]; movdqu xmm1, [rsp + 0x10]; add rsp, 0x20; pop rdx; pop rax; leave; ret
+    writer.Emit({ 0xF3, 0x0F, 0x6F, 0x44, 0x24, 0x00, 0xF3, 0x0F, 0x6F, 0x4C, 0x24, 0x10 });
+    writer.Emit({ 0x48, 0x83, 0xC4, 0x20, 0x5A, 0x58, 0xC9, 0xC3 });
+#endif
+
+    size_t codeSize = writer.Size();
+    auto unwind = std::make_unique<HookStatsUnwind>();
+
+#ifdef _WIN32
+    // UNWIND_INFO: version 1, 4 byte prolog, rbp frame; UWOP_SET_FPREG at 4, UWOP_PUSH_NONVOL rbp at 1
+    while (writer.Size() % 4) writer.Emit({ 0xCC });
+    size_t unwindAt = writer.Size();
+    writer.Emit({ 0x01, 0x04, 0x02, 0x05, 0x04, 0x03, 0x01, 0x50 });
+#endif
+
+    if (!writer.Finish(m_Allocation, &destination, 1)) return false;
+    m_pCode = m_Allocation.data();
+
+#ifdef _WIN32
+    unwind->function = { 0, (DWORD)codeSize, (DWORD)unwindAt };
+    if (!RtlAddFunctionTable(&unwind->function, 1, (DWORD64)m_pCode)) return false;
+#else
+    unwind->ehFrame = BuildEhFrame(m_pCode, codeSize);
+    __register_frame(unwind->ehFrame.data());
+#endif
+
+    m_pUnwind = std::move(unwind);
+    return true;
+}
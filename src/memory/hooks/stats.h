@@ -0,0 +1,133 @@
+/************************************************************************************************
+ *  SwiftlyS2 is a scripting framework for Source2-based games.
+ *  Copyright (C) 2023-2026 Swiftly Solution SRL via Sava Andrei-Sebastian and it's contributors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ ************************************************************************************************/
+
+#ifndef src_memory_hooks_stats_h
+#define src_memory_hooks_stats_h
+
+#include <safetyhook/safetyhook.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+struct HookStatsRecord
+{
+    std::string kind;
+    std::string name;
+    std::string owner;
+
+    std::atomic<uint64_t> calls{ 0 };
+    // exclusive, the time spent in hooks further down the same call is not included
+    std::atomic<uint64_t> cycles{ 0 };
+    std::atomic<uint64_t> maxCycles{ 0 };
+
+    uint32_t refs = 0;
+};
+
+// Call counts and rdtsc timings for everything that runs inside a hook. While disabled nothing
+// is measured or even allocated: detour chains are linked without the timing thunks and the
+// dispatch loops only test a flag. Records are created the first time their hook runs with stats
+// enabled and never freed, a call can still be in flight when its hook goes away; a hook
+// registered again under the same kind / name picks up the released record.
+class HookStats
+{
+public:
+    HookStatsRecord* Register(const std::string& kind, const std::string& name);
+    void Release(HookStatsRecord* record);
+    void SetOwner(HookStatsRecord* record, const std::string& owner);
+
+    void SetEnabled(bool enabled);
+    bool IsEnabled() const { return m_bEnabled.load(std::memory_order_relaxed); }
+
+    void Reset();
+    std::string GetReport();
+
+    // start / stop timing a call, `frame` is the caller's stack frame and ties the two together.
+    // Frames skipped by an exception or longjmp are dropped the next time a call starts or ends
+    // further up the stack, without being recorded.
+    static void Enter(HookStatsRecord* record, const void* frame);
+    static void Exit(const void* frame);
+
+private:
+    std::atomic<bool> m_bEnabled{ false };
+
+    std::mutex m_Mutex;
+    std::vector<std::unique_ptr<HookStatsRecord>> m_vRecords;
+    // kind + '\n' + name -> records, looked up on registration only
+    std::unordered_multimap<std::string, HookStatsRecord*> m_Index;
+
+    uint64_t m_uCalibrationCycles = 0;
+    int64_t m_iCalibrationTime = 0;
+};
+
+extern HookStats g_HookStats;
+
+struct HookStatsUnwind;
+
+// Times a call passing through a detour chain without knowing its signature. The thunk calls
+// the destination itself with the argument registers untouched and a copy of the first
+// 32 stack argument slots, then records the call and returns with the
+// return registers intact. Its frame is registered with the unwinder, so exceptions pass through.
+class HookStatsThunk
+{
+public:
+    HookStatsThunk();
+    ~HookStatsThunk();
+
+    bool Create(HookStatsRecord* record, void* destination);
+    void* Address() const { return m_pCode; }
+
+private:
+    safetyhook::Allocation m_Allocation;
+    uint8_t* m_pCode = nullptr;
+    std::unique_ptr<HookStatsUnwind> m_pUnwind;
+};
+
+// Times a callback called from C++. The hook's record is only created once stats are enabled,
+// `describe` names it then; while disabled this is a single branch. The scope's address marks its
+// frame, so a function keeps at most one scope open at a time.
+class HookStatsScope
+{
+public:
+    template<typename F>
+    HookStatsScope(HookStatsRecord*& record, const char* kind, F&& describe)
+    {
+        if (!g_HookStats.IsEnabled()) return;
+
+        if (!record) record = g_HookStats.Register(kind, describe());
+        HookStats::Enter(record, this);
+        m_bActive = true;
+    }
+
+    ~HookStatsScope()
+    {
+        if (m_bActive) HookStats::Exit(this);
+    }
+
+    HookStatsScope(const HookStatsScope&) = delete;
+    HookStatsScope& operator=(const HookStatsScope&) = delete;
+
+private:
+    bool m_bActive = false;
+};
+
+#endif
@@ -0,0 +1,145 @@
+/************************************************************************************************
+ *  SwiftlyS2 is a scripting framework for Source2-based games.
+ *  Copyright (C) 2023-2026 Swiftly Solution SRL via Sava Andrei-Sebastian and it's contributors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ ************************************************************************************************/
+
+#include "thunk.h"
+
+#include <cstring>
+
+void ThunkWriter::EmitImm64(const void* value)
+{
+    uint64_t imm = (uint64_t)value;
+    for (int i = 0; i < 8; i++)
+        m_vCode.push_back((uint8_t)(imm >> (i * 8)));
+}
+
+void ThunkWriter::EmitSaveArguments()
+{
+    // push rbp; mov rbp, rsp
+    Emit({ 0x55, 0x48, 0x89, 0xE5 });
+#ifdef _WIN32
+    // push r9; push r8; push rdx; push rcx -> [rsp] = rcx, rdx, r8, r9
+    Emit({ 0x41, 0x51, 0x41, 0x50, 0x52, 0x51 });
+    // sub rsp, 0x60 (shadow space + xmm0-3)
+    Emit({ 0x48, 0x83, 0xEC, 0x60 });
+    // movdqu [rsp + 0x20 + i * 0x10], xmm0-3
+    for (uint8_t i = 0; i < 4; i++)
+        Emit({ 0xF3, 0x0F, 0x7F, (uint8_t)(0x44 | (i << 3)), 0x24, (uint8_t)(0x20 + i * 0x10) });
+#else
+    // push rax (al carries the vector register count of variadic calls)
+    // push r9; push r8; push rcx; push rdx; push rsi; push rdi -> [rsp] = rdi, rsi, rdx, rcx, r8, r9
+    Emit({ 0x50, 0x41, 0x51, 0x41, 0x50, 0x51, 0x52, 0x56, 0x57 });
+    // sub rsp, 0x88 (xmm0-7 + alignment)
+    Emit({ 0x48, 0x81, 0xEC, 0x88, 0x00, 0x00, 0x00 });
+    // movdqu [rsp + i * 0x10], xmm0-7
+    for (uint8_t i = 0; i < 8; i++)
+        Emit({ 0xF3, 0x0F, 0x7F, (uint8_t)(0x44 | (i << 3)), 0x24, (uint8_t)(i * 0x10) });
+#endif
+}
+
+void ThunkWriter::EmitRestoreArguments(bool keepFrame)
+{
+#ifdef _WIN32
+    for (uint8_t i = 0; i < 4; i++)
+        Emit({ 0xF3, 0x0F, 0x6F, (uint8_t)(0x44 | (i << 3)), 0x24, (uint8_t)(0x20 + i * 0x10) });
+    // add rsp, 0x60; pop rcx; pop rdx; pop r8; pop r9
+    Emit({ 0x48, 0x83, 0xC4, 0x60 });
+    Emit({ 0x59, 0x5A, 0x41, 0x58, 0x41, 0x59 });
+#else
+    for (uint8_t i = 0; i < 8; i++)
+        Emit({ 0xF3, 0x0F, 0x6F, (uint8_t)(0x44 | (i << 3)), 0x24, (uint8_t)(i * 0x10) });
+    // add rsp, 0x88; pop rdi; pop rsi; pop rdx; pop rcx; pop r8; pop r9; pop rax
+    Emit({ 0x48, 0x81, 0xC4, 0x88, 0x00, 0x00, 0x00 });
+    Emit({ 0x5F, 0x5E, 0x5A, 0x59, 0x41, 0x58, 0x41, 0x59, 0x58 });
+#endif
+    // pop rbp
+    if (!keepFrame) Emit({ 0x5D });
+}
+
+void ThunkWriter::EmitLoadArgument(int n, const void* value)
+{
+#ifdef _WIN32
+    // mov rcx / rdx, imm64
+    Emit({ 0x48, (uint8_t)(n == 0 ? 0xB9 : 0xBA) });
+#else
+    // mov rdi / rsi, imm64
+    Emit({ 0x48, (uint8_t)(n == 0 ? 0xBF : 0xBE) });
+#endif
+    EmitImm64(value);
+}
+
+void ThunkWriter::EmitLoadSavedRegisters()
+{
+#ifdef _WIN32
+    // lea rdx, [rsp + 0x60]
+    Emit({ 0x48, 0x8D, 0x54, 0x24, 0x60 });
+#else
+    // lea rsi, [rsp + 0x88]
+    Emit({ 0x48, 0x8D, 0xB4, 0x24, 0x88, 0x00, 0x00, 0x00 });
+#endif
+}
+
+void ThunkWriter::EmitLoadFrame(int n, int8_t disp)
+{
+#ifdef _WIN32
+    // lea rdx / r8, [rbp + disp]
+    if (n == 1) Emit({ 0x48, 0x8D, 0x55, (uint8_t)disp });
+    else Emit({ 0x4C, 0x8D, 0x45, (uint8_t)disp });
+#else
+    // lea rsi / rdx, [rbp + disp]
+    if (n == 1) Emit({ 0x48, 0x8D, 0x75, (uint8_t)disp });
+    else Emit({ 0x48, 0x8D, 0x55, (uint8_t)disp });
+#endif
+}
+
+void ThunkWriter::EmitCall(const void* function)
+{
+    Emit({ 0x48, 0xB8 });
+    EmitImm64(function);
+    Emit({ 0xFF, 0xD0 });
+}
+
+void ThunkWriter::EmitJump(int slot)
+{
+    Emit({ 0xFF, 0x25, 0x00, 0x00, 0x00, 0x00 });
+    m_vJumps.push_back({ m_vCode.size(), slot });
+}
+
+void ThunkWriter::EmitCallSlot(int slot)
+{
+    Emit({ 0xFF, 0x15, 0x00, 0x00, 0x00, 0x00 });
+    m_vJumps.push_back({ m_vCode.size(), slot });
+}
+
+void** ThunkWriter::Finish(safetyhook::Allocation& allocation, void* const* slots, int slotCount)
+{
+    size_t slotsAt = (m_vCode.size() + 7) & ~(size_t)7;
+    for (auto& [end, slot] : m_vJumps)
+    {
+        int32_t disp = (int32_t)(slotsAt + slot * sizeof(void*) - end);
+        memcpy(&m_vCode[end - 4], &disp, sizeof(disp));
+    }
+    m_vCode.resize(slotsAt, 0xCC);
+
+    auto result = safetyhook::Allocator::global()->allocate(slotsAt + slotCount * sizeof(void*));
+    if (!result) return nullptr;
+
+    allocation = std::move(*result);
+    memcpy(allocation.data(), m_vCode.data(), m_vCode.size());
+    if (slotCount > 0) memcpy(allocation.data() + slotsAt, slots, slotCount * sizeof(void*));
+    return (void**)(allocation.data() + slotsAt);
+}
@@ -0,0 +1,77 @@
+/************************************************************************************************
+ *  SwiftlyS2 is a scripting framework for Source2-based games.
+ *  Copyright (C) 2023-2026 Swiftly Solution SRL via Sava Andrei-Sebastian and it's contributors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ ************************************************************************************************/
+
+#ifndef src_memory_hooks_thunk_h
+#define src_memory_hooks_thunk_h
+
+#include <safetyhook/safetyhook.hpp>
+
+#include <cstdint>
+#include <initializer_list>
+#include <utility>
+#include <vector>
+
+// Builds the small x86-64 thunks the hook chains put in front of callbacks.
+// SaveArguments / RestoreArguments bracket a call into C++ that must not disturb the hooked
+// call: every register an argument can be passed in is preserved, together with rbp and the stack.
+class ThunkWriter
+{
+public:
+    void Emit(std::initializer_list<uint8_t> bytes) { m_vCode.insert(m_vCode.end(), bytes); }
+    void EmitImm64(const void* value);
+
+    // push rbp; mov rbp, rsp; spill the argument registers, rsp ends up 16 byte aligned
+    void EmitSaveArguments();
+    // undoes EmitSaveArguments, including the pop rbp unless the frame is kept for more code
+    void EmitRestoreArguments(bool keepFrame = false);
+
+    // mov <argument register n>, imm64 (n = 0 or 1)
+    void EmitLoadArgument(int n, const void* value);
+    // lea <second argument register>, [saved integer argument registers]
+    void EmitLoadSavedRegisters();
+    // lea <argument register n>, [rbp + disp] (n = 1 or 2)
+    void EmitLoadFrame(int n, int8_t disp);
+    // mov rax, function; call rax
+    void EmitCall(const void* function);
+
+    // jmp [rip + disp32] through slot `slot`, the displacement is patched once the slots are placed
+    void EmitJump(int slot);
+    // call [rip + disp32] through slot `slot`, same as EmitJump
+    void EmitCallSlot(int slot);
+
+    size_t Size() const { return m_vCode.size(); }
+
+    // allocates executable memory, copies the code followed by the 8 byte aligned jump slots
+    // and returns where the slots ended up, null on failure
+    void** Finish(safetyhook::Allocation& allocation, void* const* slots, int slotCount);
+
+private:
+    std::vector<uint8_t> m_vCode;
+    std::vector<std::pair<size_t, int>> m_vJumps;
+};
+
+#ifdef _WIN32
+// rbp relative offset of the first argument passed on the stack, past the shadow space
+#define THUNK_STACK_ARGUMENTS 0x30
+#define THUNK_REGISTER_ARGUMENTS 4
+#else
+#define THUNK_STACK_ARGUMENTS 0x10
+#define THUNK_REGISTER_ARGUMENTS 6
+#endif
+
+#endif
@@ -21,47 +21,58 @@
 #include <api/interfaces/manager.h>
 #include <s2binlib/s2binlib.h>
 
-void VFunctionHook::SetHookFunction(const std::string& interface, int index, void* callback)
+#include <mutex>
+#include <unordered_map>
+
+static std::mutex g_VTableTrampolinesMutex;
+static std::unordered_map<void*, void*> g_VTableTrampolines;
+
+static void* GetVTableTrampoline(void* slot)
 {
-    static auto iface = g_ifaceService.FetchInterface<void>(interface.c_str());
-    if (!iface) return;
+    std::lock_guard lock(g_VTableTrampolinesMutex);
+
+    auto it = g_VTableTrampolines.find(slot);
+    if (it != g_VTableTrampolines.end()) return it->second;
 
     void* trampoline_addr = nullptr;
-    s2binlib_install_trampoline(((void*)((uintptr_t)(*(void**)iface) + 8 * index)), &trampoline_addr);
+    s2binlib_install_trampoline(slot, &trampoline_addr);
+    if (trampoline_addr) g_VTableTrampolines[slot] = trampoline_addr;
 
-    m_oHook = safetyhook::create_inline(trampoline_addr, callback, safetyhook::InlineHook::Flags::StartDisabled);
+    return trampoline_addr;
+}
+
+void VFunctionHook::SetHookFunction(const std::string& interface, int index, void* callback)
+{
+    auto iface = g_ifaceService.FetchInterface<void>(interface.c_str());
+    if (!iface) return;
+
+    m_oHook.SetHookFunction(GetVTableTrampoline((void*)((uintptr_t)(*(void**)iface) + 8 * index)), callback);
 }
 
 void VFunctionHook::SetHookFunction(void* instance, int index, void* callback, bool is_vtable)
 {
     if (!instance) return;
 
-    void* trampoline_addr = nullptr;
-    s2binlib_install_trampoline(is_vtable ? (void*)((uintptr_t)instance + 8 * index) : ((void*)((uintptr_t)(*(void**)instance) + 8 * index)), &trampoline_addr);
-
-    m_oHook = safetyhook::create_inline(trampoline_addr, callback, safetyhook::InlineHook::Flags::StartDisabled);
+    void* slot = is_vtable ? (void*)((uintptr_t)instance + 8 * index) : ((void*)((uintptr_t)(*(void**)instance) + 8 * index));
+    m_oHook.SetHookFunction(GetVTableTrampoline(slot), callback);
 }
 
 void VFunctionHook::Enable()
 {
-    if (IsEnabled()) return;
-
-    m_oHook.enable();
+    m_oHook.Enable();
 }
 
 void VFunctionHook::Disable()
 {
-    if (!IsEnabled()) return;
-
-    m_oHook.disable();
+    m_oHook.Disable();
 }
 
 void* VFunctionHook::GetOriginal()
 {
-    return (void*)(m_oHook.trampoline().address());
+    return m_oHook.GetOriginal();
 }
 
 bool VFunctionHook::IsEnabled()
 {
-    return m_oHook.enabled();
+    return m_oHook.IsEnabled();
 }
\ No newline at end of file
@@ -20,8 +20,11 @@
 #define src_memory_hooks_vfunction_h
 
 #include <api/memory/hooks/vfunction.h>
-#include <safetyhook/safetyhook.hpp>
 
+#include "function.h"
+
+// Virtual functions are hooked through a jit trampoline installed in the vtable slot,
+// every hook on the same slot shares that trampoline and its detour.
 class VFunctionHook : public IVFunctionHook
 {
 public:
@@ -34,8 +37,7 @@ public:
     virtual void* GetOriginal() override;
     virtual bool IsEnabled() override;
 private:
-    SafetyHookInline m_oHook;
-    void* m_pOriginal = nullptr;
+    FunctionHook m_oHook;
 };
 
 #endif
\ No newline at end of file
@@ -50,16 +50,18 @@ void Logger::Log(LogType type, const std::string& message)
     }
 
     std::string final_output = fmt::format("{} [{}{}{}] {}", PREFIX, GetTerminalStringColor(GetLogTypeString(type)), GetLogTypeString(type), "[/]", message);
-    std::string color_processed = TerminalProcessColor(final_output);
-    std::string without_colors = ClearTerminalColors(final_output);
 
     if (m_bShouldOutputToConsole[(int)type])
     {
-        g_SwiftlyCore.SendConsoleMessage(color_processed);
+        g_SwiftlyCore.SendConsoleMessage(TerminalProcessColor(final_output));
     }
     if (m_bShouldOutputToFile[(int)type] && !m_sLogFilePaths[(int)type].empty())
     {
-        Files::Append(m_sLogFilePaths[(int)type], without_colors);
+        // stripping, timestamping and disk I/O happen on the writer thread
+        if (!m_Writer.Write((int)type, final_output))
+        {
+            Files::Append(m_sLogFilePaths[(int)type], ClearTerminalColors(final_output));
+        }
     }
 }
 
@@ -143,6 +145,7 @@ void Logger::Critical(const std::string& category, const std::string& message)
 void Logger::SetLogFile(LogType type, const std::string& path)
 {
     m_sLogFilePaths[static_cast<int>(type)] = path;
+    m_Writer.SetFilePath(static_cast<int>(type), path);
 }
 
 void Logger::ShouldOutputToFile(LogType type, bool enabled)
@@ -168,6 +171,16 @@ void Logger::ShouldOutputToConsole(LogType type, bool enabled)
     m_bShouldOutputToConsole[static_cast<int>(type)] = enabled;
 }
 
+void Logger::SetFileRotation(uint64_t max_size, bool daily)
+{
+    m_Writer.SetRotation(max_size, daily);
+}
+
+void Logger::Shutdown()
+{
+    m_Writer.Shutdown();
+}
+
 bool Logger::ShouldLog(LogType type)
 {
     if (type == LogType::NONE)
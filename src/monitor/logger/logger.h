@@ -24,6 +24,8 @@
 
 #include <set>
 
+#include "writer.h"
+
 class Logger : public ILogger
 {
 public:
@@ -50,6 +52,9 @@ public:
     virtual void ShouldColorCategoryInConsole(const std::string& category, bool enabled) override;
     virtual void ShouldOutputToConsole(LogType type, bool enabled) override;
 
+    virtual void SetFileRotation(uint64_t max_size, bool daily) override;
+    virtual void Shutdown() override;
+
 private:
     bool ShouldLog(LogType type);
     LogType GetMinLogLevelFromEnv();
@@ -58,6 +63,8 @@ private:
     bool m_bShouldOutputToFile[7] = { false, false, false, false, false, false, false };
     std::string m_sLogFilePaths[7] = { "", "", "", "", "", "", "" };
     std::set<std::string> m_sNonColoredCategories;
+
+    LogFileWriter m_Writer;
 };
 
 #endif
\ No newline at end of file
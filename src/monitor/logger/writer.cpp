@@ -0,0 +1,257 @@
+/************************************************************************************************
+ *  SwiftlyS2 is a scripting framework for Source2-based games.
+ *  Copyright (C) 2023-2026 Swiftly Solution SRL via Sava Andrei-Sebastian and it's contributors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ ************************************************************************************************/
+
+#include "writer.h"
+
+#include <api/shared/files.h>
+#include <api/shared/string.h>
+
+#include <filesystem>
+
+#include <fmt/format.h>
+
+LogFileWriter::LogFileWriter()
+{
+}
+
+LogFileWriter::~LogFileWriter()
+{
+    Shutdown();
+}
+
+void LogFileWriter::Start()
+{
+    std::call_once(m_StartFlag, [this]() {
+        if (m_bShutdown.load()) return;
+
+        m_bRunning.store(true);
+        m_Thread = std::thread(&LogFileWriter::Run, this);
+        });
+}
+
+bool LogFileWriter::Write(int channel, std::string text)
+{
+    if (channel < 0 || channel >= LOG_WRITER_CHANNELS) return false;
+    if (m_bShutdown.load(std::memory_order_relaxed)) return false;
+
+    Start();
+
+    LogWriterEntry entry;
+    entry.channel = channel;
+    entry.time = time(nullptr);
+    entry.text = std::move(text);
+
+    if (!m_Queue.TryPush(std::move(entry)))
+    {
+        // never stall the caller on a slow disk, the writer reports the loss once it catches up
+        m_uDropped.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    m_uSignal.fetch_add(1, std::memory_order_release);
+    m_uSignal.notify_one();
+    return true;
+}
+
+void LogFileWriter::SetFilePath(int channel, const std::string& path)
+{
+    if (channel < 0 || channel >= LOG_WRITER_CHANNELS) return;
+
+    std::lock_guard lock(m_PathsMutex);
+    m_sPaths[channel] = path;
+}
+
+void LogFileWriter::SetRotation(uint64_t max_size, bool daily)
+{
+    m_uMaxSize.store(max_size);
+    m_bDaily.store(daily);
+}
+
+void LogFileWriter::Shutdown()
+{
+    m_bShutdown.store(true);
+
+    if (!m_Thread.joinable()) return;
+
+    m_bRunning.store(false);
+    m_uSignal.fetch_add(1, std::memory_order_release);
+    m_uSignal.notify_one();
+    m_Thread.join();
+}
+
+void LogFileWriter::Run()
+{
+    std::string paths[LOG_WRITER_CHANNELS];
+    LogWriterEntry entry;
+
+    while (true)
+    {
+        uint32_t seen = m_uSignal.load(std::memory_order_acquire);
+        bool running = m_bRunning.load();
+
+        {
+            std::lock_guard lock(m_PathsMutex);
+            for (int i = 0; i < LOG_WRITER_CHANNELS; i++)
+                paths[i] = m_sPaths[i];
+        }
+
+        uint64_t processed = 0;
+        while (m_Queue.TryPop(entry))
+        {
+            if (!paths[entry.channel].empty())
+            {
+                uint64_t dropped = m_uDropped.exchange(0, std::memory_order_relaxed);
+                if (dropped > 0)
+                {
+                    LogWriterEntry notice{ entry.channel, entry.time, fmt::format("[Swiftly] [WARNING] {} log messages were dropped because the log writer couldn't keep up.\n", dropped) };
+                    Process(notice, paths[entry.channel]);
+                }
+
+                Process(entry, paths[entry.channel]);
+            }
+            processed++;
+        }
+
+        if (processed > 0)
+        {
+            for (auto& [path, file] : m_OpenFiles)
+            {
+                if (file.dirty)
+                {
+                    fflush(file.handle);
+                    file.dirty = false;
+                }
+            }
+            continue;
+        }
+
+        if (!running) break;
+
+        m_uSignal.wait(seen, std::memory_order_acquire);
+    }
+
+    CloseAll();
+}
+
+void LogFileWriter::Process(LogWriterEntry& entry, const std::string& path)
+{
+    if (entry.time != m_tLastTime)
+    {
+        m_tLastTime = entry.time;
+#ifdef _WIN32
+        localtime_s(&m_LastDate, &entry.time);
+#else
+        localtime_r(&entry.time, &m_LastDate);
+#endif
+
+#if GCC_COMPILER
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-truncation"
+#endif
+        snprintf(m_sLastPrefix, sizeof(m_sLastPrefix), "[%02d/%02d/%04d - %02d:%02d:%02d] ", m_LastDate.tm_mday, m_LastDate.tm_mon + 1, m_LastDate.tm_year + 1900, m_LastDate.tm_hour, m_LastDate.tm_min, m_LastDate.tm_sec);
+#if GCC_COMPILER
+#pragma GCC diagnostic pop
+#endif
+    }
+
+    OpenFile* file = Open(path, m_LastDate);
+    if (!file) return;
+
+    std::string& text = m_sScratch;
+    text.clear();
+    ProcessColorTags(entry.text, text, ColorMode::Strip);
+
+    uint64_t maxSize = m_uMaxSize.load(std::memory_order_relaxed);
+    if ((maxSize > 0 && file->size + text.size() > maxSize && file->size > 0) || (m_bDaily.load(std::memory_order_relaxed) && file->date.tm_yday != m_LastDate.tm_yday))
+    {
+        Rotate(path, *file, m_LastDate);
+        if (!file->handle) return;
+    }
+
+    size_t prefixLen = strlen(m_sLastPrefix);
+    fwrite(m_sLastPrefix, 1, prefixLen, file->handle);
+    fwrite(text.data(), 1, text.size(), file->handle);
+
+    file->size += prefixLen + text.size();
+    file->dirty = true;
+}
+
+LogFileWriter::OpenFile* LogFileWriter::Open(const std::string& path, const tm& date)
+{
+    auto it = m_OpenFiles.find(path);
+    if (it != m_OpenFiles.end() && it->second.handle) return &it->second;
+
+    std::string fullPath = Files::GeneratePath(path);
+
+    std::error_code ec;
+    auto parent = std::filesystem::path(fullPath).parent_path();
+    if (!parent.empty()) std::filesystem::create_directories(parent, ec);
+
+    FILE* handle = std::fopen(fullPath.c_str(), "a");
+    if (!handle) return nullptr;
+
+    OpenFile& file = m_OpenFiles[path];
+    file.handle = handle;
+    file.size = std::filesystem::file_size(fullPath, ec);
+    if (ec) file.size = 0;
+
+    // an existing file is assumed to belong to today, the date is only tracked from here on
+    file.date = date;
+    file.dirty = false;
+
+    return &file;
+}
+
+void LogFileWriter::Rotate(const std::string& path, OpenFile& file, const tm& date)
+{
+    fclose(file.handle);
+    file.handle = nullptr;
+
+    std::filesystem::path fullPath = Files::GeneratePath(path);
+
+    // named after the day the file was started on
+    // logs/error.log -> logs/error.2026-01-31.log, logs/error.2026-01-31.1.log, ...
+    std::string stem = (fullPath.parent_path() / fullPath.stem()).string();
+    std::string ext = fullPath.extension().string();
+    std::string dateStr = fmt::format("{:04}-{:02}-{:02}", file.date.tm_year + 1900, file.date.tm_mon + 1, file.date.tm_mday);
+
+    std::error_code ec;
+    std::string rotated = fmt::format("{}.{}{}", stem, dateStr, ext);
+    for (int i = 1; std::filesystem::exists(rotated, ec); i++)
+        rotated = fmt::format("{}.{}.{}{}", stem, dateStr, i, ext);
+
+    std::filesystem::rename(fullPath, rotated, ec);
+
+    file.handle = std::fopen(fullPath.string().c_str(), "a");
+    file.size = 0;
+    file.date = date;
+    file.dirty = false;
+}
+
+void LogFileWriter::CloseAll()
+{
+    for (auto& [path, file] : m_OpenFiles)
+    {
+        if (file.handle)
+        {
+            fflush(file.handle);
+            fclose(file.handle);
+        }
+    }
+    m_OpenFiles.clear();
+}
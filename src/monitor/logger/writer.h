@@ -0,0 +1,100 @@
+/************************************************************************************************
+ *  SwiftlyS2 is a scripting framework for Source2-based games.
+ *  Copyright (C) 2023-2026 Swiftly Solution SRL via Sava Andrei-Sebastian and it's contributors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ ************************************************************************************************/
+
+#ifndef src_monitor_logger_writer_h
+#define src_monitor_logger_writer_h
+
+#include <api/utils/ringbuffer.h>
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <ctime>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#define LOG_WRITER_CHANNELS 7
+#define LOG_WRITER_QUEUE_SIZE 8192
+
+struct LogWriterEntry
+{
+    int channel = 0;
+    time_t time = 0;
+    std::string text;
+};
+
+// Background file sink for the logger. Producers push into a lock-free ring and return
+// immediately, a single writer thread keeps the files open, strips the terminal colors,
+// writes in batches and rotates by size and/or date.
+class LogFileWriter
+{
+public:
+    LogFileWriter();
+    ~LogFileWriter();
+
+    // false means the line wasn't queued (writer is shut down), the caller should write it itself
+    bool Write(int channel, std::string text);
+
+    void SetFilePath(int channel, const std::string& path);
+    void SetRotation(uint64_t max_size, bool daily);
+
+    // writes out everything queued so far before returning
+    void Shutdown();
+
+private:
+    struct OpenFile
+    {
+        FILE* handle = nullptr;
+        uint64_t size = 0;
+        tm date = {};
+        bool dirty = false;
+    };
+
+    void Start();
+    void Run();
+    void Process(LogWriterEntry& entry, const std::string& path);
+    OpenFile* Open(const std::string& path, const tm& date);
+    void Rotate(const std::string& path, OpenFile& file, const tm& date);
+    void CloseAll();
+
+    MPSCRingBuffer<LogWriterEntry> m_Queue{ LOG_WRITER_QUEUE_SIZE };
+
+    std::thread m_Thread;
+    std::once_flag m_StartFlag;
+    std::atomic<bool> m_bRunning{ false };
+    std::atomic<bool> m_bShutdown{ false };
+
+    std::atomic<uint32_t> m_uSignal{ 0 };
+    std::atomic<uint64_t> m_uDropped{ 0 };
+
+    std::mutex m_PathsMutex;
+    std::string m_sPaths[LOG_WRITER_CHANNELS];
+    std::atomic<uint64_t> m_uMaxSize{ 0 };
+    std::atomic<bool> m_bDaily{ false };
+
+    // writer thread only
+    std::map<std::string, OpenFile> m_OpenFiles;
+    time_t m_tLastTime = 0;
+    tm m_LastDate = {};
+    char m_sLastPrefix[32] = {};
+    std::string m_sScratch;
+};
+
+#endif
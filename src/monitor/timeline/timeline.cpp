@@ -0,0 +1,217 @@
+/************************************************************************************************
+ *  SwiftlyS2 is a scripting framework for Source2-based games.
+ *  Copyright (C) 2023-2026 Swiftly Solution SRL via Sava Andrei-Sebastian and it's contributors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ ************************************************************************************************/
+
+#include "timeline.h"
+
+#include <api/shared/texttable.h>
+
+#include <algorithm>
+#include <chrono>
+#include <limits>
+
+#include <fmt/format.h>
+#include <nlohmann/json.hpp>
+
+using json = nlohmann::json;
+
+Timeline g_Timeline;
+
+// open phases of the calling thread as event ids, UINT64_MAX for phases that weren't recorded
+thread_local std::vector<uint64_t> t_OpenPhases;
+thread_local uint32_t t_uThread = 0;
+
+Timeline::Timeline()
+{
+    m_iOrigin = Now();
+}
+
+int64_t Timeline::Now() const
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+TimelineEvent* Timeline::Find(uint64_t id)
+{
+    if (id < m_uPinned) return &m_vEvents[id];
+    if (id < m_uPinned + m_uDropped) return nullptr;
+
+    size_t index = (size_t)(id - m_uDropped);
+    return index < m_vEvents.size() ? &m_vEvents[index] : nullptr;
+}
+
+void Timeline::Begin(const std::string& name, const std::string& category)
+{
+    int64_t now = Now();
+
+    std::lock_guard lock(m_Mutex);
+    if (t_uThread == 0) t_uThread = ++m_uThreads;
+
+    if (m_vEvents.size() >= TIMELINE_MAX_EVENTS)
+    {
+        size_t drop = std::min<size_t>(TIMELINE_DROP_EVENTS, m_vEvents.size() - m_uPinned);
+        if (drop == 0)
+        {
+            t_OpenPhases.push_back(std::numeric_limits<uint64_t>::max());
+            return;
+        }
+
+        m_vEvents.erase(m_vEvents.begin() + m_uPinned, m_vEvents.begin() + m_uPinned + drop);
+        m_uDropped += drop;
+    }
+
+    t_OpenPhases.push_back(m_vEvents.size() + m_uDropped);
+    m_vEvents.push_back({ name, category, t_uThread, (uint32_t)t_OpenPhases.size() - 1, now - m_iOrigin, -1 });
+}
+
+void Timeline::End()
+{
+    if (t_OpenPhases.empty()) return;
+
+    int64_t now = Now();
+    uint64_t id = t_OpenPhases.back();
+    t_OpenPhases.pop_back();
+
+    if (id == std::numeric_limits<uint64_t>::max()) return;
+
+    std::lock_guard lock(m_Mutex);
+    if (auto event = Find(id)) event->duration = now - m_iOrigin - event->start;
+}
+
+void Timeline::Next(const std::string& name)
+{
+    std::string category = "core";
+    if (!t_OpenPhases.empty() && t_OpenPhases.back() != std::numeric_limits<uint64_t>::max())
+    {
+        std::lock_guard lock(m_Mutex);
+        if (auto event = Find(t_OpenPhases.back())) category = event->category;
+    }
+
+    End();
+    Begin(name, category);
+}
+
+void Timeline::Pin()
+{
+    std::lock_guard lock(m_Mutex);
+
+    // only possible while nothing was dropped yet, ids past the pinned events stay as they are then
+    if (m_uDropped == 0) m_uPinned = m_vEvents.size();
+}
+
+void Timeline::EndTo(uint32_t depth)
+{
+    while (t_OpenPhases.size() > depth)
+        End();
+}
+
+uint32_t Timeline::GetDepth() const
+{
+    return (uint32_t)t_OpenPhases.size();
+}
+
+std::string Timeline::GetSummary(const std::string& root) const
+{
+    int64_t now = Now() - m_iOrigin;
+
+    std::lock_guard lock(m_Mutex);
+
+    // with a root only its latest run and everything nested in it is shown
+    size_t first = 0;
+    if (!root.empty())
+    {
+        first = m_vEvents.size();
+        for (size_t i = m_vEvents.size(); i-- > 0;)
+        {
+            if (m_vEvents[i].name == root)
+            {
+                first = i;
+                break;
+            }
+        }
+
+        if (first == m_vEvents.size()) return fmt::format("Nothing was recorded for '{}'.\n", root);
+    }
+
+    auto durationOf = [now](const TimelineEvent& event) { return event.duration >= 0 ? event.duration : now - event.start; };
+
+    TextTable table('-', '|', '+');
+    table.add(" Phase ");
+    table.add(" Category ");
+    if (m_uThreads > 1) table.add(" Thread ");
+    table.add(" Start (ms) ");
+    table.add(" Time (ms) ");
+    table.add(" Share ");
+    table.endOfRow();
+
+    // share is relative to the top level phase the row belongs to
+    std::vector<int64_t> topLevel(m_uThreads + 1, 0);
+    for (size_t i = first; i < m_vEvents.size(); i++)
+    {
+        auto& event = m_vEvents[i];
+        if (!root.empty() && i != first)
+        {
+            // events are stored in start order, the first one outside the root ends the summary
+            auto& rootEvent = m_vEvents[first];
+            if (event.thread == rootEvent.thread && event.depth <= rootEvent.depth) break;
+            if (event.start > rootEvent.start + durationOf(rootEvent)) break;
+        }
+
+        int64_t duration = durationOf(event);
+        if (event.depth == 0 || i == first) topLevel[event.thread] = duration;
+
+        table.add(fmt::format(" {}{}{} ", std::string(event.depth * 2, ' '), event.name, event.duration < 0 ? " (running)" : ""));
+        table.add(fmt::format(" {} ", event.category));
+        if (m_uThreads > 1) table.add(fmt::format(" {} ", event.thread));
+        table.add(fmt::format(" {:.2f} ", event.start / 1000.0));
+        table.add(fmt::format(" {:.2f} ", duration / 1000.0));
+        table.add(topLevel[event.thread] > 0 ? fmt::format(" {:.1f}% ", duration * 100.0 / topLevel[event.thread]) : " - ");
+        table.endOfRow();
+    }
+
+    std::string summary = TableToString(table);
+    if (m_uDropped > 0) summary += fmt::format("{} older events were dropped to stay within {} events.\n", m_uDropped, TIMELINE_MAX_EVENTS);
+    return summary;
+}
+
+std::string Timeline::ExportChromeTrace() const
+{
+    int64_t now = Now() - m_iOrigin;
+
+    std::lock_guard lock(m_Mutex);
+
+    json events = json::array();
+    events.push_back({ { "name", "process_name" }, { "ph", "M" }, { "pid", 1 }, { "tid", 1 }, { "args", { { "name", "SwiftlyS2" } } } });
+    for (uint32_t thread = 1; thread <= m_uThreads; thread++)
+        events.push_back({ { "name", "thread_name" }, { "ph", "M" }, { "pid", 1 }, { "tid", thread }, { "args", { { "name", thread == 1 ? std::string("Main") : fmt::format("Worker {}", thread - 1) } } } });
+
+    for (auto& event : m_vEvents)
+    {
+        events.push_back({
+            { "name", event.name },
+            { "cat", event.category },
+            { "ph", "X" },
+            { "pid", 1 },
+            { "tid", event.thread },
+            { "ts", event.start },
+            { "dur", event.duration >= 0 ? event.duration : now - event.start },
+            });
+    }
+
+    json trace = { { "traceEvents", events }, { "displayTimeUnit", "ms" } };
+    return trace.dump();
+}
@@ -0,0 +1,104 @@
+/************************************************************************************************
+ *  SwiftlyS2 is a scripting framework for Source2-based games.
+ *  Copyright (C) 2023-2026 Swiftly Solution SRL via Sava Andrei-Sebastian and it's contributors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ ************************************************************************************************/
+
+#ifndef src_monitor_timeline_timeline_h
+#define src_monitor_timeline_timeline_h
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#define TIMELINE_MAX_EVENTS 8192
+// once full, this many of the oldest unpinned events are dropped at a time
+#define TIMELINE_DROP_EVENTS (TIMELINE_MAX_EVENTS / 4)
+
+struct TimelineEvent
+{
+    std::string name;
+    std::string category;
+    uint32_t thread = 0;
+    uint32_t depth = 0;
+    int64_t start = 0;
+    int64_t duration = -1;
+};
+
+// Wall clock record of startup and map change phases. Phases nest per thread, the whole
+// timeline can be dumped as a Chrome trace (chrome://tracing, ui.perfetto.dev) or summarized.
+// Events recorded before Pin (startup) are kept for good, later ones are dropped oldest first
+// once the timeline is full.
+class Timeline
+{
+public:
+    Timeline();
+
+    void Begin(const std::string& name, const std::string& category = "core");
+    void End();
+    // ends the innermost phase and starts the next one at the same depth
+    void Next(const std::string& name);
+
+    // closes every phase of this thread deeper than depth
+    void EndTo(uint32_t depth);
+    uint32_t GetDepth() const;
+
+    // keeps every event recorded so far when the timeline fills up
+    void Pin();
+
+    std::string GetSummary(const std::string& root = "") const;
+    std::string ExportChromeTrace() const;
+
+private:
+    int64_t Now() const;
+    // event by id, nullptr if it was dropped
+    TimelineEvent* Find(uint64_t id);
+
+    mutable std::mutex m_Mutex;
+    std::vector<TimelineEvent> m_vEvents;
+    // ids are positions in m_vEvents plus the number of dropped events for everything past the pinned ones
+    size_t m_uPinned = 0;
+    uint64_t m_uDropped = 0;
+    int64_t m_iOrigin;
+    uint32_t m_uThreads = 0;
+};
+
+extern Timeline g_Timeline;
+
+class TimelineScope
+{
+public:
+    TimelineScope(const std::string& name, const std::string& category = "core") : m_uDepth(g_Timeline.GetDepth())
+    {
+        g_Timeline.Begin(name, category);
+    }
+
+    ~TimelineScope()
+    {
+        End();
+    }
+
+    // closes the scope early, along with anything still open inside it
+    void End()
+    {
+        g_Timeline.EndTo(m_uDepth);
+    }
+
+private:
+    uint32_t m_uDepth;
+};
+
+#endif
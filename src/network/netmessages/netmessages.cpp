@@ -21,15 +21,25 @@
 #include <api/interfaces/manager.h>
 #include <api/sdk/serversideclient.h>
 #include <memory/gamedata/manager.h>
+#include <memory/hooks/stats.h>
 
 #include <api/shared/plat.h>
 #include <s2binlib/s2binlib.h>
 
 #include <map>
 
-std::map<uint64_t, std::function<int(uint64_t*, int, void*)>> g_mServerMessageSendCallbacks;
-std::map<uint64_t, std::function<int(int, int, void*)>> g_mClientMessageSendCallbacks;
-std::map<uint64_t, std::function<int(int, int, void*)>> g_mServerMessageInternalSendCallbacks;
+#include <fmt/format.h>
+
+template<typename Fn>
+struct NetMessageHook
+{
+    std::function<Fn> callback;
+    HookStatsRecord* stats = nullptr;
+};
+
+std::map<uint64_t, NetMessageHook<int(uint64_t*, int, void*)>> g_mServerMessageSendCallbacks;
+std::map<uint64_t, NetMessageHook<int(int, int, void*)>> g_mClientMessageSendCallbacks;
+std::map<uint64_t, NetMessageHook<int(int, int, void*)>> g_mServerMessageInternalSendCallbacks;
 
 IFunctionHook* g_pFilterMessageHook = nullptr;
 IVFunctionHook* g_pPostEventAbstractHook = nullptr;
@@ -49,21 +59,21 @@ void CNetMessages::Initialize()
     static auto gamedata = g_ifaceService.FetchInterface<IGameDataManager>(GAMEDATA_INTERFACE_VERSION);
 
     g_pFilterMessageHook = hooksmanager->CreateFunctionHook();
-    g_pFilterMessageHook->SetHookFunction(gamedata->GetSignatures()->Fetch("INetworkMessageProcessingPreFilter::FilterMessage"), (void*)FilterMessage);
+    g_pFilterMessageHook->SetHookFunction(gamedata->GetSignatures()->Fetch(GameDataSignature::INetworkMessageProcessingPreFilter_FilterMessage), (void*)FilterMessage);
     g_pFilterMessageHook->Enable();
 
     void* gameEventSystem = nullptr;
     s2binlib_find_vtable("engine2", "CGameEventSystem", &gameEventSystem);
 
     g_pPostEventAbstractHook = hooksmanager->CreateVFunctionHook();
-    g_pPostEventAbstractHook->SetHookFunction(gameEventSystem, gamedata->GetOffsets()->Fetch("IGameEventSystem::PostEventAbstract"), (void*)PostEventAbstractHook, true);
+    g_pPostEventAbstractHook->SetHookFunction(gameEventSystem, gamedata->GetOffsets()->Fetch(GameDataOffset::IGameEventSystem_PostEventAbstract), (void*)PostEventAbstractHook, true);
     g_pPostEventAbstractHook->Enable();
 
     void* serverSideClientVTable = nullptr;
     s2binlib_find_vtable("engine2", "CServerSideClient", &serverSideClientVTable);
 
     g_pSendNetMessageHook = hooksmanager->CreateVFunctionHook();
-    g_pSendNetMessageHook->SetHookFunction(serverSideClientVTable, gamedata->GetOffsets()->Fetch("CServerSideClient::SendNetMessage"), (void*)SendNetMessage, true);
+    g_pSendNetMessageHook->SetHookFunction(serverSideClientVTable, gamedata->GetOffsets()->Fetch(GameDataOffset::CServerSideClient_SendNetMessage), (void*)SendNetMessage, true);
     g_pSendNetMessageHook->Enable();
 }
 
@@ -86,8 +96,9 @@ bool SendNetMessage(CServerSideClient* client, CNetMessage* pData, NetChannelBuf
     auto playerid = client->GetPlayerSlot().Get();
     int msgid = pData->GetNetMessage()->GetNetMessageInfo()->m_MessageId;
 
-    for (const auto& [id, callback] : g_mServerMessageInternalSendCallbacks) {
-        auto res = callback(playerid, msgid, pData);
+    for (auto& [id, hook] : g_mServerMessageInternalSendCallbacks) {
+        HookStatsScope stats(hook.stats, "netmessage", [&]() { return fmt::format("server message internal #{}", id); });
+        auto res = hook.callback(playerid, msgid, pData);
         if (res == 1) return true;
         else if (res == 2) break;
     }
@@ -103,8 +114,9 @@ bool FilterMessage(INetworkMessageProcessingPreFilterCustom* client, CNetMessage
     auto playerid = client->GetPlayerSlot().Get();
     int msgid = cMsg->GetNetMessage()->GetNetMessageInfo()->m_MessageId;
 
-    for (const auto& [id, callback] : g_mClientMessageSendCallbacks) {
-        auto res = callback(playerid, msgid, cMsg);
+    for (auto& [id, hook] : g_mClientMessageSendCallbacks) {
+        HookStatsScope stats(hook.stats, "netmessage", [&]() { return fmt::format("client message #{}", id); });
+        auto res = hook.callback(playerid, msgid, cMsg);
         if (res == 1) return true;
         else if (res == 2) break;
     }
@@ -120,8 +132,9 @@ void PostEventAbstractHook(void* _this, CSplitScreenSlot nSlot, bool bLocalOnly,
     CNetMessage* msg = const_cast<CNetMessage*>(pData);
     uint64_t* playermask = (uint64_t*)(clients);
 
-    for (const auto& [id, callback] : g_mServerMessageSendCallbacks) {
-        auto res = callback(playermask, msgid, msg);
+    for (auto& [id, hook] : g_mServerMessageSendCallbacks) {
+        HookStatsScope stats(hook.stats, "netmessage", [&]() { return fmt::format("server message #{}", id); });
+        auto res = hook.callback(playermask, msgid, msg);
         if (res == 1) return;
         else if (res == 2) break;
     }
@@ -132,35 +145,47 @@ void PostEventAbstractHook(void* _this, CSplitScreenSlot nSlot, bool bLocalOnly,
 uint64_t CNetMessages::AddServerMessageSendCallback(std::function<int(uint64_t*, int, void*)> callback)
 {
     static uint64_t s_CallbackID = 0;
-    g_mServerMessageSendCallbacks[s_CallbackID++] = callback;
+    g_mServerMessageSendCallbacks[s_CallbackID++] = { callback };
     return s_CallbackID - 1;
 }
 
 void CNetMessages::RemoveServerMessageSendCallback(uint64_t callbackID)
 {
-    g_mServerMessageSendCallbacks.erase(callbackID);
+    auto it = g_mServerMessageSendCallbacks.find(callbackID);
+    if (it == g_mServerMessageSendCallbacks.end()) return;
+
+    g_HookStats.Release(it->second.stats);
+    g_mServerMessageSendCallbacks.erase(it);
 }
 
 uint64_t CNetMessages::AddClientMessageSendCallback(std::function<int(int, int, void*)> callback)
 {
     static uint64_t s_CallbackID = 0;
-    g_mClientMessageSendCallbacks[s_CallbackID++] = callback;
+    g_mClientMessageSendCallbacks[s_CallbackID++] = { callback };
     return s_CallbackID - 1;
 }
 
 void CNetMessages::RemoveClientMessageSendCallback(uint64_t callbackID)
 {
-    g_mClientMessageSendCallbacks.erase(callbackID);
+    auto it = g_mClientMessageSendCallbacks.find(callbackID);
+    if (it == g_mClientMessageSendCallbacks.end()) return;
+
+    g_HookStats.Release(it->second.stats);
+    g_mClientMessageSendCallbacks.erase(it);
 }
 
 uint64_t CNetMessages::AddServerMessageInternalSendCallback(std::function<int(int, int, void*)> callback)
 {
     static uint64_t s_CallbackID = 0;
-    g_mServerMessageInternalSendCallbacks[s_CallbackID++] = callback;
+    g_mServerMessageInternalSendCallbacks[s_CallbackID++] = { callback };
     return s_CallbackID - 1;
 }
 
 void CNetMessages::RemoveServerMessageInternalSendCallback(uint64_t callbackID)
 {
-    g_mServerMessageInternalSendCallbacks.erase(callbackID);
+    auto it = g_mServerMessageInternalSendCallbacks.find(callbackID);
+    if (it == g_mServerMessageInternalSendCallbacks.end()) return;
+
+    g_HookStats.Release(it->second.stats);
+    g_mServerMessageInternalSendCallbacks.erase(it);
 }
\ No newline at end of file
@@ -78,9 +78,9 @@ uint32_t CSoundEvent::Emit()
 
     uint32_t guid;
 #ifdef _WIN32
-    CALL_VIRTUAL(void, gamedata->GetOffsets()->Fetch("CSoundSystem::TakeGuid"), soundsystem, &guid);
+    CALL_VIRTUAL(void, gamedata->GetOffsets()->Fetch(GameDataOffset::CSoundSystem_TakeGuid), soundsystem, &guid);
 #else
-    guid = CALL_VIRTUAL(uint32_t, gamedata->GetOffsets()->Fetch("CSoundSystem::TakeGuid"), soundsystem);
+    guid = CALL_VIRTUAL(uint32_t, gamedata->GetOffsets()->Fetch(GameDataOffset::CSoundSystem_TakeGuid), soundsystem);
 #endif
 
     data->set_soundevent_hash(soundeventHash);
@@ -81,9 +81,9 @@ void* Bridge_Benchmark_PtrToPtr(void* value)
 }
 
 // Pattern 4
-const char* Bridge_Benchmark_StringToString(const char* value)
+int Bridge_Benchmark_StringToString(char* out, int outSize, const char* value)
 {
-    return "test";
+    return WriteNativeReturn(out, outSize, "test");
 }
 void* Bridge_Benchmark_StringToPtr(const char* value)
 {
@@ -18,6 +18,8 @@
 
 #include <scripting/scripting.h>
 #include <api/interfaces/manager.h>
+#include <monitor/timeline/timeline.h>
+#include <scripting/intern.h>
 
 uint8_t Bridge_Core_PluginManualLoadState()
 {
@@ -29,13 +31,12 @@ uint8_t Bridge_Core_PluginManualLoadState()
     return 0;
 }
 
-int Bridge_Core_PluginLoadOrder(char* out)
+int Bridge_Core_PluginLoadOrder(char* out, int outSize)
 {
     static auto config = g_ifaceService.FetchInterface<IConfiguration>(CONFIGURATION_INTERFACE_VERSION);
     if (std::string* vec = std::get_if<std::string>(&config->GetValue("core.PluginLoadOrder")))
     {
-        if (out != nullptr) strcpy(out, vec->c_str());
-        return static_cast<int>(vec->size());
+        return WriteNativeReturn(out, outSize, *vec);
     }
     return 0;
 }
@@ -50,6 +51,36 @@ uint8_t Bridge_Core_EnableProfilerByDefault()
     return 0;
 }
 
+void Bridge_Core_BeginTimelinePhase(const char* name, const char* category)
+{
+    g_Timeline.Begin(name, category);
+}
+
+void Bridge_Core_EndTimelinePhase()
+{
+    g_Timeline.End();
+}
+
+int Bridge_Core_GetTimelineSummary(char* out, int outSize)
+{
+    return WriteNativeReturn(out, outSize, g_Timeline.GetSummary());
+}
+
+int Bridge_Core_ExportTimeline(char* out, int outSize)
+{
+    return WriteNativeReturn(out, outSize, g_Timeline.ExportChromeTrace());
+}
+
+uint32_t Bridge_Core_InternString(const char* value)
+{
+    return g_StringIntern.Intern(value);
+}
+
 DEFINE_NATIVE("Core.PluginManualLoadState", Bridge_Core_PluginManualLoadState);
 DEFINE_NATIVE("Core.PluginLoadOrder", Bridge_Core_PluginLoadOrder);
-DEFINE_NATIVE("Core.EnableProfilerByDefault", Bridge_Core_EnableProfilerByDefault);
\ No newline at end of file
+DEFINE_NATIVE("Core.EnableProfilerByDefault", Bridge_Core_EnableProfilerByDefault);
+DEFINE_NATIVE("Core.BeginTimelinePhase", Bridge_Core_BeginTimelinePhase);
+DEFINE_NATIVE("Core.EndTimelinePhase", Bridge_Core_EndTimelinePhase);
+DEFINE_NATIVE("Core.GetTimelineSummary", Bridge_Core_GetTimelineSummary);
+DEFINE_NATIVE("Core.ExportTimeline", Bridge_Core_ExportTimeline);
+DEFINE_NATIVE("Core.InternString", Bridge_Core_InternString);
\ No newline at end of file
@@ -0,0 +1,205 @@
+/************************************************************************************************
+ * SwiftlyS2 is a scripting framework for Source2-based games.
+ * Copyright (C) 2023-2026 Swiftly Solution SRL via Sava Andrei-Sebastian and it's contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ ************************************************************************************************/
+
+#include <api/interfaces/manager.h>
+#include <api/memory/virtual/call.h>
+#include <scripting/intern.h>
+#include <scripting/scripting.h>
+
+#include <public/entity2/entitysystem.h>
+#include <entityhandle.h>
+
+#include <fmt/format.h>
+
+// Ops are laid out back to back, each one starts with this header and is padded to 8 bytes.
+// The managed side (EntityCommandBuffer) writes the exact same layout.
+// Entities are recorded as handles (index and serial) and resolved when the op runs, so an entity
+// that was removed or whose slot got reused in the meantime makes the op fail instead of writing into it.
+enum class CommandBufferOpType : uint32_t
+{
+    StateChanged = 1,
+    WriteProp,
+    Teleport,
+    AcceptInput,
+};
+
+#define COMMANDBUFFER_NO_HANDLE 0xFFFFFFFF
+
+struct CommandBufferOp
+{
+    uint32_t type;
+    uint32_t size; // header and payload
+};
+
+struct CommandBufferStateChanged
+{
+    uint32_t entity;
+    uint32_t padding;
+    uint64_t hash;
+};
+
+// followed by valueSize bytes, the field is marked as changed after the write
+struct CommandBufferWriteProp
+{
+    uint32_t entity;
+    uint32_t valueSize; // has to match the schema size of the field
+    uint64_t hash;
+};
+
+#define COMMANDBUFFER_TELEPORT_POSITION (1 << 0)
+#define COMMANDBUFFER_TELEPORT_ANGLE (1 << 1)
+#define COMMANDBUFFER_TELEPORT_VELOCITY (1 << 2)
+
+struct CommandBufferTeleport
+{
+    uint32_t entity;
+    uint32_t flags;
+    Vector position;
+    QAngle angle;
+    Vector velocity;
+};
+
+// followed by the variant
+struct CommandBufferAcceptInput
+{
+    uint32_t entity;
+    uint32_t activator; // COMMANDBUFFER_NO_HANDLE for none
+    uint32_t caller; // COMMANDBUFFER_NO_HANDLE for none
+    uint32_t inputId; // interned with Core.InternString
+    int32_t outputId;
+    uint32_t padding;
+};
+
+// the managed CVariant is written in place right after the op
+static_assert(sizeof(variant_t) == 16);
+
+typedef void (*CEntityInstance_AcceptInput)(void*, const char*, void*, void*, void*, int);
+
+static CEntityInstance* ResolveCommandBufferHandle(uint32_t handle)
+{
+    if (handle == COMMANDBUFFER_NO_HANDLE) return nullptr;
+
+    CEntityHandle ehandle(handle);
+    return ehandle.Get();
+}
+
+static bool RunCommandBufferOp(const CommandBufferOp* op, uint8_t* payload, uint32_t payloadSize)
+{
+    static auto schema = g_ifaceService.FetchInterface<ISDKSchema>(SDKSCHEMA_INTERFACE_VERSION);
+    static auto gamedata = g_ifaceService.FetchInterface<IGameDataManager>(GAMEDATA_INTERFACE_VERSION);
+
+    switch ((CommandBufferOpType)op->type)
+    {
+    case CommandBufferOpType::StateChanged:
+    {
+        auto data = reinterpret_cast<CommandBufferStateChanged*>(payload);
+        auto entity = ResolveCommandBufferHandle(data->entity);
+        if (!entity) return false;
+
+        schema->SetStateChanged(entity, data->hash);
+        return true;
+    }
+    case CommandBufferOpType::WriteProp:
+    {
+        auto data = reinterpret_cast<CommandBufferWriteProp*>(payload);
+        if (data->valueSize > payloadSize - sizeof(CommandBufferWriteProp)) return false;
+        if (data->valueSize != schema->GetFieldSize(data->hash)) return false;
+
+        auto entity = ResolveCommandBufferHandle(data->entity);
+        if (!entity || !schema->GetPropPtr(entity, data->hash)) return false;
+
+        schema->WritePropPtr(entity, data->hash, payload + sizeof(CommandBufferWriteProp), data->valueSize);
+        schema->SetStateChanged(entity, data->hash);
+        return true;
+    }
+    case CommandBufferOpType::Teleport:
+    {
+        static int teleportOffset = gamedata->GetOffsets()->Fetch(GameDataOffset::CBaseEntity_Teleport);
+
+        auto data = reinterpret_cast<CommandBufferTeleport*>(payload);
+        auto entity = ResolveCommandBufferHandle(data->entity);
+        if (!entity) return false;
+
+        CALL_VIRTUAL(void, teleportOffset, entity,
+            (data->flags & COMMANDBUFFER_TELEPORT_POSITION) ? &data->position : nullptr,
+            (data->flags & COMMANDBUFFER_TELEPORT_ANGLE) ? &data->angle : nullptr,
+            (data->flags & COMMANDBUFFER_TELEPORT_VELOCITY) ? &data->velocity : nullptr);
+        return true;
+    }
+    case CommandBufferOpType::AcceptInput:
+    {
+        static auto acceptInput = reinterpret_cast<CEntityInstance_AcceptInput>(gamedata->GetSignatures()->Fetch(GameDataSignature::CEntityInstance_AcceptInput));
+
+        auto data = reinterpret_cast<CommandBufferAcceptInput*>(payload);
+        auto input = g_StringIntern.Get(data->inputId);
+        if (!input) return false;
+
+        auto entity = ResolveCommandBufferHandle(data->entity);
+        auto activator = ResolveCommandBufferHandle(data->activator);
+        auto caller = ResolveCommandBufferHandle(data->caller);
+
+        // an activator or caller that was recorded but is gone by now fails the op as well
+        if (!entity || (!activator && data->activator != COMMANDBUFFER_NO_HANDLE) || (!caller && data->caller != COMMANDBUFFER_NO_HANDLE)) return false;
+
+        acceptInput(entity, input->value.c_str(), activator, caller, payload + sizeof(CommandBufferAcceptInput), data->outputId);
+        return true;
+    }
+    }
+
+    return false;
+}
+
+static uint32_t GetCommandBufferPayloadSize(uint32_t type)
+{
+    switch ((CommandBufferOpType)type)
+    {
+    case CommandBufferOpType::StateChanged: return sizeof(CommandBufferStateChanged);
+    case CommandBufferOpType::WriteProp: return sizeof(CommandBufferWriteProp);
+    case CommandBufferOpType::Teleport: return sizeof(CommandBufferTeleport);
+    case CommandBufferOpType::AcceptInput: return sizeof(CommandBufferAcceptInput) + sizeof(variant_t);
+    }
+
+    return 0;
+}
+
+int Bridge_CommandBuffer_Execute(void* buffer, int size, int* results, int resultsCapacity)
+{
+    uint8_t* data = (uint8_t*)buffer;
+    int offset = 0;
+    int count = 0;
+
+    while (offset + (int)sizeof(CommandBufferOp) <= size && count < resultsCapacity)
+    {
+        auto op = reinterpret_cast<CommandBufferOp*>(data + offset);
+        uint32_t minPayload = GetCommandBufferPayloadSize(op->type);
+
+        if (minPayload == 0 || op->size % 8 != 0 || op->size < sizeof(CommandBufferOp) + minPayload || op->size > (uint32_t)(size - offset))
+        {
+            static auto logger = g_ifaceService.FetchInterface<ILogger>(LOGGER_INTERFACE_VERSION);
+            logger->Error("CommandBuffer", fmt::format("Malformed op (type={}, size={}) at offset {}, the rest of the buffer was skipped.\n", op->type, op->size, offset));
+            break;
+        }
+
+        results[count++] = RunCommandBufferOp(op, data + offset + sizeof(CommandBufferOp), op->size - sizeof(CommandBufferOp)) ? 1 : 0;
+        offset += op->size;
+    }
+
+    return count;
+}
+
+DEFINE_NATIVE("CommandBuffer.Execute", Bridge_CommandBuffer_Execute);
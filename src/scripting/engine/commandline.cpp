@@ -39,17 +39,13 @@ int Scripting_CommandLine_GetParameterCount()
     return cmdLine->ParmCount();
 }
 
-int Scripting_CommandLine_GetParameterValueString(char* out, const char* param, const char* defaultValue)
+int Scripting_CommandLine_GetParameterValueString(char* out, int outSize, const char* param, const char* defaultValue)
 {
     ICommandLine* cmdLine = CommandLine();
-    if (!cmdLine) return 1;
+    if (!cmdLine) return 0;
 
     CUtlStringToken token(param);
-    std::string s = cmdLine->ParmValue(token, defaultValue);
-
-    if (out != nullptr) strcpy(out, s.c_str());
-
-    return s.size();
+    return WriteNativeReturn(out, outSize, cmdLine->ParmValue(token, defaultValue));
 }
 
 int Scripting_CommandLine_GetParameterValueInt(const char* param, int defaultValue)
@@ -70,16 +66,12 @@ float Scripting_CommandLine_GetParameterValueFloat(const char* param, float defa
     return cmdLine->ParmValue(token, defaultValue);
 }
 
-int Scripting_CommandLine_GetCommandLine(char* out)
+int Scripting_CommandLine_GetCommandLine(char* out, int outSize)
 {
     ICommandLine* cmdLine = CommandLine();
     if (!cmdLine) return 0;
 
-    std::string s = cmdLine->GetCmdLine();
-
-    if (out != nullptr) strcpy(out, s.c_str());
-
-    return s.size();
+    return WriteNativeReturn(out, outSize, cmdLine->GetCmdLine());
 }
 
 bool Scripting_CommandLine_HasParameters()
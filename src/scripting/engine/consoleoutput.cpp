@@ -59,15 +59,11 @@ bool Bridge_ConsoleOutput_NeedsFiltering(const char* text)
     return consoleOutput->NeedsFiltering(std::string(text));
 }
 
-int Bridge_ConsoleOutput_GetCounterText(char* out)
+int Bridge_ConsoleOutput_GetCounterText(char* out, int outSize)
 {
-    static std::string counterText;
     auto consoleOutput = g_ifaceService.FetchInterface<IConsoleOutput>(CONSOLEOUTPUT_INTERFACE_VERSION);
 
-    if (out != nullptr) strcpy(out, counterText.c_str());
-    else counterText = consoleOutput->GetCounterText();
-
-    return counterText.size();
+    return WriteNativeReturn(out, outSize, consoleOutput->GetCounterText());
 }
 
 DEFINE_NATIVE("ConsoleOutput.AddConsoleListener", Bridge_ConsoleOutput_AddConsoleListener);
@@ -30,10 +30,18 @@ void Bridge_Convars_QueryClientConvar(int playerid, const char* cvarName)
     convarmanager->QueryClientConvar(playerid, cvarName);
 }
 
+void Bridge_Convars_QueryClientConvarWithCallback(int playerid, const char* cvarName, void* callback)
+{
+    static auto convarmanager = g_ifaceService.FetchInterface<IConvarManager>(CONVARMANAGER_INTERFACE_VERSION);
+    convarmanager->QueryClientConvarWithCallback(playerid, cvarName, [callback](int playerid, const std::string& cvarName, const std::string* cvarValue) -> void {
+        ((void(*)(int, const char*, const char*))callback)(playerid, cvarName.c_str(), cvarValue ? cvarValue->c_str() : nullptr);
+        });
+}
+
 int Bridge_Convars_AddQueryClientCvarCallback(void* callback)
 {
     static auto convarmanager = g_ifaceService.FetchInterface<IConvarManager>(CONVARMANAGER_INTERFACE_VERSION);
-    return convarmanager->AddQueryClientCvarCallback([callback](int playerid, std::string cvarName, std::string cvarValue) -> void {
+    return convarmanager->AddQueryClientCvarCallback([callback](int playerid, const std::string& cvarName, const std::string& cvarValue) -> void {
         ((void(*)(int, const char*, const char*))callback)(playerid, cvarName.c_str(), cvarValue.c_str());
         });
 }
@@ -307,17 +315,13 @@ bool Bridge_Convars_SetValueAsString(const char* cvarName, const char* value)
     return cvar.SetString(CUtlString(value), CSplitScreenSlot(0));
 }
 
-int Bridge_Convars_GetValueAsString(char* out, const char* cvarName)
+int Bridge_Convars_GetValueAsString(char* out, int outSize, const char* cvarName)
 {
     ConVarRefAbstract cvar(cvarName);
     CBufferString buf;
     cvar.GetValueAsString(buf, CSplitScreenSlot(0));
 
-    if (out != nullptr)
-    {
-        strcpy(out, buf.Get());
-    }
-    return strlen(buf.Get());
+    return WriteNativeReturn(out, outSize, buf.Get());
 }
 
 bool Bridge_Convars_SetDefaultValueAsString(const char* cvarName, const char* defaultValue)
@@ -331,30 +335,22 @@ bool Bridge_Convars_SetDefaultValueAsString(const char* cvarName, const char* de
     return cvar.GetConVarData()->TypeTraits()->StringToValue(defaultValue, data->m_defaultValue);
 }
 
-int Bridge_Convars_GetDefaultValueAsString(char* out, const char* cvarName)
+int Bridge_Convars_GetDefaultValueAsString(char* out, int outSize, const char* cvarName)
 {
     ConVarRefAbstract cvar(cvarName);
     CBufferString buf;
     cvar.GetConVarData()->DefaultValueToString(buf);
 
-    if (out != nullptr)
-    {
-        strcpy(out, buf.Get());
-    }
-    return strlen(buf.Get());
+    return WriteNativeReturn(out, outSize, buf.Get());
 }
 
-int Bridge_Convars_GetMinValueAsString(char* out, const char* cvarName)
+int Bridge_Convars_GetMinValueAsString(char* out, int outSize, const char* cvarName)
 {
     ConVarRefAbstract cvar(cvarName);
     CBufferString buf;
     cvar.GetConVarData()->MinValueToString(buf);
 
-    if (out != nullptr)
-    {
-        strcpy(out, buf.Get());
-    }
-    return strlen(buf.Get());
+    return WriteNativeReturn(out, outSize, buf.Get());
 }
 
 bool Bridge_Convars_SetMinValueAsString(const char* cvarName, const char* minValue)
@@ -368,17 +364,13 @@ bool Bridge_Convars_SetMinValueAsString(const char* cvarName, const char* minVal
     return cvar.GetConVarData()->TypeTraits()->StringToValue(minValue, data->m_minValue);
 }
 
-int Bridge_Convars_GetMaxValueAsString(char* out, const char* cvarName)
+int Bridge_Convars_GetMaxValueAsString(char* out, int outSize, const char* cvarName)
 {
     ConVarRefAbstract cvar(cvarName);
     CBufferString buf;
     cvar.GetConVarData()->MaxValueToString(buf);
 
-    if (out != nullptr)
-    {
-        strcpy(out, buf.Get());
-    }
-    return strlen(buf.Get());
+    return WriteNativeReturn(out, outSize, buf.Get());
 }
 
 bool Bridge_Convars_SetMaxValueAsString(const char* cvarName, const char* maxValue)
@@ -400,17 +392,15 @@ void Bridge_Convars_SetValueInternalAsString(const char* cvarName, const char* v
     cvar.SetValueInternal(0, &v);
 }
 
-int Bridge_Convars_GetDescription(char* out, const char* cvarName)
+int Bridge_Convars_GetDescription(char* out, int outSize, const char* cvarName)
 {
     ConVarRefAbstract cvar(cvarName);
-    std::string s = cvar.GetHelpText();
-
-    if (out != nullptr) strcpy(out, s.c_str());
 
-    return s.size();
+    return WriteNativeReturn(out, outSize, cvar.GetHelpText());
 }
 
 DEFINE_NATIVE("Convars.QueryClientConvar", Bridge_Convars_QueryClientConvar);
+DEFINE_NATIVE("Convars.QueryClientConvarWithCallback", Bridge_Convars_QueryClientConvarWithCallback);
 DEFINE_NATIVE("Convars.AddQueryClientCvarCallback", Bridge_Convars_AddQueryClientCvarCallback);
 DEFINE_NATIVE("Convars.RemoveQueryClientCvarCallback", Bridge_Convars_RemoveQueryClientCvarCallback);
 DEFINE_NATIVE("Convars.AddGlobalChangeListener", Bridge_Convars_AddGlobalChangeListener);
@@ -97,43 +97,29 @@ void* Bridge_EngineHelpers_GetTraceManager()
     return g_pTraceManager;
 }
 
-int Bridge_EngineHelpers_GetCSGODirectoryPath(char* out)
+int Bridge_EngineHelpers_GetCSGODirectoryPath(char* out, int outSize)
 {
-    static std::string s;
-    s = fmt::format("{}{}csgo", Plat_GetGameDirectory(), WIN_LINUX("\\", "/"));
-    if (out != nullptr) strcpy(out, s.c_str());
-    return s.size();
+    return WriteNativeReturn(out, outSize, fmt::format("{}{}csgo", Plat_GetGameDirectory(), WIN_LINUX("\\", "/")));
 }
 
-int Bridge_EngineHelpers_GetGameDirectoryPath(char* out)
+int Bridge_EngineHelpers_GetGameDirectoryPath(char* out, int outSize)
 {
-    static std::string s;
-    s = Plat_GetGameDirectory();
-    if (out != nullptr) strcpy(out, s.c_str());
-    return s.size();
+    return WriteNativeReturn(out, outSize, Plat_GetGameDirectory());
 }
 
-int Bridge_EngineHelpers_GetCurrentGame(char* out)
+int Bridge_EngineHelpers_GetCurrentGame(char* out, int outSize)
 {
-    static std::string s;
-    s = g_SwiftlyCore.GetCurrentGame();
-
-    if (out != nullptr) strcpy(out, s.c_str());
-    return s.size();
+    return WriteNativeReturn(out, outSize, g_SwiftlyCore.GetCurrentGame());
 }
 
-int Bridge_EngineHelpers_GetNativeVersion(char* out)
+int Bridge_EngineHelpers_GetNativeVersion(char* out, int outSize)
 {
-    static std::string s;
-    s = g_SwiftlyCore.GetVersion();
-
-    if (out != nullptr) strcpy(out, s.c_str());
-    return s.size();
+    return WriteNativeReturn(out, outSize, g_SwiftlyCore.GetVersion());
 }
 
-int Bridge_EngineHelpers_GetMenuSettings(char* out)
+int Bridge_EngineHelpers_GetMenuSettings(char* out, int outSize)
 {
-    static std::string s;
+    std::string s;
 
     auto configuration = g_ifaceService.FetchInterface<IConfiguration>(CONFIGURATION_INTERFACE_VERSION);
     try {
@@ -161,8 +147,7 @@ int Bridge_EngineHelpers_GetMenuSettings(char* out)
         printf("Exception: %s\n", e.what());
     }
 
-    if (out != nullptr) strcpy(out, s.c_str());
-    return s.size();
+    return WriteNativeReturn(out, outSize, s);
 }
 
 void* Bridge_EngineHelpers_GetGlobalVars()
@@ -178,24 +163,19 @@ void* Bridge_EngineHelpers_GetNetworkGameServer()
     return g_ifaceService.FetchInterface<INetworkServerService>(NETWORKSERVERSERVICE_INTERFACE_VERSION)->GetIGameServer();
 }
 
-int Bridge_EngineHelpers_GetIP(char* out)
+int Bridge_EngineHelpers_GetIP(char* out, int outSize)
 {
     auto networksystem = g_ifaceService.FetchInterface<INetworkSystem>(NETWORKSYSTEM_INTERFACE_VERSION);
 
     auto& addr = networksystem->GetPublicAdr();
-    std::string s = fmt::format("{}.{}.{}.{}", addr.ip[0], addr.ip[1], addr.ip[2], addr.ip[3]);
-
-    if (out != nullptr) strcpy(out, s.c_str());
-    return s.size();
+    return WriteNativeReturn(out, outSize, fmt::format("{}.{}.{}.{}", addr.ip[0], addr.ip[1], addr.ip[2], addr.ip[3]));
 }
 
 extern std::string workshop_map;
 
-int Bridge_EngineHelpers_GetWorkshopId(char* out)
+int Bridge_EngineHelpers_GetWorkshopId(char* out, int outSize)
 {
-    if (out != nullptr) strcpy(out, workshop_map.c_str());
-
-    return workshop_map.size();
+    return WriteNativeReturn(out, outSize, workshop_map);
 }
 
 DEFINE_NATIVE("EngineHelpers.GetIP", Bridge_EngineHelpers_GetIP);
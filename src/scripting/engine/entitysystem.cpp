@@ -45,7 +45,7 @@ void* Bridge_EntitySystem_CreateEntityByName(const char* name)
 void Bridge_EntitySystem_AcceptInput(void* pEntity, const char* input, void* pActivator, void* pCaller, void* variant, int32_t outputID)
 {
     static auto gamedata = g_ifaceService.FetchInterface<IGameDataManager>(GAMEDATA_INTERFACE_VERSION);
-    static auto sig = gamedata->GetSignatures()->Fetch("CEntityInstance::AcceptInput");
+    static auto sig = gamedata->GetSignatures()->Fetch(GameDataSignature::CEntityInstance_AcceptInput);
 
     reinterpret_cast<CEntityInstance_AcceptInput>(sig)(pEntity, input, pActivator, pCaller, variant, outputID);
 }
@@ -54,7 +54,7 @@ void Bridge_EntitySystem_AddEntityIOEvent(void* pEntity, const char* input, void
 {
     static auto entsystem = g_ifaceService.FetchInterface<IEntitySystem>(ENTITYSYSTEM_INTERFACE_VERSION);
     static auto gamedata = g_ifaceService.FetchInterface<IGameDataManager>(GAMEDATA_INTERFACE_VERSION);
-    static auto sig = gamedata->GetSignatures()->Fetch("CEntitySystem::AddEntityIOEvent");
+    static auto sig = gamedata->GetSignatures()->Fetch(GameDataSignature::CEntitySystem_AddEntityIOEvent);
 
     reinterpret_cast<CEntitySystem_AddEntityIOEvent>(sig)(entsystem->GetEntitySystem(), pEntity, input, pActivator, pCaller, variant, delay, 0, nullptr, nullptr);
 }
@@ -108,6 +108,12 @@ uint64_t Bridge_EntitySystem_HookEntityOutput(const char* className, const char*
     return hooksystem->CreateEntityHookOutput(className, outputName, callback);
 }
 
+uint64_t Bridge_EntitySystem_HookEntityOutputFiltered(const char* className, const char* outputName, uint32_t callerHandle, uint32_t activatorHandle, const char* activatorClassName, void* callback)
+{
+    static auto hooksystem = g_ifaceService.FetchInterface<IHooksManager>(HOOKSMANAGER_INTERFACE_VERSION);
+    return hooksystem->CreateEntityHookOutputFiltered(className, outputName, callerHandle, activatorHandle, activatorClassName, callback);
+}
+
 void Bridge_EntitySystem_UnhookEntityOutput(uint64_t hookid)
 {
     static auto hooksystem = g_ifaceService.FetchInterface<IHooksManager>(HOOKSMANAGER_INTERFACE_VERSION);
@@ -140,6 +146,7 @@ DEFINE_NATIVE("EntitySystem.EntityHandleGet", Bridge_EntitySystem_EntityHandleGe
 DEFINE_NATIVE("EntitySystem.GetEntityHandleFromEntity", Bridge_EntitySystem_GetEntityHandleFromEntity);
 DEFINE_NATIVE("EntitySystem.GetFirstActiveEntity", Bridge_EntitySystem_GetFirstActiveEntity);
 DEFINE_NATIVE("EntitySystem.HookEntityOutput", Bridge_EntitySystem_HookEntityOutput);
+DEFINE_NATIVE("EntitySystem.HookEntityOutputFiltered", Bridge_EntitySystem_HookEntityOutputFiltered);
 DEFINE_NATIVE("EntitySystem.UnhookEntityOutput", Bridge_EntitySystem_UnhookEntityOutput);
 DEFINE_NATIVE("EntitySystem.GetEntityByIndex", Bridge_EntitySystem_GetEntityByIndex);
 DEFINE_NATIVE("EntitySystem.IsValid", Bridge_EntitySystem_IsValid);
\ No newline at end of file
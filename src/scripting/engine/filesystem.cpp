@@ -21,18 +21,14 @@
 
 #include <public/filesystem.h>
 
-int Bridge_FileSystem_GetSearchPath(char* out, char* pathId, int32_t searchPathType, int32_t searchPathsToGet)
+int Bridge_FileSystem_GetSearchPath(char* out, int outSize, char* pathId, int32_t searchPathType, int32_t searchPathsToGet)
 {
     static auto filesystem = g_ifaceService.FetchInterface<IFileSystem>(FILESYSTEM_INTERFACE_VERSION);
 
     CBufferStringGrowable<MAX_PATH> searchPath;
     filesystem->GetSearchPath(pathId, (GetSearchPathTypes_t)searchPathType, searchPath, searchPathsToGet);
 
-    std::string result = searchPath.Get();
-
-    if (out) strcpy(out, result.c_str());
-
-    return result.size();
+    return WriteNativeReturn(out, outSize, searchPath.Get());
 }
 
 bool Bridge_FileSystem_FileExists(char* fileName, char* pathId)
@@ -70,7 +66,7 @@ void Bridge_FileSystem_PrintSearchPaths()
     filesystem->PrintSearchPaths();
 }
 
-int Bridge_FileSystem_ReadFile(char* outBuffer, char* fileName, char* pathId)
+int Bridge_FileSystem_ReadFile(char* out, int outSize, char* fileName, char* pathId)
 {
     static auto filesystem = g_ifaceService.FetchInterface<IFileSystem>(FILESYSTEM_INTERFACE_VERSION);
 
@@ -81,10 +77,9 @@ int Bridge_FileSystem_ReadFile(char* outBuffer, char* fileName, char* pathId)
 
     bool success = filesystem->ReadFile(fileName, pathId, buf, size);
 
-    if (!success) return 1;
+    if (!success) return 0;
 
-    if (outBuffer) strcpy(outBuffer, (char*)buf.Base());
-    return size;
+    return WriteNativeReturn(out, outSize, std::string_view((const char*)buf.Base(), size));
 }
 
 bool Bridge_FileSystem_WriteFile(char* fileName, char* pathId, char* inputBuffer)
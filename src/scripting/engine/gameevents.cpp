@@ -22,6 +22,7 @@
 
 #include <fmt/format.h>
 
+#include <scripting/intern.h>
 #include <scripting/scripting.h>
 
 typedef IGameEventListener2* (*GetLegacyGameEventListener)(CPlayerSlot slot);
@@ -46,14 +47,9 @@ float Bridge_GameEvents_GetFloat(void* event, const char* key)
     return ((IGameEvent*)event)->GetFloat(key);
 }
 
-int Bridge_GameEvents_GetString(char* out, void* event, const char* key)
+int Bridge_GameEvents_GetString(char* out, int outSize, void* event, const char* key)
 {
-    static std::string s;
-    s = ((IGameEvent*)event)->GetString(key);
-
-    if (out != nullptr) strcpy(out, s.c_str());
-
-    return s.size();
+    return WriteNativeReturn(out, outSize, ((IGameEvent*)event)->GetString(key));
 }
 
 void* Bridge_GameEvents_GetPtr(void* event, const char* key)
@@ -151,6 +147,111 @@ bool Bridge_GameEvents_HasKey(void* event, const char* key)
     return ((IGameEvent*)event)->HasKey(key);
 }
 
+bool Bridge_GameEvents_GetBoolById(void* event, uint32_t keyId)
+{
+    return ((IGameEvent*)event)->GetBool(g_StringIntern.GetString(keyId));
+}
+
+int Bridge_GameEvents_GetIntById(void* event, uint32_t keyId)
+{
+    return ((IGameEvent*)event)->GetInt(g_StringIntern.GetString(keyId));
+}
+
+uint64_t Bridge_GameEvents_GetUint64ById(void* event, uint32_t keyId)
+{
+    return ((IGameEvent*)event)->GetUint64(g_StringIntern.GetString(keyId));
+}
+
+float Bridge_GameEvents_GetFloatById(void* event, uint32_t keyId)
+{
+    return ((IGameEvent*)event)->GetFloat(g_StringIntern.GetString(keyId));
+}
+
+int Bridge_GameEvents_GetStringById(char* out, int outSize, void* event, uint32_t keyId)
+{
+    return WriteNativeReturn(out, outSize, ((IGameEvent*)event)->GetString(g_StringIntern.GetString(keyId)));
+}
+
+void* Bridge_GameEvents_GetPtrById(void* event, uint32_t keyId)
+{
+    return ((IGameEvent*)event)->GetPtr(g_StringIntern.GetString(keyId));
+}
+
+void* Bridge_GameEvents_GetEntityById(void* event, uint32_t keyId)
+{
+    return ((IGameEvent*)event)->GetEntity(g_StringIntern.GetString(keyId));
+}
+
+int Bridge_GameEvents_GetEntityIndexById(void* event, uint32_t keyId)
+{
+    return ((IGameEvent*)event)->GetEntityIndex(g_StringIntern.GetString(keyId)).Get();
+}
+
+int Bridge_GameEvents_GetPlayerSlotById(void* event, uint32_t keyId)
+{
+    return ((IGameEvent*)event)->GetPlayerSlot(g_StringIntern.GetString(keyId)).Get();
+}
+
+void* Bridge_GameEvents_GetPlayerControllerById(void* event, uint32_t keyId)
+{
+    return ((IGameEvent*)event)->GetPlayerController(g_StringIntern.GetString(keyId));
+}
+
+void* Bridge_GameEvents_GetPlayerPawnById(void* event, uint32_t keyId)
+{
+    return ((IGameEvent*)event)->GetPlayerPawn(g_StringIntern.GetString(keyId));
+}
+
+int Bridge_GameEvents_GetPawnEntityIndexById(void* event, uint32_t keyId)
+{
+    return ((IGameEvent*)event)->GetPawnEntityIndex(g_StringIntern.GetString(keyId)).Get();
+}
+
+void Bridge_GameEvents_SetBoolById(void* event, uint32_t keyId, bool value)
+{
+    ((IGameEvent*)event)->SetBool(g_StringIntern.GetString(keyId), value);
+}
+
+void Bridge_GameEvents_SetIntById(void* event, uint32_t keyId, int value)
+{
+    ((IGameEvent*)event)->SetInt(g_StringIntern.GetString(keyId), value);
+}
+
+void Bridge_GameEvents_SetUint64ById(void* event, uint32_t keyId, uint64_t value)
+{
+    ((IGameEvent*)event)->SetUint64(g_StringIntern.GetString(keyId), value);
+}
+
+void Bridge_GameEvents_SetFloatById(void* event, uint32_t keyId, float value)
+{
+    ((IGameEvent*)event)->SetFloat(g_StringIntern.GetString(keyId), value);
+}
+
+void Bridge_GameEvents_SetStringById(void* event, uint32_t keyId, const char* value)
+{
+    ((IGameEvent*)event)->SetString(g_StringIntern.GetString(keyId), value);
+}
+
+void Bridge_GameEvents_SetPtrById(void* event, uint32_t keyId, void* value)
+{
+    ((IGameEvent*)event)->SetPtr(g_StringIntern.GetString(keyId), value);
+}
+
+void Bridge_GameEvents_SetEntityById(void* event, uint32_t keyId, void* value)
+{
+    ((IGameEvent*)event)->SetEntity(g_StringIntern.GetString(keyId), (CEntityInstance*)value);
+}
+
+void Bridge_GameEvents_SetEntityIndexById(void* event, uint32_t keyId, int value)
+{
+    ((IGameEvent*)event)->SetEntity(g_StringIntern.GetString(keyId), CEntityIndex(value));
+}
+
+void Bridge_GameEvents_SetPlayerSlotById(void* event, uint32_t keyId, int value)
+{
+    ((IGameEvent*)event)->SetPlayer(g_StringIntern.GetString(keyId), CPlayerSlot(value));
+}
+
 bool Bridge_GameEvents_IsReliable(void* event)
 {
     return ((IGameEvent*)event)->IsReliable();
@@ -227,7 +328,7 @@ void Bridge_GameEvents_FireEventToClient(void* event, int playerid)
     static auto eventmanager = g_ifaceService.FetchInterface<IEventManager>(GAMEEVENTMANAGER_INTERFACE_VERSION);
     static auto crashreporter = g_ifaceService.FetchInterface<ICrashReporter>(CRASHREPORTER_INTERFACE_VERSION);
 
-    auto pListenerSig = gamedata->GetSignatures()->Fetch("LegacyGameEventListener");
+    auto pListenerSig = gamedata->GetSignatures()->Fetch(GameDataSignature::LegacyGameEventListener);
     if (!pListenerSig) return;
 
     auto listener = reinterpret_cast<GetLegacyGameEventListener>(pListenerSig)(playerid);
@@ -246,7 +347,7 @@ bool Bridge_GameEvents_IsPlayerListeningToEventName(int playerid, const char* ev
     static auto gamedata = g_ifaceService.FetchInterface<IGameDataManager>(GAMEDATA_INTERFACE_VERSION);
     static auto eventmanager = g_ifaceService.FetchInterface<IEventManager>(GAMEEVENTMANAGER_INTERFACE_VERSION);
 
-    auto pListenerSig = gamedata->GetSignatures()->Fetch("LegacyGameEventListener");
+    auto pListenerSig = gamedata->GetSignatures()->Fetch(GameDataSignature::LegacyGameEventListener);
     if (!pListenerSig) return false;
 
     auto listener = reinterpret_cast<GetLegacyGameEventListener>(pListenerSig)(playerid);
@@ -260,7 +361,7 @@ bool Bridge_GameEvents_IsPlayerListeningToEvent(int playerid, void* event)
     static auto gamedata = g_ifaceService.FetchInterface<IGameDataManager>(GAMEDATA_INTERFACE_VERSION);
     static auto eventmanager = g_ifaceService.FetchInterface<IEventManager>(GAMEEVENTMANAGER_INTERFACE_VERSION);
 
-    auto pListenerSig = gamedata->GetSignatures()->Fetch("LegacyGameEventListener");
+    auto pListenerSig = gamedata->GetSignatures()->Fetch(GameDataSignature::LegacyGameEventListener);
     if (!pListenerSig) return false;
 
     auto listener = reinterpret_cast<GetLegacyGameEventListener>(pListenerSig)(playerid);
@@ -293,6 +394,27 @@ DEFINE_NATIVE("GameEvents.SetEntity", Bridge_GameEvents_SetEntity);
 DEFINE_NATIVE("GameEvents.SetEntityIndex", Bridge_GameEvents_SetEntityIndex);
 DEFINE_NATIVE("GameEvents.SetPlayerSlot", Bridge_GameEvents_SetPlayerSlot);
 DEFINE_NATIVE("GameEvents.HasKey", Bridge_GameEvents_HasKey);
+DEFINE_NATIVE("GameEvents.GetBoolById", Bridge_GameEvents_GetBoolById);
+DEFINE_NATIVE("GameEvents.GetIntById", Bridge_GameEvents_GetIntById);
+DEFINE_NATIVE("GameEvents.GetUint64ById", Bridge_GameEvents_GetUint64ById);
+DEFINE_NATIVE("GameEvents.GetFloatById", Bridge_GameEvents_GetFloatById);
+DEFINE_NATIVE("GameEvents.GetStringById", Bridge_GameEvents_GetStringById);
+DEFINE_NATIVE("GameEvents.GetPtrById", Bridge_GameEvents_GetPtrById);
+DEFINE_NATIVE("GameEvents.GetEntityById", Bridge_GameEvents_GetEntityById);
+DEFINE_NATIVE("GameEvents.GetEntityIndexById", Bridge_GameEvents_GetEntityIndexById);
+DEFINE_NATIVE("GameEvents.GetPlayerSlotById", Bridge_GameEvents_GetPlayerSlotById);
+DEFINE_NATIVE("GameEvents.GetPlayerControllerById", Bridge_GameEvents_GetPlayerControllerById);
+DEFINE_NATIVE("GameEvents.GetPlayerPawnById", Bridge_GameEvents_GetPlayerPawnById);
+DEFINE_NATIVE("GameEvents.GetPawnEntityIndexById", Bridge_GameEvents_GetPawnEntityIndexById);
+DEFINE_NATIVE("GameEvents.SetBoolById", Bridge_GameEvents_SetBoolById);
+DEFINE_NATIVE("GameEvents.SetIntById", Bridge_GameEvents_SetIntById);
+DEFINE_NATIVE("GameEvents.SetUint64ById", Bridge_GameEvents_SetUint64ById);
+DEFINE_NATIVE("GameEvents.SetFloatById", Bridge_GameEvents_SetFloatById);
+DEFINE_NATIVE("GameEvents.SetStringById", Bridge_GameEvents_SetStringById);
+DEFINE_NATIVE("GameEvents.SetPtrById", Bridge_GameEvents_SetPtrById);
+DEFINE_NATIVE("GameEvents.SetEntityById", Bridge_GameEvents_SetEntityById);
+DEFINE_NATIVE("GameEvents.SetEntityIndexById", Bridge_GameEvents_SetEntityIndexById);
+DEFINE_NATIVE("GameEvents.SetPlayerSlotById", Bridge_GameEvents_SetPlayerSlotById);
 DEFINE_NATIVE("GameEvents.IsReliable", Bridge_GameEvents_IsReliable);
 DEFINE_NATIVE("GameEvents.IsLocal", Bridge_GameEvents_IsLocal);
 DEFINE_NATIVE("GameEvents.RegisterListener", Bridge_GameEvents_RegisterListener);
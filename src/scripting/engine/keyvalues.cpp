@@ -25,13 +25,9 @@ uint32_t Bridge_KeyValuesSystem_GetSymbolForString(const char* str)
     return KeyValuesSystem()->GetSymbolForString(str, true).Get();
 }
 
-int Bridge_KeyValuesSystem_GetStringForSymbol(char* out, int32_t symbol)
+int Bridge_KeyValuesSystem_GetStringForSymbol(char* out, int outSize, int32_t symbol)
 {
-    std::string str = KeyValuesSystem()->GetStringForSymbol(HKeySymbol(symbol));
-
-    if (out != nullptr) strcpy(out, str.c_str());
-
-    return str.size();
+    return WriteNativeReturn(out, outSize, KeyValuesSystem()->GetStringForSymbol(HKeySymbol(symbol)));
 }
 
 DEFINE_NATIVE("KeyValuesSystem.GetSymbolForString", Bridge_KeyValuesSystem_GetSymbolForString);
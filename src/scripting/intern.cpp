@@ -0,0 +1,70 @@
+/************************************************************************************************
+ *  SwiftlyS2 is a scripting framework for Source2-based games.
+ *  Copyright (C) 2023-2026 Swiftly Solution SRL via Sava Andrei-Sebastian and it's contributors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ ************************************************************************************************/
+
+#include "intern.h"
+
+#include <api/shared/hash.h>
+
+StringInternTable g_StringIntern;
+
+StringInternTable::~StringInternTable()
+{
+    for (auto& chunk : m_pChunks)
+        delete[] chunk.load();
+}
+
+uint32_t StringInternTable::Intern(std::string_view value)
+{
+    std::lock_guard lock(m_Mutex);
+
+    auto it = m_Lookup.find(value);
+    if (it != m_Lookup.end()) return it->second;
+
+    uint32_t id = m_uNextId.load(std::memory_order_relaxed);
+    uint32_t chunkIndex = id / STRING_INTERN_CHUNK_SIZE;
+    if (chunkIndex >= STRING_INTERN_MAX_CHUNKS) return 0;
+
+    InternedString* chunk = m_pChunks[chunkIndex].load(std::memory_order_relaxed);
+    if (!chunk)
+    {
+        chunk = new InternedString[STRING_INTERN_CHUNK_SIZE];
+        m_pChunks[chunkIndex].store(chunk, std::memory_order_release);
+    }
+
+    InternedString& entry = chunk[id % STRING_INTERN_CHUNK_SIZE];
+    entry.value = value;
+    entry.hash = hash_32_fnv1a(entry.value.data(), entry.value.size());
+
+    // the entry is complete before the id becomes visible to Get
+    m_Lookup.emplace(entry.value, id);
+    m_uNextId.store(id + 1, std::memory_order_release);
+    return id;
+}
+
+uint32_t StringInternTable::Find(std::string_view value)
+{
+    std::lock_guard lock(m_Mutex);
+
+    auto it = m_Lookup.find(value);
+    return it != m_Lookup.end() ? it->second : 0;
+}
+
+uint32_t StringInternTable::GetCount() const
+{
+    return m_uNextId.load(std::memory_order_acquire) - 1;
+}
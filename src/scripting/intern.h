@@ -0,0 +1,74 @@
+/************************************************************************************************
+ *  SwiftlyS2 is a scripting framework for Source2-based games.
+ *  Copyright (C) 2023-2026 Swiftly Solution SRL via Sava Andrei-Sebastian and it's contributors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ ************************************************************************************************/
+
+#ifndef _src_scripting_intern_h
+#define _src_scripting_intern_h
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#define STRING_INTERN_CHUNK_SIZE 1024
+#define STRING_INTERN_MAX_CHUNKS 256
+
+struct InternedString
+{
+    std::string value;
+    uint32_t hash = 0;
+};
+
+// Strings that managed code passes to natives by id instead of marshalling them on every call.
+// Each string is copied and hashed (fnv1a 32) once, ids are never freed or reused and 0 is never
+// a valid id. Entries live in fixed chunks that never move, so resolving an id takes no lock.
+class StringInternTable
+{
+public:
+    ~StringInternTable();
+
+    // returns the existing id for an already interned string, 0 when the table is full
+    uint32_t Intern(std::string_view value);
+    uint32_t Find(std::string_view value);
+
+    const InternedString* Get(uint32_t id) const
+    {
+        if (id == 0 || id >= m_uNextId.load(std::memory_order_acquire)) return nullptr;
+        return &m_pChunks[id / STRING_INTERN_CHUNK_SIZE].load(std::memory_order_acquire)[id % STRING_INTERN_CHUNK_SIZE];
+    }
+
+    // empty string for an unknown id
+    const char* GetString(uint32_t id) const
+    {
+        auto entry = Get(id);
+        return entry ? entry->value.c_str() : "";
+    }
+
+    uint32_t GetCount() const;
+
+private:
+    std::mutex m_Mutex;
+    std::unordered_map<std::string_view, uint32_t> m_Lookup;
+    std::atomic<InternedString*> m_pChunks[STRING_INTERN_MAX_CHUNKS] = {};
+    std::atomic<uint32_t> m_uNextId{ 1 };
+};
+
+extern StringInternTable g_StringIntern;
+
+#endif
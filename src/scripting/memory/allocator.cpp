@@ -79,6 +79,55 @@ void Bridge_Memory_Move(void* dest, void* src, uint64_t size)
     memalloc->Move(dest, src, size);
 }
 
+void* Bridge_Memory_FrameAlloc(uint64_t size)
+{
+    auto memalloc = g_ifaceService.FetchInterface<IMemoryAllocator>(MEMORYALLOCATOR_INTERFACE_VERSION);
+    return memalloc->FrameAlloc(size);
+}
+
+void* Bridge_Memory_ArenaAlloc(const char* owner, uint64_t size)
+{
+    auto memalloc = g_ifaceService.FetchInterface<IMemoryAllocator>(MEMORYALLOCATOR_INTERFACE_VERSION);
+    return memalloc->ArenaAlloc(owner, size);
+}
+
+void Bridge_Memory_FreeArena(const char* owner)
+{
+    auto memalloc = g_ifaceService.FetchInterface<IMemoryAllocator>(MEMORYALLOCATOR_INTERFACE_VERSION);
+    memalloc->FreeArena(owner);
+}
+
+uint64_t Bridge_Memory_GetArenaAllocated(const char* owner)
+{
+    auto memalloc = g_ifaceService.FetchInterface<IMemoryAllocator>(MEMORYALLOCATOR_INTERFACE_VERSION);
+    return memalloc->GetArenaAllocated(owner);
+}
+
+void Bridge_Memory_StartProfiling(uint32_t sampleRate)
+{
+    auto memalloc = g_ifaceService.FetchInterface<IMemoryAllocator>(MEMORYALLOCATOR_INTERFACE_VERSION);
+    memalloc->StartProfiling(sampleRate);
+}
+
+void Bridge_Memory_StopProfiling()
+{
+    auto memalloc = g_ifaceService.FetchInterface<IMemoryAllocator>(MEMORYALLOCATOR_INTERFACE_VERSION);
+    memalloc->StopProfiling();
+}
+
+bool Bridge_Memory_IsProfiling()
+{
+    auto memalloc = g_ifaceService.FetchInterface<IMemoryAllocator>(MEMORYALLOCATOR_INTERFACE_VERSION);
+    return memalloc->IsProfiling();
+}
+
+int Bridge_Memory_GetProfilingReport(char* out, int outSize)
+{
+    auto memalloc = g_ifaceService.FetchInterface<IMemoryAllocator>(MEMORYALLOCATOR_INTERFACE_VERSION);
+
+    return WriteNativeReturn(out, outSize, memalloc->GetProfilingReport());
+}
+
 DEFINE_NATIVE("Allocator.Alloc", Bridge_Memory_Alloc);
 DEFINE_NATIVE("Allocator.TrackedAlloc", Bridge_Memory_TrackedAlloc);
 DEFINE_NATIVE("Allocator.Free", Bridge_Memory_Free);
@@ -88,4 +137,12 @@ DEFINE_NATIVE("Allocator.GetTotalAllocated", Bridge_Memory_GetTotalAllocated);
 DEFINE_NATIVE("Allocator.GetAllocatedByTrackedIdentifier", Bridge_Memory_GetAllocatedByTrackedIdentifier);
 DEFINE_NATIVE("Allocator.IsPointerValid", Bridge_Memory_IsPointerValid);
 DEFINE_NATIVE("Allocator.Copy", Bridge_Memory_Copy);
-DEFINE_NATIVE("Allocator.Move", Bridge_Memory_Move);
\ No newline at end of file
+DEFINE_NATIVE("Allocator.Move", Bridge_Memory_Move);
+DEFINE_NATIVE("Allocator.FrameAlloc", Bridge_Memory_FrameAlloc);
+DEFINE_NATIVE("Allocator.ArenaAlloc", Bridge_Memory_ArenaAlloc);
+DEFINE_NATIVE("Allocator.FreeArena", Bridge_Memory_FreeArena);
+DEFINE_NATIVE("Allocator.GetArenaAllocated", Bridge_Memory_GetArenaAllocated);
+DEFINE_NATIVE("Allocator.StartProfiling", Bridge_Memory_StartProfiling);
+DEFINE_NATIVE("Allocator.StopProfiling", Bridge_Memory_StopProfiling);
+DEFINE_NATIVE("Allocator.IsProfiling", Bridge_Memory_IsProfiling);
+DEFINE_NATIVE("Allocator.GetProfilingReport", Bridge_Memory_GetProfilingReport);
\ No newline at end of file
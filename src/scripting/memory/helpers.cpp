@@ -71,20 +71,13 @@ void* Bridge_MemoryHelpers_GetAddressBySignature(const char* binary, const char*
     return FindSignature(binary, rawBytes ? BytesToIdaSignature(reinterpret_cast<const unsigned char*>(signature), len) : signature);
 }
 
-int Bridge_MemoryHelpers_GetObjectPtrVtableName(char* out, void* objptr)
+int Bridge_MemoryHelpers_GetObjectPtrVtableName(char* out, int outSize, void* objptr)
 {
     char buffer[1024] = { 0 };
     int ret = s2binlib_get_object_ptr_vtable_name(objptr, buffer, sizeof(buffer));
-    if (ret != 0) {
-        if (out != nullptr) {
-            strcpy(out, "");
-        }
-        return 1;
-    }
-    if (out != nullptr) {
-        strcpy(out, buffer);
-    }
-    return strlen(buffer);
+    if (ret != 0) return 0;
+
+    return WriteNativeReturn(out, outSize, buffer);
 }
 
 bool Bridge_MemoryHelpers_ObjectPtrHasVtable(void* objptr)
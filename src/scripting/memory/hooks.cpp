@@ -18,6 +18,7 @@
 
 #include <api/interfaces/manager.h>
 #include <cstdio>
+#include <cstring>
 #include <scripting/scripting.h>
 
 void* Bridge_Hooks_AllocateHook()
@@ -126,6 +127,79 @@ void* Bridge_Hooks_GetVHookOriginal(void* hook)
     return ((IVFunctionHook*)hook)->GetOriginal();
 }
 
+uint64_t Bridge_Hooks_AddHookListener(void* target, void* callback, int priority)
+{
+    static auto hooksmanager = g_ifaceService.FetchInterface<IHooksManager>(HOOKSMANAGER_INTERFACE_VERSION);
+    return hooksmanager->AddHookListener(target, callback, priority);
+}
+
+uint64_t Bridge_Hooks_AddHookListenerFiltered(void* target, void* callback, int priority, void* conditions, int count)
+{
+    static auto hooksmanager = g_ifaceService.FetchInterface<IHooksManager>(HOOKSMANAGER_INTERFACE_VERSION);
+    return hooksmanager->AddHookListenerFiltered(target, callback, priority, (const HookPredicateCondition*)conditions, count);
+}
+
+void Bridge_Hooks_RemoveHookListener(uint64_t listenerId)
+{
+    static auto hooksmanager = g_ifaceService.FetchInterface<IHooksManager>(HOOKSMANAGER_INTERFACE_VERSION);
+    hooksmanager->RemoveHookListener(listenerId);
+}
+
+void* Bridge_Hooks_GetHookListenerNext(uint64_t listenerId)
+{
+    static auto hooksmanager = g_ifaceService.FetchInterface<IHooksManager>(HOOKSMANAGER_INTERFACE_VERSION);
+    return hooksmanager->GetHookListenerNext(listenerId);
+}
+
+void* Bridge_Hooks_GetHookChainOriginal(void* target)
+{
+    static auto hooksmanager = g_ifaceService.FetchInterface<IHooksManager>(HOOKSMANAGER_INTERFACE_VERSION);
+    return hooksmanager->GetHookChainOriginal(target);
+}
+
+void Bridge_Hooks_BeginTransaction()
+{
+    static auto hooksmanager = g_ifaceService.FetchInterface<IHooksManager>(HOOKSMANAGER_INTERFACE_VERSION);
+    hooksmanager->BeginHookTransaction();
+}
+
+void Bridge_Hooks_CommitTransaction()
+{
+    static auto hooksmanager = g_ifaceService.FetchInterface<IHooksManager>(HOOKSMANAGER_INTERFACE_VERSION);
+    hooksmanager->CommitHookTransaction();
+}
+
+void Bridge_Hooks_EnableStats(bool enable)
+{
+    static auto hooksmanager = g_ifaceService.FetchInterface<IHooksManager>(HOOKSMANAGER_INTERFACE_VERSION);
+    hooksmanager->EnableHookStats(enable);
+}
+
+bool Bridge_Hooks_IsStatsEnabled()
+{
+    static auto hooksmanager = g_ifaceService.FetchInterface<IHooksManager>(HOOKSMANAGER_INTERFACE_VERSION);
+    return hooksmanager->IsHookStatsEnabled();
+}
+
+void Bridge_Hooks_ResetStats()
+{
+    static auto hooksmanager = g_ifaceService.FetchInterface<IHooksManager>(HOOKSMANAGER_INTERFACE_VERSION);
+    hooksmanager->ResetHookStats();
+}
+
+int Bridge_Hooks_GetStatsReport(char* out, int outSize)
+{
+    static auto hooksmanager = g_ifaceService.FetchInterface<IHooksManager>(HOOKSMANAGER_INTERFACE_VERSION);
+
+    return WriteNativeReturn(out, outSize, hooksmanager->GetHookStatsReport());
+}
+
+void Bridge_Hooks_SetHookListenerOwner(uint64_t listenerId, const char* owner)
+{
+    static auto hooksmanager = g_ifaceService.FetchInterface<IHooksManager>(HOOKSMANAGER_INTERFACE_VERSION);
+    hooksmanager->SetHookListenerOwner(listenerId, owner);
+}
+
 DEFINE_NATIVE("Hooks.AllocateHook", Bridge_Hooks_AllocateHook);
 DEFINE_NATIVE("Hooks.AllocateVHook", Bridge_Hooks_AllocateVHook);
 DEFINE_NATIVE("Hooks.AllocateMHook", Bridge_Hooks_AllocateMHook);
@@ -145,4 +219,16 @@ DEFINE_NATIVE("Hooks.IsHookEnabled", Bridge_Hooks_IsHookEnabled);
 DEFINE_NATIVE("Hooks.IsVHookEnabled", Bridge_Hooks_IsVHookEnabled);
 DEFINE_NATIVE("Hooks.IsMHookEnabled", Bridge_Hooks_IsMHookEnabled);
 DEFINE_NATIVE("Hooks.GetHookOriginal", Bridge_Hooks_GetHookOriginal);
-DEFINE_NATIVE("Hooks.GetVHookOriginal", Bridge_Hooks_GetVHookOriginal);
\ No newline at end of file
+DEFINE_NATIVE("Hooks.GetVHookOriginal", Bridge_Hooks_GetVHookOriginal);
+DEFINE_NATIVE("Hooks.AddHookListener", Bridge_Hooks_AddHookListener);
+DEFINE_NATIVE("Hooks.AddHookListenerFiltered", Bridge_Hooks_AddHookListenerFiltered);
+DEFINE_NATIVE("Hooks.RemoveHookListener", Bridge_Hooks_RemoveHookListener);
+DEFINE_NATIVE("Hooks.GetHookListenerNext", Bridge_Hooks_GetHookListenerNext);
+DEFINE_NATIVE("Hooks.GetHookChainOriginal", Bridge_Hooks_GetHookChainOriginal);
+DEFINE_NATIVE("Hooks.BeginTransaction", Bridge_Hooks_BeginTransaction);
+DEFINE_NATIVE("Hooks.CommitTransaction", Bridge_Hooks_CommitTransaction);
+DEFINE_NATIVE("Hooks.EnableStats", Bridge_Hooks_EnableStats);
+DEFINE_NATIVE("Hooks.IsStatsEnabled", Bridge_Hooks_IsStatsEnabled);
+DEFINE_NATIVE("Hooks.ResetStats", Bridge_Hooks_ResetStats);
+DEFINE_NATIVE("Hooks.GetStatsReport", Bridge_Hooks_GetStatsReport);
+DEFINE_NATIVE("Hooks.SetHookListenerOwner", Bridge_Hooks_SetHookListenerOwner);
\ No newline at end of file
@@ -0,0 +1,618 @@
+/************************************************************************************************
+ *  SwiftlyS2 is a scripting framework for Source2-based games.
+ *  Copyright (C) 2023-2026 Swiftly Solution SRL via Sava Andrei-Sebastian and it's contributors (samyycX)
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ ************************************************************************************************/
+
+// Generated by generator/native_generator from natives/, do not edit.
+
+#ifndef src_scripting_natives_h
+#define src_scripting_natives_h
+
+#include <api/shared/hash.h>
+
+#include <cstdint>
+
+#define NATIVE_FUNCTION_COUNT 505
+#define NATIVE_HASH_BUCKETS 126
+#define NATIVE_HASH_SLOTS 627
+
+// hash of g_NativeNames in id order, the managed side checks it against the one it was generated with
+#define NATIVE_NAMES_HASH 0x0556c433a63af12aull
+
+// indexed by native id, ids come from natives/native_ids.txt and never change; retired ids are null
+inline constexpr const char* g_NativeNames[NATIVE_FUNCTION_COUNT] = {
+    "Allocator.Alloc",
+    "Allocator.ArenaAlloc",
+    "Allocator.Copy",
+    "Allocator.FrameAlloc",
+    "Allocator.Free",
+    "Allocator.FreeArena",
+    "Allocator.GetAllocatedByTrackedIdentifier",
+    "Allocator.GetArenaAllocated",
+    "Allocator.GetProfilingReport",
+    "Allocator.GetSize",
+    "Allocator.GetTotalAllocated",
+    "Allocator.IsPointerValid",
+    "Allocator.IsProfiling",
+    "Allocator.Move",
+    "Allocator.Resize",
+    "Allocator.StartProfiling",
+    "Allocator.StopProfiling",
+    "Allocator.TrackedAlloc",
+    "Benchmark.BoolToBool",
+    "Benchmark.ComplexWithString",
+    "Benchmark.DoubleToDouble",
+    "Benchmark.FloatToFloat",
+    "Benchmark.GetBool",
+    "Benchmark.GetDouble",
+    "Benchmark.GetFloat",
+    "Benchmark.GetInt32",
+    "Benchmark.GetInt64",
+    "Benchmark.GetPtr",
+    "Benchmark.GetUInt32",
+    "Benchmark.GetUInt64",
+    "Benchmark.Int32ToInt32",
+    "Benchmark.Int64ToInt64",
+    "Benchmark.MultiPrimitives",
+    "Benchmark.MultiWithOneString",
+    "Benchmark.MultiWithTwoStrings",
+    "Benchmark.PtrToPtr",
+    "Benchmark.QAngleToQAngle",
+    "Benchmark.StringToPtr",
+    "Benchmark.StringToString",
+    "Benchmark.UInt32ToUInt32",
+    "Benchmark.UInt64ToUInt64",
+    "Benchmark.VectorToVector",
+    "Benchmark.VoidToVoid",
+    "CEntityKeyValues.Allocate",
+    "CEntityKeyValues.Deallocate",
+    "CEntityKeyValues.GetBool",
+    "CEntityKeyValues.GetColor",
+    "CEntityKeyValues.GetDouble",
+    "CEntityKeyValues.GetFloat",
+    "CEntityKeyValues.GetInt",
+    "CEntityKeyValues.GetInt64",
+    "CEntityKeyValues.GetPtr",
+    "CEntityKeyValues.GetQAngle",
+    "CEntityKeyValues.GetString",
+    "CEntityKeyValues.GetStringToken",
+    "CEntityKeyValues.GetUint",
+    "CEntityKeyValues.GetUint64",
+    "CEntityKeyValues.GetVector",
+    "CEntityKeyValues.GetVector2D",
+    "CEntityKeyValues.GetVector4D",
+    "CEntityKeyValues.SetBool",
+    "CEntityKeyValues.SetColor",
+    "CEntityKeyValues.SetDouble",
+    "CEntityKeyValues.SetFloat",
+    "CEntityKeyValues.SetInt",
+    "CEntityKeyValues.SetInt64",
+    "CEntityKeyValues.SetPtr",
+    "CEntityKeyValues.SetQAngle",
+    "CEntityKeyValues.SetString",
+    "CEntityKeyValues.SetStringToken",
+    "CEntityKeyValues.SetUint",
+    "CEntityKeyValues.SetUint64",
+    "CEntityKeyValues.SetVector",
+    "CEntityKeyValues.SetVector2D",
+    "CEntityKeyValues.SetVector4D",
+    "CommandBuffer.Execute",
+    "CommandLine.GetCommandLine",
+    "CommandLine.GetParameterCount",
+    "CommandLine.GetParameterValueFloat",
+    "CommandLine.GetParameterValueInt",
+    "CommandLine.GetParameterValueString",
+    "CommandLine.HasParameter",
+    "CommandLine.HasParameters",
+    "Commands.HandleCommandForPlayer",
+    "Commands.IsCommandRegistered",
+    "Commands.RegisterAlias",
+    "Commands.RegisterClientChatListener",
+    "Commands.RegisterClientCommandsListener",
+    "Commands.RegisterCommand",
+    "Commands.UnregisterAlias",
+    "Commands.UnregisterClientChatListener",
+    "Commands.UnregisterClientCommandsListener",
+    "Commands.UnregisterCommand",
+    "ConsoleOutput.AddConsoleListener",
+    "ConsoleOutput.GetCounterText",
+    "ConsoleOutput.IsEnabled",
+    "ConsoleOutput.NeedsFiltering",
+    "ConsoleOutput.ReloadFilterConfiguration",
+    "ConsoleOutput.RemoveConsoleListener",
+    "ConsoleOutput.ToggleFilter",
+    "Convars.AddConCommandCreatedListener",
+    "Convars.AddConvarCreatedListener",
+    "Convars.AddGlobalChangeListener",
+    "Convars.AddQueryClientCvarCallback",
+    "Convars.CreateConvarBool",
+    "Convars.CreateConvarColor",
+    "Convars.CreateConvarDouble",
+    "Convars.CreateConvarFloat",
+    "Convars.CreateConvarInt16",
+    "Convars.CreateConvarInt32",
+    "Convars.CreateConvarInt64",
+    "Convars.CreateConvarQAngle",
+    "Convars.CreateConvarString",
+    "Convars.CreateConvarUInt16",
+    "Convars.CreateConvarUInt32",
+    "Convars.CreateConvarUInt64",
+    "Convars.CreateConvarVector",
+    "Convars.CreateConvarVector2D",
+    "Convars.CreateConvarVector4D",
+    "Convars.DeleteConvar",
+    "Convars.ExistsConvar",
+    "Convars.GetConvarType",
+    "Convars.GetDefaultValueAsString",
+    "Convars.GetDefaultValuePtr",
+    "Convars.GetDescription",
+    "Convars.GetFlags",
+    "Convars.GetMaxValueAsString",
+    "Convars.GetMaxValuePtrPtr",
+    "Convars.GetMinValueAsString",
+    "Convars.GetMinValuePtrPtr",
+    "Convars.GetValueAsString",
+    "Convars.GetValuePtr",
+    "Convars.HasDefaultValue",
+    "Convars.QueryClientConvar",
+    "Convars.QueryClientConvarWithCallback",
+    "Convars.RemoveConCommandCreatedListener",
+    "Convars.RemoveConvarCreatedListener",
+    "Convars.RemoveGlobalChangeListener",
+    "Convars.RemoveQueryClientCvarCallback",
+    "Convars.SetClientConvarValueString",
+    "Convars.SetDefaultValue",
+    "Convars.SetDefaultValueAsString",
+    "Convars.SetDefaultValueString",
+    "Convars.SetFlags",
+    "Convars.SetMaxValueAsString",
+    "Convars.SetMinValueAsString",
+    "Convars.SetValueAsString",
+    "Convars.SetValueInternalAsString",
+    "Convars.SetValueInternalPtr",
+    "Convars.SetValuePtr",
+    "Core.BeginTimelinePhase",
+    "Core.EnableProfilerByDefault",
+    "Core.EndTimelinePhase",
+    "Core.ExportTimeline",
+    nullptr,
+    nullptr,
+    "Core.GetTimelineSummary",
+    "Core.InternString",
+    "Core.PluginLoadOrder",
+    "Core.PluginManualLoadState",
+    "Database.ConnectionExists",
+    "Database.GetConnectionDatabase",
+    "Database.GetConnectionDriver",
+    "Database.GetConnectionHost",
+    "Database.GetConnectionPass",
+    "Database.GetConnectionPort",
+    "Database.GetConnectionRawUri",
+    "Database.GetConnectionTimeout",
+    "Database.GetConnectionUser",
+    "Database.GetDefaultConnectionName",
+    "Database.GetDefaultDriver",
+    "EngineHelpers.ExecuteCommand",
+    "EngineHelpers.FindGameSystemByName",
+    "EngineHelpers.GetCSGODirectoryPath",
+    "EngineHelpers.GetCurrentGame",
+    "EngineHelpers.GetGameDirectoryPath",
+    "EngineHelpers.GetGlobalVars",
+    "EngineHelpers.GetIP",
+    "EngineHelpers.GetMenuSettings",
+    "EngineHelpers.GetNativeVersion",
+    "EngineHelpers.GetNetworkGameServer",
+    "EngineHelpers.GetTraceManager",
+    "EngineHelpers.GetWorkshopId",
+    "EngineHelpers.IsMapValid",
+    "EngineHelpers.SendMessageToConsole",
+    "EntitySystem.AcceptInput",
+    "EntitySystem.AddEntityIOEvent",
+    "EntitySystem.CreateEntityByName",
+    "EntitySystem.Despawn",
+    "EntitySystem.EntityHandleGet",
+    "EntitySystem.EntityHandleIsValid",
+    "EntitySystem.GetEntityByIndex",
+    "EntitySystem.GetEntityHandleFromEntity",
+    "EntitySystem.GetEntitySystem",
+    "EntitySystem.GetFirstActiveEntity",
+    "EntitySystem.GetGameRules",
+    "EntitySystem.HookEntityOutput",
+    "EntitySystem.HookEntityOutputFiltered",
+    "EntitySystem.IsValid",
+    "EntitySystem.IsValidEntity",
+    "EntitySystem.Spawn",
+    "EntitySystem.UnhookEntityOutput",
+    "Events.RegisterOnClientConnectCallback",
+    "Events.RegisterOnClientDisconnectCallback",
+    "Events.RegisterOnClientKeyStateChangedCallback",
+    "Events.RegisterOnClientProcessUsercmdsCallback",
+    "Events.RegisterOnClientPutInServerCallback",
+    "Events.RegisterOnClientSteamAuthorizeCallback",
+    "Events.RegisterOnClientSteamAuthorizeFailCallback",
+    "Events.RegisterOnEntityCreatedCallback",
+    "Events.RegisterOnEntityDeletedCallback",
+    "Events.RegisterOnEntityParentChangedCallback",
+    "Events.RegisterOnEntitySpawnedCallback",
+    "Events.RegisterOnEntityTakeDamageCallback",
+    "Events.RegisterOnGameTickCallback",
+    "Events.RegisterOnMapLoadCallback",
+    "Events.RegisterOnMapUnloadCallback",
+    "Events.RegisterOnPrecacheResourceCallback",
+    "Events.RegisterOnPreworldUpdateCallback",
+    "Events.RegisterOnStartupServerCallback",
+    "FileSystem.AddSearchPath",
+    "FileSystem.FileExists",
+    "FileSystem.FindFileAbsoluteList",
+    "FileSystem.GetFileSize",
+    "FileSystem.GetSearchPath",
+    "FileSystem.IsDirectory",
+    "FileSystem.IsFileWritable",
+    "FileSystem.PrecacheFile",
+    "FileSystem.PrintSearchPaths",
+    "FileSystem.ReadFile",
+    "FileSystem.RemoveSearchPath",
+    "FileSystem.SetFileWritable",
+    "FileSystem.WriteFile",
+    "GameEvents.AddListenerPostCallback",
+    "GameEvents.AddListenerPreCallback",
+    "GameEvents.CreateEvent",
+    "GameEvents.FireEvent",
+    "GameEvents.FireEventToClient",
+    "GameEvents.FreeEvent",
+    "GameEvents.GetBool",
+    "GameEvents.GetBoolById",
+    "GameEvents.GetEHandle",
+    "GameEvents.GetEntity",
+    "GameEvents.GetEntityById",
+    "GameEvents.GetEntityIndex",
+    "GameEvents.GetEntityIndexById",
+    "GameEvents.GetFloat",
+    "GameEvents.GetFloatById",
+    "GameEvents.GetInt",
+    "GameEvents.GetIntById",
+    "GameEvents.GetPawnEHandle",
+    "GameEvents.GetPawnEntityIndex",
+    "GameEvents.GetPawnEntityIndexById",
+    "GameEvents.GetPlayerController",
+    "GameEvents.GetPlayerControllerById",
+    "GameEvents.GetPlayerPawn",
+    "GameEvents.GetPlayerPawnById",
+    "GameEvents.GetPlayerSlot",
+    "GameEvents.GetPlayerSlotById",
+    "GameEvents.GetPtr",
+    "GameEvents.GetPtrById",
+    "GameEvents.GetString",
+    "GameEvents.GetStringById",
+    "GameEvents.GetUint64",
+    "GameEvents.GetUint64ById",
+    "GameEvents.HasKey",
+    nullptr,
+    "GameEvents.IsLocal",
+    "GameEvents.IsPlayerListeningToEvent",
+    "GameEvents.IsPlayerListeningToEventName",
+    "GameEvents.IsReliable",
+    "GameEvents.RegisterListener",
+    "GameEvents.RemoveListenerPostCallback",
+    "GameEvents.RemoveListenerPreCallback",
+    "GameEvents.SetBool",
+    "GameEvents.SetBoolById",
+    "GameEvents.SetEntity",
+    "GameEvents.SetEntityById",
+    "GameEvents.SetEntityIndex",
+    "GameEvents.SetEntityIndexById",
+    "GameEvents.SetFloat",
+    "GameEvents.SetFloatById",
+    "GameEvents.SetInt",
+    "GameEvents.SetIntById",
+    "GameEvents.SetPlayerSlot",
+    "GameEvents.SetPlayerSlotById",
+    "GameEvents.SetPtr",
+    "GameEvents.SetPtrById",
+    "GameEvents.SetString",
+    "GameEvents.SetStringById",
+    "GameEvents.SetUint64",
+    "GameEvents.SetUint64ById",
+    "Hooks.AddHookListener",
+    "Hooks.AddHookListenerFiltered",
+    "Hooks.AllocateHook",
+    "Hooks.AllocateMHook",
+    "Hooks.AllocateVHook",
+    "Hooks.BeginTransaction",
+    "Hooks.CommitTransaction",
+    "Hooks.DeallocateHook",
+    "Hooks.DeallocateMHook",
+    "Hooks.DeallocateVHook",
+    "Hooks.DisableHook",
+    "Hooks.DisableMHook",
+    "Hooks.DisableVHook",
+    "Hooks.EnableHook",
+    "Hooks.EnableMHook",
+    "Hooks.EnableStats",
+    "Hooks.EnableVHook",
+    "Hooks.GetHookChainOriginal",
+    "Hooks.GetHookListenerNext",
+    "Hooks.GetHookOriginal",
+    "Hooks.GetStatsReport",
+    "Hooks.GetVHookOriginal",
+    "Hooks.IsHookEnabled",
+    "Hooks.IsMHookEnabled",
+    "Hooks.IsStatsEnabled",
+    "Hooks.IsVHookEnabled",
+    "Hooks.RemoveHookListener",
+    "Hooks.ResetStats",
+    "Hooks.SetHook",
+    "Hooks.SetHookListenerOwner",
+    "Hooks.SetMHook",
+    "Hooks.SetVHook",
+    "KeyValuesSystem.GetStringForSymbol",
+    "KeyValuesSystem.GetSymbolForString",
+    "MemoryHelpers.FetchInterfaceByName",
+    "MemoryHelpers.GetAddressBySignature",
+    "MemoryHelpers.GetObjectPtrVtableName",
+    "MemoryHelpers.GetVirtualTableAddress",
+    "MemoryHelpers.GetVirtualTableAddressNested2",
+    "MemoryHelpers.ObjectPtrHasBaseClass",
+    "MemoryHelpers.ObjectPtrHasVtable",
+    "NetMessages.AddBool",
+    "NetMessages.AddBytes",
+    "NetMessages.AddColor",
+    "NetMessages.AddDouble",
+    "NetMessages.AddFloat",
+    "NetMessages.AddInt32",
+    "NetMessages.AddInt64",
+    "NetMessages.AddNestedMessage",
+    "NetMessages.AddNetMessageClientHook",
+    "NetMessages.AddNetMessageServerHook",
+    "NetMessages.AddNetMessageServerHookInternal",
+    "NetMessages.AddQAngle",
+    "NetMessages.AddString",
+    "NetMessages.AddUInt32",
+    "NetMessages.AddUInt64",
+    "NetMessages.AddVector",
+    "NetMessages.AddVector2D",
+    "NetMessages.AllocateNetMessageByID",
+    "NetMessages.AllocateNetMessageByPartialName",
+    "NetMessages.Clear",
+    "NetMessages.ClearRepeatedField",
+    "NetMessages.DeallocateNetMessage",
+    "NetMessages.GetBool",
+    "NetMessages.GetBytes",
+    "NetMessages.GetColor",
+    "NetMessages.GetDouble",
+    "NetMessages.GetFloat",
+    "NetMessages.GetInt32",
+    "NetMessages.GetInt64",
+    "NetMessages.GetNestedMessage",
+    "NetMessages.GetQAngle",
+    "NetMessages.GetRepeatedBool",
+    "NetMessages.GetRepeatedBytes",
+    "NetMessages.GetRepeatedColor",
+    "NetMessages.GetRepeatedDouble",
+    "NetMessages.GetRepeatedFieldSize",
+    "NetMessages.GetRepeatedFloat",
+    "NetMessages.GetRepeatedInt32",
+    "NetMessages.GetRepeatedInt64",
+    "NetMessages.GetRepeatedNestedMessage",
+    "NetMessages.GetRepeatedQAngle",
+    "NetMessages.GetRepeatedString",
+    "NetMessages.GetRepeatedUInt32",
+    "NetMessages.GetRepeatedUInt64",
+    "NetMessages.GetRepeatedVector",
+    "NetMessages.GetRepeatedVector2D",
+    "NetMessages.GetString",
+    "NetMessages.GetUInt32",
+    "NetMessages.GetUInt64",
+    "NetMessages.GetVector",
+    "NetMessages.GetVector2D",
+    "NetMessages.HasField",
+    "NetMessages.RemoveNetMessageClientHook",
+    "NetMessages.RemoveNetMessageServerHook",
+    "NetMessages.RemoveNetMessageServerHookInternal",
+    "NetMessages.SendMessage",
+    "NetMessages.SendMessageToPlayers",
+    "NetMessages.SetBool",
+    "NetMessages.SetBytes",
+    "NetMessages.SetColor",
+    "NetMessages.SetDouble",
+    "NetMessages.SetFloat",
+    "NetMessages.SetInt32",
+    "NetMessages.SetInt64",
+    "NetMessages.SetQAngle",
+    "NetMessages.SetRepeatedBool",
+    "NetMessages.SetRepeatedBytes",
+    "NetMessages.SetRepeatedColor",
+    "NetMessages.SetRepeatedDouble",
+    "NetMessages.SetRepeatedFloat",
+    "NetMessages.SetRepeatedInt32",
+    "NetMessages.SetRepeatedInt64",
+    "NetMessages.SetRepeatedQAngle",
+    "NetMessages.SetRepeatedString",
+    "NetMessages.SetRepeatedUInt32",
+    "NetMessages.SetRepeatedUInt64",
+    "NetMessages.SetRepeatedVector",
+    "NetMessages.SetRepeatedVector2D",
+    "NetMessages.SetString",
+    "NetMessages.SetUInt32",
+    "NetMessages.SetUInt64",
+    "NetMessages.SetVector",
+    "NetMessages.SetVector2D",
+    "Offsets.Exists",
+    "Offsets.Fetch",
+    "Patches.Apply",
+    "Patches.Exists",
+    "Patches.Revert",
+    "Player.ChangeTeam",
+    "Player.ClearCenterMenuRender",
+    "Player.ClearTransmitEntityBlocked",
+    "Player.ExecuteCommand",
+    "Player.GetConnectedTime",
+    "Player.GetController",
+    "Player.GetIPAddress",
+    "Player.GetLanguage",
+    "Player.GetPawn",
+    "Player.GetPlayerPawn",
+    "Player.GetPressedButtons",
+    "Player.GetSteamID",
+    "Player.GetUnauthorizedSteamID",
+    "Player.GetUserID",
+    "Player.HasMenuShown",
+    "Player.IsAuthorized",
+    "Player.IsFakeClient",
+    "Player.IsFirstSpawn",
+    "Player.IsTransmitEntityBlocked",
+    "Player.Kick",
+    "Player.PerformCommand",
+    "Player.SendMessage",
+    "Player.SetCenterMenuRender",
+    "Player.ShouldBlockTransmitEntity",
+    "Player.SwitchTeam",
+    "Player.TakeDamage",
+    "Player.Teleport",
+    "PlayerManager.ClearAllBlockedTransmitEntity",
+    "PlayerManager.GetPlayerCap",
+    "PlayerManager.GetPlayerCount",
+    "PlayerManager.IsPlayerOnline",
+    "PlayerManager.SendMessage",
+    "PlayerManager.ShouldBlockTransmitEntity",
+    "Schema.FindChainOffset",
+    "Schema.GetOffset",
+    "Schema.GetPropPtr",
+    "Schema.GetVData",
+    "Schema.IsClassLoaded",
+    "Schema.IsStruct",
+    "Schema.SetStateChanged",
+    "Schema.WritePropPtr",
+    "ServerHelpers.GetServerLanguage",
+    "ServerHelpers.IsFollowingServerGuidelines",
+    "ServerHelpers.UseAutoHotReload",
+    "ServerHelpers.UsePlayerLanguage",
+    "Signatures.Exists",
+    "Signatures.Fetch",
+    "Sounds.AddAllClients",
+    "Sounds.AddClient",
+    "Sounds.ClearClients",
+    "Sounds.CreateSoundEvent",
+    "Sounds.DestroySoundEvent",
+    "Sounds.Emit",
+    "Sounds.GetBool",
+    "Sounds.GetClients",
+    "Sounds.GetFloat",
+    "Sounds.GetFloat3",
+    "Sounds.GetInt32",
+    "Sounds.GetName",
+    "Sounds.GetSourceEntityIndex",
+    "Sounds.GetUInt32",
+    "Sounds.GetUInt64",
+    "Sounds.HasField",
+    "Sounds.RemoveClient",
+    "Sounds.SetBool",
+    "Sounds.SetClients",
+    "Sounds.SetFloat",
+    "Sounds.SetFloat3",
+    "Sounds.SetInt32",
+    "Sounds.SetName",
+    "Sounds.SetSourceEntityIndex",
+    "Sounds.SetUInt32",
+    "Sounds.SetUInt64",
+    "Test.Test",
+    "VGUI.RegisterScreenText",
+    "VGUI.ScreenTextCreate",
+    "VGUI.ScreenTextSetColor",
+    "VGUI.ScreenTextSetPosition",
+    "VGUI.ScreenTextSetText",
+    "VGUI.UnregisterScreenText",
+    "VoiceManager.GetClientListenOverride",
+    "VoiceManager.GetClientVoiceFlags",
+    "VoiceManager.SetClientListenOverride",
+    "VoiceManager.SetClientVoiceFlags",
+};
+
+inline constexpr uint32_t g_NativeHashSeeds[NATIVE_HASH_BUCKETS] = {
+    4, 7, 11, 68, 47, 4, 26, 1, 14, 5, 1, 1, 1, 1, 10, 4,
+    1, 20, 3, 2, 2, 4, 23, 35, 1, 9, 20, 3, 6, 16, 9, 2,
+    16, 13, 69, 24, 40, 12, 3, 2, 6, 1, 3, 11, 1, 18, 2, 1,
+    2, 77, 27, 2, 3, 36, 0, 20, 70, 2, 61, 72, 50, 1, 4, 1,
+    6, 9, 25, 7, 42, 4, 30, 32, 39, 22, 2, 2, 8, 1, 1, 21,
+    4, 46, 57, 12, 9, 9, 1, 2, 3, 43, 20, 9, 8, 8, 18, 8,
+    8, 2, 1, 2, 37, 18, 4, 2, 14, 4, 1, 18, 79, 70, 7, 4,
+    28, 1, 8, 30, 17, 31, 42, 3, 19, 12, 74, 44, 2, 1,
+};
+
+inline constexpr int16_t g_NativeHashSlots[NATIVE_HASH_SLOTS] = {
+    179, 201, 241, 95, 419, 281, 439, -1, 192, 162, 452, 389, 116, 289, 146, 293,
+    45, 502, 351, 492, 165, 403, 98, 172, 217, -1, -1, 91, -1, 370, -1, 17,
+    410, -1, -1, 137, 435, 449, 75, 374, 104, 157, 257, 70, 308, 29, 191, -1,
+    263, 448, 317, -1, -1, 235, -1, 185, 109, 68, 135, -1, 363, 158, 413, 40,
+    425, 41, -1, 245, 140, 43, 335, 23, -1, 285, 477, 411, -1, 11, -1, 499,
+    102, 394, 2, 74, 131, 141, -1, 237, 203, 124, 44, 305, 243, 274, -1, -1,
+    342, 111, -1, 451, 393, 434, 246, 225, 164, 264, 115, 148, 126, 58, 430, 309,
+    364, 230, 312, 453, 361, 255, 450, 290, 69, 371, 170, 261, 287, 454, 377, 417,
+    408, 420, 481, 37, 344, 205, 167, 208, 475, 199, -1, -1, 169, 327, -1, 67,
+    -1, 445, -1, 186, 84, 129, 404, 151, -1, 249, 387, 458, 446, 120, 171, 484,
+    418, 497, 265, 321, -1, 438, -1, -1, -1, 196, 392, 366, 422, 232, 276, 334,
+    -1, 15, 433, 87, 291, 267, -1, 207, -1, 376, 49, 88, 32, 178, -1, 294,
+    228, 47, -1, 272, -1, 248, 81, 304, 22, -1, 0, -1, 114, 56, 30, 468,
+    176, 455, 240, 479, 441, 463, 213, 138, 315, -1, 107, 82, 277, 182, 424, 383,
+    -1, 461, 77, 253, -1, 127, 467, 390, -1, 483, 401, 302, 238, 262, 313, -1,
+    476, 79, 125, -1, 345, 270, -1, 219, 319, 395, 429, 128, 204, -1, 121, 9,
+    97, 1, -1, 224, 212, 349, 423, -1, 298, 133, 314, 227, 60, 153, 94, 431,
+    142, 362, 61, -1, 416, 152, 190, 19, 296, -1, -1, 300, 478, 503, 465, 123,
+    187, 280, 173, 282, 380, 183, -1, 143, 318, 236, -1, 375, -1, 57, 322, 341,
+    488, -1, 462, 85, 406, 278, 130, 63, 338, 368, 103, 426, 96, -1, 489, 174,
+    324, 36, 222, -1, 83, 328, 352, 214, 117, 472, 412, 118, 34, -1, 105, 211,
+    485, -1, 504, 12, -1, 100, 6, 491, 299, 286, 466, -1, 271, 347, 110, -1,
+    -1, 134, -1, 163, 51, 348, 62, -1, 10, 421, -1, 46, -1, -1, 175, -1,
+    333, -1, 269, -1, 150, 398, 231, 193, 490, 112, 52, -1, 242, 221, 108, 469,
+    -1, -1, 177, -1, 303, -1, 391, -1, -1, 470, -1, -1, 480, 473, 331, 432,
+    145, 437, 306, 493, -1, -1, 220, 18, -1, 343, -1, 244, 198, -1, 234, 336,
+    -1, 256, 332, 295, -1, 89, 119, 384, 7, 14, -1, 8, -1, 55, 33, 329,
+    486, 501, 16, 360, 206, 4, 301, -1, 386, -1, 330, 355, 359, 495, 456, 457,
+    279, 181, 92, -1, 136, 310, 226, -1, 59, 139, 195, 414, -1, 160, 202, 464,
+    147, 340, 498, 161, 223, 415, 388, 26, 442, 65, 399, 379, -1, 132, 365, 149,
+    -1, 66, 496, -1, 471, -1, -1, 283, 252, -1, -1, 180, 405, 369, 358, 156,
+    443, 292, -1, 350, 339, 288, 168, 326, 487, 73, 447, 251, -1, 373, 25, -1,
+    159, 166, -1, 258, 39, 259, 71, 106, 27, -1, 400, 144, 402, 76, 21, 113,
+    3, -1, 254, 210, 122, 215, 268, -1, 93, 233, -1, 86, 197, -1, 297, 99,
+    209, 381, 101, 427, -1, 436, -1, 72, 428, -1, 353, 260, 460, 53, 409, -1,
+    20, -1, 337, 200, 80, 194, -1, -1, 24, 397, 396, 357, 378, 189, 385, 54,
+    440, -1, -1, 372, 184, 28, 482, 90, 216, 218, 320, 354, 474, 78, 311, 346,
+    325, 382, 407, 284, 307, -1, 38, 500, 5, 31, -1, 316, 13, 50, 494, 459,
+    42, 444, 64, 35, 273, 48, 247, -1, 275, 188, 367, -1, -1, 239, 229, 250,
+    356, 323, -1,
+};
+
+constexpr bool NativeNameEquals(const char* a, const char* b)
+{
+    while (*a && *a == *b)
+    {
+        a++;
+        b++;
+    }
+    return *a == *b;
+}
+
+// NATIVE_FUNCTION_COUNT for names that aren't declared in natives/
+constexpr uint32_t NativeIdOf(const char* name)
+{
+    uint32_t seed = g_NativeHashSeeds[hash_32_fnv1a_const(name) % NATIVE_HASH_BUCKETS];
+    int16_t id = g_NativeHashSlots[hash_32_fnv1a_const(name, seed) % NATIVE_HASH_SLOTS];
+    if (id < 0 || !NativeNameEquals(g_NativeNames[id], name)) return NATIVE_FUNCTION_COUNT;
+
+    return static_cast<uint32_t>(id);
+}
+
+#endif
@@ -19,107 +19,58 @@
 #include <api/interfaces/manager.h>
 #include <scripting/scripting.h>
 
-int Bridge_Database_GetDefaultDriver(char* out)
+int Bridge_Database_GetDefaultDriver(char* out, int outSize)
 {
     static auto db = g_ifaceService.FetchInterface<IDatabaseManager>(DATABASEMANAGER_INTERFACE_VERSION);
-    static std::string o;
-    o = db->GetDefaultDriver();
 
-    if (out != nullptr)
-    {
-        strcpy(out, o.c_str());
-    }
-
-    return o.size();
+    return WriteNativeReturn(out, outSize, db->GetDefaultDriver());
 }
 
-int Bridge_Database_GetDefaultConnectionName(char* out)
+int Bridge_Database_GetDefaultConnectionName(char* out, int outSize)
 {
     static auto db = g_ifaceService.FetchInterface<IDatabaseManager>(DATABASEMANAGER_INTERFACE_VERSION);
-    static std::string o;
-    o = db->GetDefaultConnectionName();
-
-    if (out != nullptr)
-    {
-        strcpy(out, o.c_str());
-    }
 
-    return o.size();
+    return WriteNativeReturn(out, outSize, db->GetDefaultConnectionName());
 }
 
-int Bridge_Database_GetConnectionDriver(char* out, const char* connectionName)
+int Bridge_Database_GetConnectionDriver(char* out, int outSize, const char* connectionName)
 {
     static auto db = g_ifaceService.FetchInterface<IDatabaseManager>(DATABASEMANAGER_INTERFACE_VERSION);
-    static std::string o;
     auto conn = db->GetConnection(connectionName);
-    o = conn.driver;
 
-    if (out != nullptr)
-    {
-        strcpy(out, o.c_str());
-    }
-
-    return o.size();
+    return WriteNativeReturn(out, outSize, conn.driver);
 }
 
-int Bridge_Database_GetConnectionHost(char* out, const char* connectionName)
+int Bridge_Database_GetConnectionHost(char* out, int outSize, const char* connectionName)
 {
     static auto db = g_ifaceService.FetchInterface<IDatabaseManager>(DATABASEMANAGER_INTERFACE_VERSION);
-    static std::string o;
     auto conn = db->GetConnection(connectionName);
-    o = conn.host;
-
-    if (out != nullptr)
-    {
-        strcpy(out, o.c_str());
-    }
 
-    return o.size();
+    return WriteNativeReturn(out, outSize, conn.host);
 }
 
-int Bridge_Database_GetConnectionDatabase(char* out, const char* connectionName)
+int Bridge_Database_GetConnectionDatabase(char* out, int outSize, const char* connectionName)
 {
     static auto db = g_ifaceService.FetchInterface<IDatabaseManager>(DATABASEMANAGER_INTERFACE_VERSION);
-    static std::string o;
     auto conn = db->GetConnection(connectionName);
-    o = conn.database;
 
-    if (out != nullptr)
-    {
-        strcpy(out, o.c_str());
-    }
-
-    return o.size();
+    return WriteNativeReturn(out, outSize, conn.database);
 }
 
-int Bridge_Database_GetConnectionUser(char* out, const char* connectionName)
+int Bridge_Database_GetConnectionUser(char* out, int outSize, const char* connectionName)
 {
     static auto db = g_ifaceService.FetchInterface<IDatabaseManager>(DATABASEMANAGER_INTERFACE_VERSION);
-    static std::string o;
     auto conn = db->GetConnection(connectionName);
-    o = conn.user;
-
-    if (out != nullptr)
-    {
-        strcpy(out, o.c_str());
-    }
 
-    return o.size();
+    return WriteNativeReturn(out, outSize, conn.user);
 }
 
-int Bridge_Database_GetConnectionPass(char* out, const char* connectionName)
+int Bridge_Database_GetConnectionPass(char* out, int outSize, const char* connectionName)
 {
     static auto db = g_ifaceService.FetchInterface<IDatabaseManager>(DATABASEMANAGER_INTERFACE_VERSION);
-    static std::string o;
     auto conn = db->GetConnection(connectionName);
-    o = conn.pass;
 
-    if (out != nullptr)
-    {
-        strcpy(out, o.c_str());
-    }
-
-    return o.size();
+    return WriteNativeReturn(out, outSize, conn.pass);
 }
 
 uint32_t Bridge_Database_GetConnectionTimeout(const char* connectionName)
@@ -136,19 +87,12 @@ uint16_t Bridge_Database_GetConnectionPort(const char* connectionName)
     return conn.port;
 }
 
-int Bridge_Database_GetConnectionRawUri(char* out, const char* connectionName)
+int Bridge_Database_GetConnectionRawUri(char* out, int outSize, const char* connectionName)
 {
     static auto db = g_ifaceService.FetchInterface<IDatabaseManager>(DATABASEMANAGER_INTERFACE_VERSION);
-    static std::string o;
     auto conn = db->GetConnection(connectionName);
-    o = conn.rawUri;
-
-    if (out != nullptr)
-    {
-        strcpy(out, o.c_str());
-    }
 
-    return o.size();
+    return WriteNativeReturn(out, outSize, conn.rawUri);
 }
 
 bool Bridge_Database_ConnectionExists(const char* connectionName)
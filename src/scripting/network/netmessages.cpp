@@ -502,37 +502,23 @@ void Bridge_NetMessages_AddDouble(void* pmsg, const char* fieldName, double valu
     msg->GetReflection()->AddDouble(msg, field, value);
 }
 
-int Bridge_NetMessages_GetString(char* out, void* pmsg, const char* fieldName)
+int Bridge_NetMessages_GetString(char* out, int outSize, void* pmsg, const char* fieldName)
 {
     google::protobuf::Message* msg = (google::protobuf::Message*)pmsg;
     GETCHECK_FIELD(0);
     CHECK_FIELD_NOT_REPEATED(0);
 
-    static std::string s;
-    s = msg->GetReflection()->GetString(*msg, field);
-    if (out != nullptr)
-    {
-        strcpy(out, s.c_str());
-    }
-
-    return s.size();
+    return WriteNativeReturn(out, outSize, msg->GetReflection()->GetString(*msg, field));
 }
 
-int Bridge_NetMessages_GetRepeatedString(char* out, void* pmsg, const char* fieldName, int index)
+int Bridge_NetMessages_GetRepeatedString(char* out, int outSize, void* pmsg, const char* fieldName, int index)
 {
     google::protobuf::Message* msg = (google::protobuf::Message*)pmsg;
     GETCHECK_FIELD(0);
     CHECK_FIELD_REPEATED(0);
     CHECK_REPEATED_ELEMENT(index, 0);
 
-    static std::string s;
-    s = msg->GetReflection()->GetRepeatedString(*msg, field, index);
-    if (out != nullptr)
-    {
-        strcpy(out, s.c_str());
-    }
-
-    return s.size();
+    return WriteNativeReturn(out, outSize, msg->GetReflection()->GetRepeatedString(*msg, field, index));
 }
 
 void Bridge_NetMessages_SetString(void* pmsg, const char* fieldName, const char* value)
@@ -822,37 +808,23 @@ void Bridge_NetMessages_AddQAngle(void* pmsg, const char* fieldName, QAngle valu
     msgAngle->set_z(value.z);
 }
 
-int Bridge_NetMessages_GetBytes(uint8_t* out, void* pmsg, const char* fieldName)
+int Bridge_NetMessages_GetBytes(uint8_t* out, int outSize, void* pmsg, const char* fieldName)
 {
     google::protobuf::Message* msg = (google::protobuf::Message*)pmsg;
     GETCHECK_FIELD(0);
     CHECK_FIELD_NOT_REPEATED(0);
 
-    static std::string s;
-    s = msg->GetReflection()->GetString(*msg, field);
-    if (out != nullptr)
-    {
-        std::memcpy(out, s.data(), s.size());
-    }
-
-    return s.size();
+    return WriteNativeReturn(out, outSize, msg->GetReflection()->GetString(*msg, field));
 }
 
-int Bridge_NetMessages_GetRepeatedBytes(uint8_t* out, void* pmsg, const char* fieldName, int index)
+int Bridge_NetMessages_GetRepeatedBytes(uint8_t* out, int outSize, void* pmsg, const char* fieldName, int index)
 {
     google::protobuf::Message* msg = (google::protobuf::Message*)pmsg;
     GETCHECK_FIELD(0);
     CHECK_FIELD_REPEATED(0);
     CHECK_REPEATED_ELEMENT(index, 0);
 
-    static std::string s;
-    s = msg->GetReflection()->GetRepeatedString(*msg, field, index);
-    if (out != nullptr)
-    {
-        std::memcpy(out, s.data(), s.size());
-    }
-
-    return s.size();
+    return WriteNativeReturn(out, outSize, msg->GetReflection()->GetRepeatedString(*msg, field, index));
 }
 
 void Bridge_NetMessages_SetBytes(void* pmsg, const char* fieldName, char* value, int valueLength)
@@ -41,16 +41,9 @@ void Bridge_Sounds_SetName(void* event, const char* name)
     ((ISoundEvent*)event)->SetName(name);
 }
 
-int Bridge_Sounds_GetName(char* buffer, void* event)
+int Bridge_Sounds_GetName(char* out, int outSize, void* event)
 {
-    static std::string s;
-    s = ((ISoundEvent*)event)->GetName();
-
-    if (buffer != nullptr) {
-        strcpy(buffer, s.c_str());
-    }
-
-    return s.size();
+    return WriteNativeReturn(out, outSize, ((ISoundEvent*)event)->GetName());
 }
 
 void Bridge_Sounds_SetSourceEntityIndex(void* event, int index)
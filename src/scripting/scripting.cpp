@@ -18,13 +18,20 @@
 
 #include "scripting.h"
 
-NativeFunction g_NativeFunctions[MAX_NATIVE_FUNCTIONS];
-int g_NativeFunctionCount = 0;
+NativeFunction g_NativeFunctions[NATIVE_FUNCTION_COUNT];
 
 NativeFunction* CScriptingAPI::GetNativeFunctions() {
+    // declared but not implemented natives still get their name, retired ids keep a null one
+    for (uint32_t i = 0; i < NATIVE_FUNCTION_COUNT; i++)
+        if (!g_NativeFunctions[i].name) g_NativeFunctions[i].name = g_NativeNames[i];
+
     return g_NativeFunctions;
 }
 
 int CScriptingAPI::GetNativeFunctionsCount() {
-    return g_NativeFunctionCount;
+    return NATIVE_FUNCTION_COUNT;
+}
+
+uint64_t CScriptingAPI::GetNativeNamesHash() {
+    return NATIVE_NAMES_HASH;
 }
\ No newline at end of file
@@ -21,18 +21,35 @@
 
 #include <api/scripting/scripting.h>
 
+#include "natives.h"
+
+#include <algorithm>
+#include <cstring>
+#include <string_view>
+#include <type_traits>
+
 class CScriptingAPI : public IScriptingAPI
 {
 public:
     virtual NativeFunction* GetNativeFunctions() override;
     virtual int GetNativeFunctionsCount() override;
+    virtual uint64_t GetNativeNamesHash() override;
 };
 
-const int MAX_NATIVE_FUNCTIONS = 1024;
-extern NativeFunction g_NativeFunctions[MAX_NATIVE_FUNCTIONS];
-extern int g_NativeFunctionCount;
+// indexed by native id, see natives.h
+extern NativeFunction g_NativeFunctions[NATIVE_FUNCTION_COUNT];
+
+// String and byte returns go straight into the caller's buffer in a single call. The full length
+// is always returned, anything above outSize was cut off and the caller asks again with a buffer
+// of that size. Nothing is kept between calls, so these natives are safe off the main thread.
+inline int WriteNativeReturn(void* out, int outSize, std::string_view value)
+{
+    if (out != nullptr && outSize > 0) memcpy(out, value.data(), std::min<size_t>(value.size(), outSize));
+    return static_cast<int>(value.size());
+}
 
 #endif 
 
 #define DEFINE_NATIVE(name, func) \
-    static int dummy_##func = (g_NativeFunctions[g_NativeFunctionCount++] = {name, (void*)func}, 0)
\ No newline at end of file
+    static_assert(NativeIdOf(name) < NATIVE_FUNCTION_COUNT, "Native " name " isn't declared in natives/, run generator/native_generator."); \
+    static int dummy_##func = (g_NativeFunctions[std::integral_constant<uint32_t, NativeIdOf(name)>::value] = {name, (void*)func}, 0)
\ No newline at end of file
@@ -69,14 +69,9 @@ double Bridge_CEntityKeyValues_GetDouble(void* keyvalues, const char* keyName)
     return ((CEntityKeyValues*)keyvalues)->GetDouble(keyName);
 }
 
-int Bridge_CEntityKeyValues_GetString(char* out, void* keyvalues, const char* keyName)
+int Bridge_CEntityKeyValues_GetString(char* out, int outSize, void* keyvalues, const char* keyName)
 {
-    static std::string s;
-    s = ((CEntityKeyValues*)keyvalues)->GetString(keyName);
-
-    if (out) strcpy(out, s.c_str());
-
-    return s.size();
+    return WriteNativeReturn(out, outSize, ((CEntityKeyValues*)keyvalues)->GetString(keyName));
 }
 
 void* Bridge_CEntityKeyValues_GetPtr(void* keyvalues, const char* keyName)
@@ -19,16 +19,11 @@
 #include <scripting/scripting.h>
 #include <api/interfaces/manager.h>
 
-int Bridge_ServerHelpers_GetServerLanguage(char* out)
+int Bridge_ServerHelpers_GetServerLanguage(char* out, int outSize)
 {
     static auto configuration = g_ifaceService.FetchInterface<IConfiguration>(CONFIGURATION_INTERFACE_VERSION);
 
-    static std::string s;
-    s = std::get<std::string>(configuration->GetValue("core.Language"));
-
-    if (out != nullptr) strcpy(out, s.c_str());
-
-    return s.size();
+    return WriteNativeReturn(out, outSize, std::get<std::string>(configuration->GetValue("core.Language")));
 }
 
 bool Bridge_ServerHelpers_UsePlayerLanguage()
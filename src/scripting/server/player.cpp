@@ -131,20 +131,14 @@ void Bridge_Player_PerformCommand(int playerid, const char* command)
     player->PerformCommand(command);
 }
 
-int Bridge_Player_GetIPAddress(char* out, int playerid)
+int Bridge_Player_GetIPAddress(char* out, int outSize, int playerid)
 {
     static auto playerManager = g_ifaceService.FetchInterface<IPlayerManager>(PLAYERMANAGER_INTERFACE_VERSION);
     auto player = playerManager->GetPlayer(playerid);
     if (!player)
         return 0;
 
-    static std::string s;
-    s = player->GetIPAddress();
-
-    if (out != nullptr)
-        strcpy(out, s.c_str());
-
-    return s.size();
+    return WriteNativeReturn(out, outSize, player->GetIPAddress());
 }
 
 void Bridge_Player_Kick(int playerid, const char* reason, int gamereason)
@@ -236,7 +230,7 @@ void Bridge_Player_ChangeTeam(int playerid, int newteam)
         return;
 
     static auto gamedata = g_ifaceService.FetchInterface<IGameDataManager>(GAMEDATA_INTERFACE_VERSION);
-    CALL_VIRTUAL(void, gamedata->GetOffsets()->Fetch("CCSPlayerController::ChangeTeam"), player->GetController(), newteam);
+    CALL_VIRTUAL(void, gamedata->GetOffsets()->Fetch(GameDataOffset::CCSPlayerController_ChangeTeam), player->GetController(), newteam);
 }
 
 void Bridge_Player_SwitchTeam(int playerid, int newteam)
@@ -248,9 +242,9 @@ void Bridge_Player_SwitchTeam(int playerid, int newteam)
 
     static auto gamedata = g_ifaceService.FetchInterface<IGameDataManager>(GAMEDATA_INTERFACE_VERSION);
     if (newteam == 0 || newteam == 1)
-        CALL_VIRTUAL(void, gamedata->GetOffsets()->Fetch("CCSPlayerController::ChangeTeam"), player->GetController(), newteam);
+        CALL_VIRTUAL(void, gamedata->GetOffsets()->Fetch(GameDataOffset::CCSPlayerController_ChangeTeam), player->GetController(), newteam);
     else
-        reinterpret_cast<void (*)(void*, int)>(gamedata->GetSignatures()->Fetch("CCSPlayerController::SwitchTeam"))(player->GetController(), newteam);
+        reinterpret_cast<void (*)(void*, int)>(gamedata->GetSignatures()->Fetch(GameDataSignature::CCSPlayerController_SwitchTeam))(player->GetController(), newteam);
 }
 
 void Bridge_Player_TakeDamage(int playerid, void* dmginfo)
@@ -261,7 +255,7 @@ void Bridge_Player_TakeDamage(int playerid, void* dmginfo)
         return;
 
     static auto gamedata = g_ifaceService.FetchInterface<IGameDataManager>(GAMEDATA_INTERFACE_VERSION);
-    reinterpret_cast<int64_t(*)(void*, void*, void*)>(gamedata->GetSignatures()->Fetch("CBaseEntity::TakeDamage"))(player->GetPawn(), dmginfo, 0);
+    reinterpret_cast<int64_t(*)(void*, void*, void*)>(gamedata->GetSignatures()->Fetch(GameDataSignature::CBaseEntity_TakeDamage))(player->GetPawn(), dmginfo, 0);
 }
 
 void Bridge_Player_Teleport(int playerid, Vector pos, QAngle angle, Vector vel)
@@ -272,23 +266,17 @@ void Bridge_Player_Teleport(int playerid, Vector pos, QAngle angle, Vector vel)
         return;
 
     static auto gamedata = g_ifaceService.FetchInterface<IGameDataManager>(GAMEDATA_INTERFACE_VERSION);
-    CALL_VIRTUAL(void, gamedata->GetOffsets()->Fetch("CBaseEntity::Teleport"), player->GetPawn(), &pos, &angle, &vel);
+    CALL_VIRTUAL(void, gamedata->GetOffsets()->Fetch(GameDataOffset::CBaseEntity_Teleport), player->GetPawn(), &pos, &angle, &vel);
 }
 
-int Bridge_Player_GetLanguage(char* out, int playerid)
+int Bridge_Player_GetLanguage(char* out, int outSize, int playerid)
 {
     static auto playerManager = g_ifaceService.FetchInterface<IPlayerManager>(PLAYERMANAGER_INTERFACE_VERSION);
     auto player = playerManager->GetPlayer(playerid);
     if (!player)
         return 0;
 
-    static std::string s;
-    s = player->GetLanguage();
-
-    if (out != nullptr)
-        strcpy(out, s.c_str());
-
-    return s.size();
+    return WriteNativeReturn(out, outSize, player->GetLanguage());
 }
 
 void Bridge_Player_SetCenterMenuRender(int playerid, const char* text)
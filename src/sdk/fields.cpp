@@ -0,0 +1,45 @@
+/************************************************************************************************
+ *  SwiftlyS2 is a scripting framework for Source2-based games.
+ *  Copyright (C) 2023-2026 Swiftly Solution SRL via Sava Andrei-Sebastian and it's contributors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ ************************************************************************************************/
+
+#include "fields.h"
+
+#include <api/shared/hash.h>
+
+std::unordered_map<uint64_t, SchemaField> offsets;
+std::unordered_map<uint32_t, SchemaClass> classes;
+
+uint64_t GetSchemaFieldHash(const char* sClassName, const char* sMemberName)
+{
+    uint32_t class_hash = hash_32_fnv1a_const(sClassName);
+    return ((uint64_t)(class_hash) << 32 | hash_32_fnv1a_const(sMemberName));
+}
+
+const SchemaField* FindSchemaField(uint64_t uHash)
+{
+    auto it = offsets.find(uHash);
+    if (it == offsets.end()) return nullptr;
+    return &it->second;
+}
+
+void* GetSchemaFieldPtr(void* pEntity, uint64_t uHash)
+{
+    auto field = FindSchemaField(uHash);
+    if (!field) return nullptr;
+
+    return reinterpret_cast<void*>((uintptr_t)pEntity + field->m_uOffset);
+}
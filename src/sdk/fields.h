@@ -0,0 +1,55 @@
+/************************************************************************************************
+ *  SwiftlyS2 is a scripting framework for Source2-based games.
+ *  Copyright (C) 2023-2026 Swiftly Solution SRL via Sava Andrei-Sebastian and it's contributors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ ************************************************************************************************/
+
+#ifndef src_sdk_fields_h
+#define src_sdk_fields_h
+
+#include <cstdint>
+#include <unordered_map>
+
+// The field and class tables filled by the schema reader. Kept free of SDK headers so the
+// lookups can be linked without the schema system (benchmarks/natives).
+
+struct SchemaField
+{
+    bool m_bNetworked;
+    bool m_bChainer;
+    bool m_bIsStruct;
+    uint32_t m_uOffset;
+    int32_t m_nChainerOffset;
+    uint32_t m_uSize;
+};
+
+struct SchemaClass
+{
+    bool m_bIsStruct;
+    uint32_t m_uSize;
+    uint32_t m_uAlignment;
+    uint32_t m_uHash;
+};
+
+extern std::unordered_map<uint64_t, SchemaField> offsets;
+extern std::unordered_map<uint32_t, SchemaClass> classes;
+
+// class name hash in the high half, field name hash in the low half
+uint64_t GetSchemaFieldHash(const char* sClassName, const char* sMemberName);
+
+const SchemaField* FindSchemaField(uint64_t uHash);
+void* GetSchemaFieldPtr(void* pEntity, uint64_t uHash);
+
+#endif
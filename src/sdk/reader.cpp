@@ -213,13 +213,13 @@ void ReadClasses(CSchemaType_DeclaredClass* declClass, json& outJson)
         auto field = fields[i];
         uint64_t fieldHash = ((uint64_t)(class_hash) << 32 | hash_32_fnv1a_const(field.m_pszName));
 
-        offsets.insert({ fieldHash, { IsFieldNetworked(field), has_chainer, isStruct, (uint32_t)field.m_nSingleInheritanceOffset, chainer_offset } });
-
         int size;
         uint8_t alignment;
 
         field.m_pType->GetSizeAndAlignment(size, alignment);
 
+        offsets.insert({ fieldHash, { IsFieldNetworked(field), has_chainer, isStruct, (uint32_t)field.m_nSingleInheritanceOffset, chainer_offset, (uint32_t)size } });
+
         cls["fields"].push_back({
             {"name", field.m_pszName},
             {"name_hash", fieldHash},
@@ -33,8 +33,6 @@
 
 #define CBaseEntity_m_nSubclassID 0x9DC483B8C02CE796
 
-std::unordered_map<uint64_t, SchemaField> offsets;
-std::unordered_map<uint32_t, SchemaClass> classes;
 std::unordered_map<uint64_t, uint64_t> inlineNetworkVarVtbs;
 
 // Special inline classes for state changed
@@ -183,18 +181,17 @@ void CSDKSchema::Load()
 
 void CSDKSchema::SetStateChanged(void* pEntity, const char* sClassName, const char* sMemberName)
 {
-	uint32_t class_hash = hash_32_fnv1a_const(sClassName);
-	uint64_t fieldHash = ((uint64_t)(class_hash) << 32 | hash_32_fnv1a_const(sMemberName));
+	uint64_t fieldHash = GetSchemaFieldHash(sClassName, sMemberName);
 
 	SetStateChanged(pEntity, fieldHash);
 }
 
 void CSDKSchema::SetStateChanged(void* pEntity, uint64_t uHash)
 {
-	auto fieldData = offsets.find(uHash);
-	if (fieldData == offsets.end()) return;
+	auto field = FindSchemaField(uHash);
+	if (!field) return;
 
-	auto& fieldInfo = fieldData->second;
+	auto& fieldInfo = *field;
 	if (!fieldInfo.m_bNetworked) return;
 	auto logger = g_ifaceService.FetchInterface<ILogger>(LOGGER_INTERFACE_VERSION);
 
@@ -230,16 +227,22 @@ int32_t CSDKSchema::FindChainOffset(const char* sClassName)
 
 int32_t CSDKSchema::GetOffset(const char* sClassName, const char* sMemberName)
 {
-	uint32_t class_hash = hash_32_fnv1a_const(sClassName);
-	uint64_t fieldHash = ((uint64_t)(class_hash) << 32 | hash_32_fnv1a_const(sMemberName));
+	uint64_t fieldHash = GetSchemaFieldHash(sClassName, sMemberName);
 	return GetOffset(fieldHash);
 }
 
 int32_t CSDKSchema::GetOffset(uint64_t uHash)
 {
-	auto it = offsets.find(uHash);
-	if (it == offsets.end()) return 0;
-	else return it->second.m_uOffset;
+	auto field = FindSchemaField(uHash);
+	if (!field) return 0;
+	else return field->m_uOffset;
+}
+
+uint32_t CSDKSchema::GetFieldSize(uint64_t uHash)
+{
+	auto field = FindSchemaField(uHash);
+	if (!field) return 0;
+	else return field->m_uSize;
 }
 
 bool CSDKSchema::IsStruct(const char* sClassName)
@@ -256,25 +259,19 @@ bool CSDKSchema::IsClassLoaded(const char* sClassName)
 
 void* CSDKSchema::GetPropPtr(void* pEntity, const char* sClassName, const char* sMemberName)
 {
-	uint32_t class_hash = hash_32_fnv1a_const(sClassName);
-	uint64_t fieldHash = ((uint64_t)(class_hash) << 32 | hash_32_fnv1a_const(sMemberName));
+	uint64_t fieldHash = GetSchemaFieldHash(sClassName, sMemberName);
 
 	return GetPropPtr(pEntity, fieldHash);
 }
 
 void* CSDKSchema::GetPropPtr(void* pEntity, uint64_t uHash)
 {
-	auto it = offsets.find(uHash);
-	if (it == offsets.end()) return nullptr;
-
-	auto& fieldInfo = it->second;
-	return reinterpret_cast<void*>((uintptr_t)pEntity + fieldInfo.m_uOffset);
+	return GetSchemaFieldPtr(pEntity, uHash);
 }
 
 void CSDKSchema::WritePropPtr(void* pEntity, const char* sClassName, const char* sMemberName, void* pValue, uint32_t size)
 {
-	uint32_t class_hash = hash_32_fnv1a_const(sClassName);
-	uint64_t fieldHash = ((uint64_t)(class_hash) << 32 | hash_32_fnv1a_const(sMemberName));
+	uint64_t fieldHash = GetSchemaFieldHash(sClassName, sMemberName);
 
 	WritePropPtr(pEntity, fieldHash, pValue, size);
 }
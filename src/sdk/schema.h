@@ -23,6 +23,8 @@
 #include <api/shared/string.h>
 #include <api/memory/virtual/call.h>
 
+#include "fields.h"
+
 #include <public/schemasystem/schemasystem.h>
 #include <nlohmann/json.hpp>
 
@@ -44,6 +46,7 @@ public:
 
     virtual int32_t GetOffset(const char* sClassName, const char* sMemberName) override;
     virtual int32_t GetOffset(uint64_t uHash) override;
+    virtual uint32_t GetFieldSize(uint64_t uHash) override;
 
     virtual bool IsStruct(const char* sClassName) override;
     virtual bool IsClassLoaded(const char* sClassName) override;
@@ -59,26 +62,6 @@ public:
     virtual void Load() override;
 };
 
-struct SchemaField
-{
-    bool m_bNetworked;
-    bool m_bChainer;
-    bool m_bIsStruct;
-    uint32_t m_uOffset;
-    int32_t m_nChainerOffset;
-};
-
-struct SchemaClass
-{
-    bool m_bIsStruct;
-    uint32_t m_uSize;
-    uint32_t m_uAlignment;
-    uint32_t m_uHash;
-};
-
-extern std::unordered_map<uint64_t, SchemaField> offsets;
-extern std::unordered_map<uint32_t, SchemaClass> classes;
-
 class NetworkVar {
 public:
     uint64_t pVtable() const { return *(uint64_t*)this; };
@@ -79,14 +79,14 @@ void CServerCommands::Initialize()
     s2binlib_find_vtable("tier0", "CCvar", &ccvarVTable);
 
     dispatchConCommandHook = hooksmanager->CreateVFunctionHook();
-    dispatchConCommandHook->SetHookFunction(ccvarVTable, gamedata->GetOffsets()->Fetch("ICvar::DispatchConCommand"), (void*)DispatchConCommand, true);
+    dispatchConCommandHook->SetHookFunction(ccvarVTable, gamedata->GetOffsets()->Fetch(GameDataOffset::ICvar_DispatchConCommand), (void*)DispatchConCommand, true);
     dispatchConCommandHook->Enable();
 
     void* gameclientsvtable = nullptr;
     s2binlib_find_vtable("server", "CSource2GameClients", &gameclientsvtable);
 
     clientCommandHook2 = hooksmanager->CreateVFunctionHook();
-    clientCommandHook2->SetHookFunction(gameclientsvtable, gamedata->GetOffsets()->Fetch("IServerGameClients::ClientCommand"), (void*)ClientCommandHook2, true);
+    clientCommandHook2->SetHookFunction(gameclientsvtable, gamedata->GetOffsets()->Fetch(GameDataOffset::IServerGameClients_ClientCommand), (void*)ClientCommandHook2, true);
     clientCommandHook2->Enable();
 }
 
@@ -521,6 +521,9 @@ bool Configuration::Load()
 
         RegisterConfiguration(wasEdited, config_json, "core", "core", "DotnetCrashTracerLevel", 0);
 
+        RegisterConfiguration(wasEdited, config_json, "core", "core", "Logs.MaxFileSizeMB", 50);
+        RegisterConfiguration(wasEdited, config_json, "core", "core", "Logs.RotateDaily", true);
+
         if (wasEdited) {
             WriteJSONFile(g_SwiftlyCore.GetCorePath() + "configs/core.jsonc", config_json);
         }
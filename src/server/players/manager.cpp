@@ -76,32 +76,32 @@ void CPlayerManager::Initialize()
     s2binlib_find_vtable("server", "CSource2GameEntities", &gameentitiesvtable);
 
     g_pClientConnectHook = hooksmanager->CreateVFunctionHook();
-    g_pClientConnectHook->SetHookFunction(gameclientsvtable, gamedata->GetOffsets()->Fetch("IServerGameClients::ClientConnect"), reinterpret_cast<void*>(ClientConnectHook), true);
+    g_pClientConnectHook->SetHookFunction(gameclientsvtable, gamedata->GetOffsets()->Fetch(GameDataOffset::IServerGameClients_ClientConnect), reinterpret_cast<void*>(ClientConnectHook), true);
     g_pClientConnectHook->Enable();
 
     g_pOnClientConnectedHook = hooksmanager->CreateVFunctionHook();
-    g_pOnClientConnectedHook->SetHookFunction(gameclientsvtable, gamedata->GetOffsets()->Fetch("IServerGameClients::OnClientConnected"), reinterpret_cast<void*>(OnClientConnectedHook), true);
+    g_pOnClientConnectedHook->SetHookFunction(gameclientsvtable, gamedata->GetOffsets()->Fetch(GameDataOffset::IServerGameClients_OnClientConnected), reinterpret_cast<void*>(OnClientConnectedHook), true);
     g_pOnClientConnectedHook->Enable();
 
     g_pClientDisconnectHook = hooksmanager->CreateVFunctionHook();
-    g_pClientDisconnectHook->SetHookFunction(gameclientsvtable, gamedata->GetOffsets()->Fetch("IServerGameClients::ClientDisconnect"), reinterpret_cast<void*>(ClientDisconnectHook), true);
+    g_pClientDisconnectHook->SetHookFunction(gameclientsvtable, gamedata->GetOffsets()->Fetch(GameDataOffset::IServerGameClients_ClientDisconnect), reinterpret_cast<void*>(ClientDisconnectHook), true);
     g_pClientDisconnectHook->Enable();
 
     g_pClientPutInServerHook = hooksmanager->CreateVFunctionHook();
-    g_pClientPutInServerHook->SetHookFunction(gameclientsvtable, gamedata->GetOffsets()->Fetch("IServerGameClients::ClientPutInServer"), reinterpret_cast<void*>(OnClientPutInServerHook), true);
+    g_pClientPutInServerHook->SetHookFunction(gameclientsvtable, gamedata->GetOffsets()->Fetch(GameDataOffset::IServerGameClients_ClientPutInServer), reinterpret_cast<void*>(OnClientPutInServerHook), true);
     g_pClientPutInServerHook->Enable();
 
     g_pCheckTransmitHook = hooksmanager->CreateVFunctionHook();
-    g_pCheckTransmitHook->SetHookFunction(gameentitiesvtable, gamedata->GetOffsets()->Fetch("ISource2GameEntities::CheckTransmit"), reinterpret_cast<void*>(CheckTransmitHook), true);
+    g_pCheckTransmitHook->SetHookFunction(gameentitiesvtable, gamedata->GetOffsets()->Fetch(GameDataOffset::ISource2GameEntities_CheckTransmit), reinterpret_cast<void*>(CheckTransmitHook), true);
     g_pCheckTransmitHook->Enable();
 
-    auto processusercmds = gamedata->GetSignatures()->Fetch("CCSPlayerController::ProcessUserCmd");
+    auto processusercmds = gamedata->GetSignatures()->Fetch(GameDataSignature::CCSPlayerController_ProcessUserCmd);
 
     void* serverGameDLLVTable;
     s2binlib_find_vtable("server", "CSource2Server", &serverGameDLLVTable);
 
     g_pOnGameFramePlayerHook = hooksmanager->CreateVFunctionHook();
-    g_pOnGameFramePlayerHook->SetHookFunction(serverGameDLLVTable, gamedata->GetOffsets()->Fetch("IServerGameDLL::GameFrame"), reinterpret_cast<void*>(OnGameFramePlayerHook), true);
+    g_pOnGameFramePlayerHook->SetHookFunction(serverGameDLLVTable, gamedata->GetOffsets()->Fetch(GameDataOffset::IServerGameDLL_GameFrame), reinterpret_cast<void*>(OnGameFramePlayerHook), true);
     g_pOnGameFramePlayerHook->Enable();
 
     g_pProcessUserCmdsHook = hooksmanager->CreateFunctionHook();
@@ -262,6 +262,8 @@ void OnGameFramePlayerHook(void* _this, bool simulate, bool first, bool last)
 
     static auto playermanager = g_ifaceService.FetchInterface<IPlayerManager>(PLAYERMANAGER_INTERFACE_VERSION);
     static auto vgui = g_ifaceService.FetchInterface<IVGUI>(VGUI_INTERFACE_VERSION);
+    static auto cvarmanager = g_ifaceService.FetchInterface<IConvarManager>(CONVARMANAGER_INTERFACE_VERSION);
+    static auto memalloc = g_ifaceService.FetchInterface<IMemoryAllocator>(MEMORYALLOCATOR_INTERFACE_VERSION);
 
     if (g_pOnGameTickCallback)
         reinterpret_cast<void (*)(bool, bool, bool)>(g_pOnGameTickCallback)(simulate, first, last);
@@ -276,6 +278,9 @@ void OnGameFramePlayerHook(void* _this, bool simulate, bool first, bool last)
         }
 
     vgui->Update();
+    cvarmanager->ProcessClientQueries();
+
+    memalloc->ResetFrameArena();
 }
 
 extern void* g_pOnClientConnectCallback;
@@ -333,6 +338,10 @@ void ClientDisconnectHook(void* _this, CPlayerSlot slot, int reason, const char*
         reinterpret_cast<void (*)(int, int)>(g_pOnClientDisconnectCallback)(playerid, reason);
 
     playermanager->UnregisterPlayer(playerid);
+
+    // after unregistering, a requester that queries again from its callback is dropped too
+    static auto cvarmanager = g_ifaceService.FetchInterface<IConvarManager>(CONVARMANAGER_INTERFACE_VERSION);
+    cvarmanager->ClearClientQueries(playerid);
 }
 
 IPlayer* CPlayerManager::RegisterPlayer(int playerid)
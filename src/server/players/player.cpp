@@ -147,12 +147,16 @@ void CPlayer::SendMsg(MessageType type, const std::string& message, int duration
     }
     else
     {
-        auto msg = RemoveHtmlTags(message);
+        std::string msg;
         if (type == MessageType::Console)
         {
-            msg = ClearColors(msg);
+            ProcessColorTags(message, msg, ColorMode::Strip, 0, true);
             msg += "\n";
         }
+        else
+        {
+            msg = RemoveHtmlTags(message);
+        }
         if (msg.size() > 0)
         {
             if (msg.ends_with("\n"))
@@ -165,7 +169,7 @@ void CPlayer::SendMsg(MessageType type, const std::string& message, int duration
             if (!schema)
                 return;
 
-            msg = ProcessColor(message, *(int*)(schema->GetPropPtr(GetController(), CBaseEntity_m_iTeamNum)));
+            msg = ProcessColor(msg, *(int*)(schema->GetPropPtr(GetController(), CBaseEntity_m_iTeamNum)));
 
             if (startsWithColor)
                 msg = " " + msg;
@@ -407,7 +411,7 @@ void CPlayer::Think()
 {
     static auto gamedata = g_ifaceService.FetchInterface<IGameDataManager>(GAMEDATA_INTERFACE_VERSION);
     static auto eventmanager = g_ifaceService.FetchInterface<IEventManager>(GAMEEVENTMANAGER_INTERFACE_VERSION);
-    static auto pListenerSig = gamedata->GetSignatures()->Fetch("LegacyGameEventListener");
+    static auto pListenerSig = gamedata->GetSignatures()->Fetch(GameDataSignature::LegacyGameEventListener);
     if (pListenerSig)
     {
         auto listener = reinterpret_cast<GetLegacyGameEventListener>(pListenerSig)(m_iPlayerId);
@@ -66,7 +66,7 @@ void CTranslations::Initialize()
 {
     auto cvarmanager = g_ifaceService.FetchInterface<IConvarManager>(CONVARMANAGER_INTERFACE_VERSION);
 
-    cvarmanager->AddQueryClientCvarCallback([](int playerid, std::string cvar_name, std::string cvar_value) {
+    cvarmanager->AddQueryClientCvarCallback([](int playerid, const std::string& cvar_name, const std::string& cvar_value) {
         if (cvar_name != "cl_language") return;
 
         auto configuration = g_ifaceService.FetchInterface<IConfiguration>(CONFIGURATION_INTERFACE_VERSION);
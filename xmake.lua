@@ -372,6 +372,11 @@ target("swiftlys2")
     set_symbols("debug")
     set_strip("none")
 
+    -- the gamedata ids are compiled into the core, regenerate them before anything is built
+    before_build(function(target)
+        os.execv(is_host("windows") and "python" or "python3", {"generator/gamedata_generator/generate.py"})
+    end)
+
     after_build(function(target)
         function GetDistDirName()
             if is_plat("windows") then
@@ -387,6 +392,19 @@ target("swiftlys2")
         
         os.mkdir('build/package/addons/metamod')
         os.cp("plugin_files/", 'build/package/addons/swiftlys2')
+
+        -- precompiled gamedata bundle, the core parses the jsonc instead when it's missing or stale
+        try {
+            function()
+                os.execv(is_host("windows") and "python" or "python3", {"generator/gamedata_generator/generate.py", "build/package/addons/swiftlys2/gamedata/cs2"})
+            end,
+            catch {
+                function(err)
+                    print(err)
+                end
+            }
+        }
+
         os.mkdir('build/package/addons/swiftlys2/bin/'..GetDistDirName())
         os.cp(target:targetfile(), 'build/package/addons/swiftlys2/bin/'..GetDistDirName().."/swiftlys2."..(is_plat("windows") and "dll" or "so"))
         io.writefile("build/package/addons/metamod/swiftlys2.vdf", [["Metamod Plugin"
@@ -396,3 +414,50 @@ target("swiftlys2")
 }
 ]])
     end)
+
+--[[ -------------------------------- Benchmarks Section -------------------------------- ]]
+
+target("benchmark_mutex")
+    set_kind("binary")
+    set_default(false)
+
+    add_files("benchmarks/mutex/main.cpp")
+    add_includedirs("src")
+
+    set_languages("cxx23")
+    set_optimize("fastest")
+
+    if is_plat("linux") then
+        add_syslinks("pthread")
+    end
+
+target("benchmark_natives")
+    set_kind("binary")
+    set_default(false)
+    add_packages("fmt")
+    add_packages("pcre2")
+
+    add_files({
+        "benchmarks/natives/*.cpp",
+        "benchmarks/natives/stubs/*.cpp",
+
+        "src/api/shared/string.cpp",
+        "src/engine/consoleoutput/filters.cpp",
+        "src/memory/allocator/arena.cpp",
+        "src/scripting/intern.cpp",
+        "src/sdk/fields.cpp",
+    })
+
+    -- stubs first so they shadow the engine bound headers
+    add_includedirs({
+        "benchmarks/natives/stubs",
+        "src",
+        "vendor",
+    })
+
+    set_languages("cxx23")
+    set_optimize("fastest")
+
+    if is_plat("linux") then
+        add_syslinks("pthread")
+    end